@@ -0,0 +1,209 @@
+#define LOG_CATEGORY LOG_CATEGORY_MEMORY
+
+#include "arena.h"
+
+#include <cute_alloc.h>
+#include <cute_c_runtime.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #define ARENA_VIRTUAL_MEMORY 1
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+    #define ARENA_VIRTUAL_MEMORY 1
+    #include <sys/mman.h>
+#else
+    #define ARENA_VIRTUAL_MEMORY 0
+#endif
+
+#include "log.h"
+
+static size_t align_size(size_t size, size_t alignment) { return (size + alignment - 1) & ~(alignment - 1); }
+
+static size_t get_commit_granule(const Arena* arena) {
+    return (arena->flags & ARENA_FLAG_HUGE_PAGES) ? ARENA_HUGE_PAGE_SIZE : ARENA_COMMIT_GRANULE;
+}
+
+#if ARENA_VIRTUAL_MEMORY
+static void* reserve_memory(size_t size) {
+    #if defined(_WIN32)
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+    #else
+    void* memory = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return memory == MAP_FAILED ? nullptr : memory;
+    #endif
+}
+
+static bool commit_memory(void* memory, size_t size, ArenaFlags flags) {
+    #if defined(_WIN32)
+    (void)flags;
+    return VirtualAlloc(memory, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    #else
+    if (mprotect(memory, size, PROT_READ | PROT_WRITE) != 0) { return false; }
+        #ifdef MADV_HUGEPAGE
+    if (flags & ARENA_FLAG_HUGE_PAGES) { madvise(memory, size, MADV_HUGEPAGE); }
+        #else
+    (void)flags;
+        #endif
+    return true;
+    #endif
+}
+
+static void release_memory(void* memory, size_t size) {
+    #if defined(_WIN32)
+    (void)size;
+    VirtualFree(memory, 0, MEM_RELEASE);
+    #else
+    munmap(memory, size);
+    #endif
+}
+#endif  // ARENA_VIRTUAL_MEMORY
+
+Arena make_arena(const char* name, int alignment, size_t capacity, ArenaFlags flags) {
+    Arena arena = {
+        .capacity  = capacity,
+        .alignment = alignment,
+        .flags     = flags,
+    };
+    snprintf(arena.name, sizeof(arena.name), "%s", name);
+
+#if ARENA_VIRTUAL_MEMORY
+    // Over-reserve so the base can sit on a huge page boundary
+    const size_t padding = (flags & ARENA_FLAG_HUGE_PAGES) ? ARENA_HUGE_PAGE_SIZE : 0;
+    uint8_t*     memory  = reserve_memory(capacity + padding);
+
+    if (memory) {
+        arena.reservation = memory;
+        arena.reserved    = capacity + padding;
+        arena.base        = memory + (align_size((uintptr_t)memory, padding ? padding : 1) - (uintptr_t)memory);
+        return arena;
+    }
+    APP_WARN("Could not reserve %zu bytes for arena %s, using the heap", capacity, arena.name);
+#endif
+
+    // No virtual memory control, commit everything up front
+    arena.base            = cf_calloc(capacity, 1);
+    arena.stats.committed = capacity;
+    return arena;
+}
+
+void destroy_arena(Arena* arena) {
+#if ARENA_VIRTUAL_MEMORY
+    if (arena->reserved > 0) {
+        release_memory(arena->reservation, arena->reserved);
+    } else {
+        cf_free(arena->base);
+    }
+#else
+    cf_free(arena->base);
+#endif
+    *arena = (Arena){0};
+}
+
+static bool ensure_committed(Arena* arena, size_t end) {
+    if (end <= arena->stats.committed) { return true; }
+
+#if ARENA_VIRTUAL_MEMORY
+    const size_t target = align_size(end, get_commit_granule(arena));
+    const size_t commit = (target < arena->capacity ? target : arena->capacity) - arena->stats.committed;
+
+    if (!commit_memory(arena->base + arena->stats.committed, commit, arena->flags)) {
+        APP_ERROR("Could not commit %zu bytes in arena %s", commit, arena->name);
+        return false;
+    }
+    arena->stats.committed += commit;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    auto         stats  = &arena->stats;
+    const size_t offset = align_size(stats->used, (size_t)arena->alignment);
+
+    if (offset + size > arena->capacity) {
+        APP_ERROR("Arena %s is out of memory: %zu of %zu bytes requested", arena->name, size, arena->capacity);
+        return nullptr;
+    }
+    if (!ensure_committed(arena, offset + size)) { return nullptr; }
+
+    stats->used = offset + size;
+    stats->allocation_count++;
+    stats->frame_allocation_count++;
+    if (stats->used > stats->frame_peak) { stats->frame_peak = stats->used; }
+    if (stats->used > stats->session_peak) { stats->session_peak = stats->used; }
+
+    return arena->base + offset;
+}
+
+void* arena_alloc_required(Arena* arena, size_t size) {
+    void* memory = arena_alloc(arena, size);
+    if (memory == nullptr) {
+        APP_FATAL("Arena %s cannot fit a %zu byte allocation made at init", arena->name, size);
+        CF_ASSERT(false);
+    }
+    return memory;
+}
+
+// Committed pages stay committed, the next frame will most likely need them again
+void arena_reset(Arena* arena) { arena->stats.used = 0; }
+
+void arena_begin_frame(Arena* arena) {
+    arena->stats.frame_peak             = arena->stats.used;
+    arena->stats.frame_allocation_count = 0;
+}
+
+void log_arena_stats(const Arena* arena) {
+    APP_INFO(
+        "Arena %s: %zu/%zu bytes used, %zu peak, %zu allocations",
+        arena->name,
+        arena->stats.used,
+        arena->capacity,
+        arena->stats.session_peak,
+        arena->stats.allocation_count
+    );
+}
+
+// Each size rounded up to the alignment, which covers the padding arena_alloc() adds in any order
+size_t get_arena_footprint(const size_t sizes[], size_t count, int alignment) {
+    size_t footprint = 0;
+    for (size_t i = 0; i < count; ++i) { footprint += align_size(sizes[i], (size_t)alignment); }
+    return footprint;
+}
+
+// A profile only records the peak of the build that wrote it, `minimum` covers what this build allocates at init
+size_t get_profiled_arena_capacity(const char* name, size_t fallback, size_t minimum) {
+    FILE* file = fopen(ARENA_PROFILE_PATH, "r");
+    if (file == nullptr) { return fallback; }
+
+    char   profile_name[ARENA_NAME_MAX_LENGTH];
+    size_t peak     = 0;
+    size_t capacity = fallback;
+
+    while (fscanf(file, "%31s %zu", profile_name, &peak) == 2) {
+        if (strcmp(profile_name, name) != 0) { continue; }
+
+        const size_t with_headroom = peak + (size_t)((float)peak * ARENA_PROFILE_HEADROOM);
+        capacity                   = align_size(with_headroom > 0 ? with_headroom : 1, ARENA_PROFILE_GRANULE);
+        break;
+    }
+
+    fclose(file);
+    return capacity > minimum ? capacity : minimum;
+}
+
+void save_arena_profile(const Arena* const arenas[], size_t count) {
+    FILE* file = fopen(ARENA_PROFILE_PATH, "w");
+    if (file == nullptr) {
+        APP_WARN("Could not write arena profile %s", ARENA_PROFILE_PATH);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) { fprintf(file, "%s %zu\n", arenas[i]->name, arenas[i]->stats.session_peak); }
+    fclose(file);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cute_defines.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ARENA_PROFILE_PATH "arena_profile.txt"
+
+constexpr float ARENA_PROFILE_HEADROOM = 0.25f;       // Extra room on top of a recorded peak
+constexpr int   ARENA_PROFILE_GRANULE  = CF_KB * 64;  // Profiled capacities are rounded up to this
+constexpr int   ARENA_NAME_MAX_LENGTH  = 32;
+constexpr int   ARENA_COMMIT_GRANULE   = CF_KB * 64;  // Pages are committed in steps of this size
+constexpr int   ARENA_HUGE_PAGE_SIZE   = CF_MB * 2;   // Commit step and base alignment with ARENA_FLAG_HUGE_PAGES
+
+typedef enum ArenaFlags {
+    ARENA_FLAG_NONE       = 0,
+    ARENA_FLAG_HUGE_PAGES = 1 << 0,  // Ask for transparent huge pages, for hot arrays that are walked every frame
+} ArenaFlags;
+
+typedef struct ArenaStats {
+    size_t used;
+    size_t committed;     // Pages backed by memory, never shrinks
+    size_t frame_peak;    // Highest `used` since the last arena_begin_frame()
+    size_t session_peak;  // Highest `used` since the arena was made
+    size_t allocation_count;
+    size_t frame_allocation_count;
+} ArenaStats;
+
+/*
+ * Arena
+ *
+ * Linear allocator over a reserved virtual address range. Reserving costs no memory, pages are committed as
+ * the cursor advances, so capacities can be generous. Platforms without virtual memory control fall back to a
+ * single heap block.
+ */
+typedef struct Arena {
+    uint8_t*   base;
+    void*      reservation;  // Start of the mapping, base may sit past it for huge page alignment
+    size_t     reserved;     // Size of the mapping, zero for heap backed arenas
+    size_t     capacity;     // Usable bytes from `base`
+    int        alignment;
+    ArenaFlags flags;
+    char       name[ARENA_NAME_MAX_LENGTH];  // Copied, so it outlives a hot reloaded game library
+    ArenaStats stats;
+} Arena;
+
+Arena  make_arena(const char* name, int alignment, size_t capacity, ArenaFlags flags);
+void   destroy_arena(Arena* arena);
+void*  arena_alloc(Arena* arena, size_t size);
+void*  arena_alloc_required(Arena* arena, size_t size);  // Init allocations a subsystem cannot run without
+void   arena_reset(Arena* arena);
+void   arena_begin_frame(Arena* arena);
+void   log_arena_stats(const Arena* arena);
+size_t get_arena_footprint(const size_t sizes[], size_t count, int alignment);  // Upper bound for these allocations
+size_t get_profiled_arena_capacity(const char* name, size_t fallback, size_t minimum);
+void   save_arena_profile(const Arena* const arenas[], size_t count);
@@ -0,0 +1,77 @@
+#include "fixed.h"
+
+#include <stdint.h>
+
+constexpr int FIXED_TABLE_STEPS = 64;  // Per quarter turn
+constexpr int FIXED_QUARTER     = 1 << 14;
+
+// sin() over the first quarter turn, 16.16
+static const Fixed s_sin_table[FIXED_TABLE_STEPS + 1] = {
+    0,     1608,  3216,  4821,  6424,  8022,  9616,  11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+    64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65536
+};
+
+// atan() of 0 to 1, as binary angles
+static const int32_t s_atan_table[FIXED_TABLE_STEPS + 1] = {
+    0,    163,  326,  489,  651,  813,  975,  1136,
+    1297, 1457, 1617, 1775, 1933, 2090, 2246, 2401,
+    2555, 2708, 2860, 3010, 3159, 3307, 3453, 3599,
+    3742, 3884, 4025, 4164, 4302, 4438, 4572, 4705,
+    4836, 4966, 5094, 5220, 5344, 5467, 5589, 5708,
+    5826, 5943, 6058, 6171, 6282, 6392, 6500, 6607,
+    6712, 6815, 6917, 7018, 7117, 7214, 7310, 7405,
+    7498, 7589, 7679, 7768, 7856, 7942, 8026, 8110,
+    8192
+};
+
+// `at` has 8 fraction bits past the table index
+static int32_t lerp_table(const int32_t table[static FIXED_TABLE_STEPS + 1], int32_t at) {
+    const int32_t index    = at >> 8;
+    const int32_t fraction = at & 0xFF;
+    if (index >= FIXED_TABLE_STEPS) { return table[FIXED_TABLE_STEPS]; }
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 8);
+}
+
+Fixed fixed_sin(FixedAngle angle) {
+    const int quadrant = angle / FIXED_QUARTER;
+    int32_t   within   = angle % FIXED_QUARTER;
+
+    // The second and fourth quarters mirror the first, the last two are negated
+    if (quadrant == 1 || quadrant == 3) { within = FIXED_QUARTER - within; }
+    const Fixed value = lerp_table(s_sin_table, within);
+    return quadrant >= 2 ? -value : value;
+}
+
+Fixed fixed_cos(FixedAngle angle) { return fixed_sin((FixedAngle)(angle + FIXED_QUARTER)); }
+
+FixedAngle fixed_atan2(Fixed y, Fixed x) {
+    if (x == 0 && y == 0) { return 0; }
+
+    const int64_t ax = x < 0 ? -(int64_t)x : x;
+    const int64_t ay = y < 0 ? -(int64_t)y : y;
+
+    // The first octant from the table, the others by symmetry
+    int32_t angle = 0;
+    if (ay <= ax) {
+        angle = lerp_table(s_atan_table, (int32_t)(ay * FIXED_TABLE_STEPS * 256 / ax));
+    } else {
+        angle = FIXED_QUARTER - lerp_table(s_atan_table, (int32_t)(ax * FIXED_TABLE_STEPS * 256 / ay));
+    }
+    if (x < 0) { angle = 2 * FIXED_QUARTER - angle; }
+    if (y < 0) { angle = -angle; }
+
+    return (FixedAngle)angle;
+}
+
+FixedAngle fixed_radians_to_angle(Fixed radians) {
+    return (FixedAngle)((int64_t)radians * 4 * FIXED_QUARTER / FIXED_TWO_PI);
+}
+
+Fixed fixed_angle_to_radians(FixedAngle angle) { return (Fixed)((int64_t)angle * FIXED_TWO_PI / (4 * FIXED_QUARTER)); }
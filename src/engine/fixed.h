@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cute_c_runtime.h>
+#include <stdint.h>
+
+typedef int32_t  Fixed;       // 16.16
+typedef uint16_t FixedAngle;  // Binary angle, a full turn is 65536 and wraps around by itself
+
+constexpr int   FIXED_FRACTION_BITS = 16;
+constexpr Fixed FIXED_ONE           = 1 << FIXED_FRACTION_BITS;
+constexpr Fixed FIXED_TWO_PI        = 411775;
+constexpr float FIXED_EXACT_LIMIT   = 256.0f;  // Magnitudes below it survive a round trip through float
+
+// Values under FIXED_EXACT_LIMIT in magnitude fit a float's 24-bit mantissa, so they go through float and back
+// unchanged. Scaling by FIXED_ONE is exact, the conversions round the same way on every compiler and architecture.
+// The simulation keeps its state in floats, anything larger would silently lose its low fraction bits.
+static inline Fixed fixed_from_float(float value) {
+#ifdef DEBUG
+    CF_ASSERT(value > -FIXED_EXACT_LIMIT && value < FIXED_EXACT_LIMIT);
+#endif
+    return (Fixed)(value * (float)FIXED_ONE);
+}
+static inline float fixed_to_float(Fixed value) { return (float)value / (float)FIXED_ONE; }
+
+static inline Fixed fixed_mul(Fixed a, Fixed b) { return (Fixed)(((int64_t)a * b) / FIXED_ONE); }
+static inline Fixed fixed_div(Fixed a, Fixed b) { return (Fixed)(((int64_t)a * FIXED_ONE) / b); }
+
+// Table lookups with linear interpolation, no libm involved
+Fixed      fixed_sin(FixedAngle angle);
+Fixed      fixed_cos(FixedAngle angle);
+FixedAngle fixed_atan2(Fixed y, Fixed x);
+FixedAngle fixed_radians_to_angle(Fixed radians);
+Fixed      fixed_angle_to_radians(FixedAngle angle);
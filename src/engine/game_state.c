@@ -1,22 +1,24 @@
+#define LOG_CATEGORY LOG_CATEGORY_STATE
+
 #include "game_state.h"
 
 #include "log.h"
 
-bool validate_game_state(void) {
-    if (g_state == nullptr) {
-        APP_WARN("g_state is null");
+bool validate_game_state(GameState* state) {
+    if (state == nullptr) {
+        APP_WARN("state is null");
         return false;
     }
-    if (g_state->platform == nullptr) {
-        APP_WARN("g_state->platform is null");
+    if (state->platform == nullptr) {
+        APP_WARN("state->platform is null");
         return false;
     }
-    if (g_state->canvas_size.x <= 0 || g_state->canvas_size.y <= 0) {
-        APP_WARN("g_state->canvas_size is invalid: (%.2f, %.2f)", g_state->canvas_size.x, g_state->canvas_size.y);
+    if (state->canvas_size.x <= 0 || state->canvas_size.y <= 0) {
+        APP_WARN("state->canvas_size is invalid: (%.2f, %.2f)", state->canvas_size.x, state->canvas_size.y);
         return false;
     }
-    if (g_state->scale <= 0) {
-        APP_WARN("g_state->scale is invalid: (%.2f)", g_state->scale);
+    if (state->scale <= 0) {
+        APP_WARN("state->scale is invalid: (%.2f)", state->scale);
         return false;
     }
     return true;
@@ -4,15 +4,14 @@
 #include <cute_app.h>
 #include <cute_audio.h>
 #include <cute_color.h>
-#include <cute_coroutine.h>
 #include <cute_draw.h>
 #include <cute_graphics.h>
 #include <cute_math.h>
-#include <cute_rnd.h>
 #include <cute_sprite.h>
 #include <stddef.h>
 
 #include "../game/asset/audio.h"
+#include "../game/asset/loader.h"
 #include "../game/asset/sprite.h"
 #include "../game/background_scroll.h"
 #include "../game/enemy.h"
@@ -20,37 +19,69 @@
 #include "../game/explosion_particle.h"
 #include "../game/floating_score.h"
 #include "../game/formation.h"
+#include "../game/gameplay_event.h"
+#include "../game/gfx.h"
 #include "../game/hit_particle.h"
+#include "../game/hud.h"
 #include "../game/player.h"
 #include "../game/player_bullet.h"
+#include "../game/render_queue.h"
+#include "../game/rewind.h"
+#include "../game/rnd_stream.h"
+#include "../game/rollback.h"
 #include "../game/screenshake.h"
-#include "../game/star_particle.h"
+#include "../game/snapshot.h"
+#include "../game/soak.h"
+#include "../game/spawner.h"
+#include "../game/star_field.h"
+#include "../game/text_cache.h"
+#include "../game/voice.h"
+#include "arena.h"
+#include "state_schema.h"
+
+constexpr uint32_t GAME_STATE_MAGIC = 0x32475052;  // "RPG2", changes along with the StateSchema layout
 
 typedef struct Platform Platform;
 
+/*
+ * Game State Header
+ *
+ * Always the first member of GameState and never changes, so any game library can tell which layout a state
+ * was written with.
+ */
+typedef struct GameStateHeader {
+    uint32_t     magic;
+    uint32_t     layout_version;  // StateSchema.version of the library that wrote the state
+    StateSchema* schema;          // Platform allocation, readable after the library that wrote it is unloaded
+} GameStateHeader;
+
 /*
  * Game State
  *
- * Should be validated with validate_game_state() before use
+ * Should be validated with validate_game_state() before use. Fields added here also go into the schema in
+ * src/game/state_layout.c, so hot reloads can migrate them.
  */
 typedef struct GameState {
+    GameStateHeader header;  // Must stay first
+
     Platform*    platform;
     CF_V2        canvas_size;
     float        scale;  // For resolution independence
-    CF_Arena     permanent_arena;
-    CF_Arena     stage_arena;
-    CF_Arena     scratch_arena;
+    Arena        permanent_arena;
+    Arena        stage_arena;
+    Arena        scratch_arena;
     CF_DisplayID display_id;
-    CF_Rnd       rnd;
+    RndStreams   rnd;
     int          score;
     int          lives;
 
     CF_Canvas canvas;
-    CF_Shader recolor;
 
     BackgroundScroll background_scroll;
+    StarField        star_field;
 
-    Player        player;
+    Player        players[MAX_PLAYERS];
+    size_t        players_count;
     PlayerBullet* player_bullets;
     size_t        player_bullets_count;
     size_t        player_bullets_capacity;
@@ -75,39 +106,52 @@ typedef struct GameState {
     size_t             explosion_particles_count;
     size_t             explosion_particles_capacity;
 
-    StarParticle* star_particles;
-    size_t        star_particles_count;
-    size_t        star_particles_capacity;
-
     FloatingScore* floating_scores;
     size_t         floating_scores_count;
     size_t         floating_scores_capacity;
 
-    ScreenShake screenshake;
-    CF_Audio    audio_assets[AUDIO_COUNT];
-    CF_Sprite   sprite_assets[SPRITE_COUNT];
+    GameplayEvents events;  // Emitted during a tick, consumed after collision
 
-    struct {
-        CF_Coroutine spawner;
-        bool         initialized;
-    } coroutines;
+    Gfx          gfx;
+    ScreenShake  screenshake;
+    TextCache    text_cache;
+    Hud          hud;
+    RenderQueue  render_queue;
+    AssetLoader  asset_loader;
+    VoiceManager voices;
+    CF_Sprite    sprite_assets[SPRITE_COUNT];
 
     struct {
         CF_Sprite particle;
+        CF_Sprite explosion_palette[EXPLOSION_PALETTE_SIZE];
     } sprites;
 
+    struct {
+        AssetHandle handles[AUDIO_COUNT];
+        Audio       queued_music;
+        bool        has_queued_music;
+        AudioStats  stats;
+    } audio;
+
     // Wave system
     struct {
         int   current_wave;
         float announcement_timer;
         bool  is_announcing;
     } wave;
+    Spawner spawner;
 
+    RollbackSession rollback;  // Co-op against a loopback peer
+    SoakTest        soak;      // A bot plays headless, started by the platform
+
+    SnapshotStats snapshot;  // Last save and load, shown in the debug pane
+    RewindBuffer  rewind;    // Debug builds only
+
+    bool is_headless;  // From the platform at init, nothing touches audio, input or the GPU
+    bool is_loading;   // Waiting for required assets before gameplay starts
     bool is_game_over;
     bool debug;  // Enable ImGUI debug pane
     bool debug_bounding_boxes;
 } GameState;
 
-extern GameState* g_state;
-
-bool validate_game_state(void);
+bool validate_game_state(GameState* state);
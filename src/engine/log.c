@@ -0,0 +1,410 @@
+#include "log.h"
+
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
+#include <assert.h>
+#include <cute_multithreading.h>
+#include <cute_time.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr int LOG_RING_CAPACITY = 4096;  // Records, a power of two
+constexpr int LOG_MAX_ARGS      = 12;    // Conversions past this are printed as written
+constexpr int LOG_STRING_BYTES  = 160;   // Copied %s arguments of a record, cut short past this
+constexpr int LOG_LINE_BYTES    = 1024;
+constexpr int LOG_SPEC_BYTES    = 32;
+constexpr int LOG_IDLE_SLEEP_MS = 1;  // Between polls of an empty ring
+constexpr int LOG_CACHE_LINE    = 64;
+
+static_assert((LOG_RING_CAPACITY & (LOG_RING_CAPACITY - 1)) == 0, "LOG_RING_CAPACITY must be a power of two");
+
+typedef union LogArg {
+    long long          i;
+    unsigned long long u;
+    double             f;
+    const void*        p;
+    size_t             string;  // Offset into LogRecord.strings
+} LogArg;
+
+typedef struct LogRecord {
+    const char* format;
+    uint64_t    timestamp_ns;
+    uint8_t     level;
+    uint8_t     category;
+    uint8_t     arg_count;
+    LogArg      args[LOG_MAX_ARGS];
+    char        strings[LOG_STRING_BYTES];
+} LogRecord;
+
+// `sequence` equals the slot's next write position while it is free and that position + 1 once written
+typedef struct LogSlot {
+    CF_AtomicInt sequence;
+    LogRecord    record;
+} LogSlot;
+
+/*
+ * Log Ring
+ *
+ * Bounded multi-producer queue: a producer claims a position with a compare and swap on `write` and publishes the
+ * slot through its sequence, the log thread is the only consumer. A full ring drops the record and counts it, the
+ * calling thread never waits. Positions wrap around as ints, they are only ever compared by difference.
+ */
+struct LogRing {
+    LogSlot slots[LOG_RING_CAPACITY];
+
+    // On their own cache lines, producers and the log thread would otherwise keep stealing them from each other
+    alignas(LOG_CACHE_LINE) CF_AtomicInt write;
+    alignas(LOG_CACHE_LINE) CF_AtomicInt read;
+    CF_AtomicInt                         dropped;
+    CF_AtomicInt                         is_running;
+    CF_Thread*                           thread;
+};
+
+typedef struct LogSpec {
+    const char* end;         // Past the conversion character
+    int         stars;       // Width and precision given as int arguments, 0 to 2
+    char        length[3];   // hh, h, l, ll, z, j, t or L
+    char        conversion;  // 0 when the spec is not one write_log() understands
+} LogSpec;
+
+// Only the binary that started the thread owns the storage, the game library is handed a pointer to it
+static LogRing  s_log_ring;
+static LogRing* s_ring;
+
+static const char* const s_category_names[LOG_CATEGORY_COUNT] = {"game", "platform", "memory", "state", "assets"};
+
+static const SDL_LogPriority s_priorities[] = {
+    SDL_LOG_PRIORITY_TRACE,
+    SDL_LOG_PRIORITY_DEBUG,
+    SDL_LOG_PRIORITY_INFO,
+    SDL_LOG_PRIORITY_WARN,
+    SDL_LOG_PRIORITY_ERROR,
+    SDL_LOG_PRIORITY_CRITICAL,
+};
+
+static int wrap_add(int a, int b) { return (int)((unsigned)a + (unsigned)b); }
+static int wrap_diff(int a, int b) { return (int)((unsigned)a - (unsigned)b); }
+
+static bool is_flag(char c) { return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0'; }
+static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+// `at` points past the '%'
+static LogSpec parse_log_spec(const char* at) {
+    LogSpec spec = {0};
+
+    while (is_flag(*at)) { at++; }
+    if (*at == '*') {
+        spec.stars++;
+        at++;
+    }
+    while (is_digit(*at)) { at++; }
+    if (*at == '.') {
+        at++;
+        if (*at == '*') {
+            spec.stars++;
+            at++;
+        }
+        while (is_digit(*at)) { at++; }
+    }
+
+    int length = 0;
+    while (length < 2 && (*at == 'h' || *at == 'l' || *at == 'z' || *at == 'j' || *at == 't' || *at == 'L')) {
+        spec.length[length++] = *at++;
+    }
+
+    if (*at != '\0' && SDL_strchr("diuxXocspfFeEgGaA%", *at) != nullptr) { spec.conversion = *at; }
+
+    spec.end = *at != '\0' ? at + 1 : at;
+    return spec;
+}
+
+// `length` is one or two characters, compared in place since this runs on the calling thread
+static bool has_length(const LogSpec* spec, const char* length) {
+    return spec->length[0] == length[0] && spec->length[1] == length[1];
+}
+
+static long long read_signed(const LogSpec* spec, va_list* args) {
+    if (has_length(spec, "hh")) { return (signed char)va_arg(*args, int); }
+    if (has_length(spec, "h")) { return (short)va_arg(*args, int); }
+    if (has_length(spec, "l")) { return va_arg(*args, long); }
+    if (has_length(spec, "ll")) { return va_arg(*args, long long); }
+    if (has_length(spec, "z") || has_length(spec, "t")) { return va_arg(*args, ptrdiff_t); }
+    if (has_length(spec, "j")) { return va_arg(*args, intmax_t); }
+    return va_arg(*args, int);
+}
+
+static unsigned long long read_unsigned(const LogSpec* spec, va_list* args) {
+    if (has_length(spec, "hh")) { return (unsigned char)va_arg(*args, unsigned); }
+    if (has_length(spec, "h")) { return (unsigned short)va_arg(*args, unsigned); }
+    if (has_length(spec, "l")) { return va_arg(*args, unsigned long); }
+    if (has_length(spec, "ll")) { return va_arg(*args, unsigned long long); }
+    if (has_length(spec, "z") || has_length(spec, "t")) { return va_arg(*args, size_t); }
+    if (has_length(spec, "j")) { return va_arg(*args, uintmax_t); }
+    return va_arg(*args, unsigned);
+}
+
+// Reads the arguments the way printf would, so each one is taken with the type it was passed as
+static void capture_args(LogRecord* record, const char* format, va_list* args) {
+    size_t strings_used = 0;
+    record->arg_count   = 0;
+
+    for (const char* at = format; *at != '\0';) {
+        if (*at++ != '%') { continue; }
+
+        const LogSpec spec = parse_log_spec(at);
+        at                 = spec.end;
+        if (spec.conversion == '%') { continue; }
+        if (spec.conversion == 0 || record->arg_count + spec.stars + 1 > LOG_MAX_ARGS) { return; }
+
+        for (int i = 0; i < spec.stars; ++i) { record->args[record->arg_count++].i = va_arg(*args, int); }
+
+        LogArg* arg = &record->args[record->arg_count++];
+        switch (spec.conversion) {
+            case 'd':
+            case 'i':
+                arg->i = read_signed(&spec, args);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                arg->u = read_unsigned(&spec, args);
+                break;
+            case 'c':
+                arg->i = va_arg(*args, int);
+                break;
+            case 'p':
+                arg->p = va_arg(*args, const void*);
+                break;
+            case 's': {
+                const char* string = va_arg(*args, const char*);
+                if (string == nullptr) { string = "(null)"; }
+
+                // Once full, later strings point at the terminator of the last one and print empty
+                arg->string = strings_used;
+                while (*string != '\0' && strings_used < LOG_STRING_BYTES - 1) {
+                    record->strings[strings_used++] = *string++;
+                }
+                record->strings[strings_used] = '\0';
+                if (strings_used < LOG_STRING_BYTES - 1) { strings_used++; }
+                break;
+            }
+            default:
+                // Long doubles are printed at double precision
+                arg->f = has_length(&spec, "L") ? (double)va_arg(*args, long double) : va_arg(*args, double);
+                break;
+        }
+    }
+}
+
+// Rebuilds one spec with its stars filled in and every integer widened to long long
+static void build_spec(const char* start, const LogSpec* spec, const LogArg* stars, char out[static LOG_SPEC_BYTES]) {
+    int used = 0;
+    int star = 0;
+    for (const char* at = start; at < spec->end - 1 - SDL_strlen(spec->length) && used < LOG_SPEC_BYTES - 8; ++at) {
+        if (*at == '*') {
+            used += SDL_snprintf(out + used, LOG_SPEC_BYTES - used, "%d", (int)stars[star++].i);
+        } else {
+            out[used++] = *at;
+        }
+    }
+
+    if (SDL_strchr("diuxXo", spec->conversion) != nullptr) {
+        out[used++] = 'l';
+        out[used++] = 'l';
+    }
+    out[used++] = spec->conversion;
+    out[used]   = '\0';
+}
+
+static void format_log_record(const LogRecord* record, char line[static LOG_LINE_BYTES]) {
+    size_t used = 0;
+    int    next = 0;
+
+    for (const char* at = record->format; *at != '\0' && used < LOG_LINE_BYTES - 1;) {
+        if (*at != '%') {
+            line[used++] = *at++;
+            continue;
+        }
+
+        const char*   start = at;
+        const LogSpec spec  = parse_log_spec(at + 1);
+        at                  = spec.end;
+
+        if (spec.conversion == '%') {
+            line[used++] = '%';
+            continue;
+        }
+        if (spec.conversion == 0 || next + spec.stars + 1 > record->arg_count) {
+            // Not captured, shown as written
+            while (start < at && used < LOG_LINE_BYTES - 1) { line[used++] = *start++; }
+            continue;
+        }
+
+        char spec_text[LOG_SPEC_BYTES];
+        build_spec(start, &spec, &record->args[next], spec_text);
+        next += spec.stars;
+
+        const LogArg arg       = record->args[next++];
+        const size_t remaining = LOG_LINE_BYTES - used;
+        int          written   = 0;
+        switch (spec.conversion) {
+            case 'd':
+            case 'i':
+                written = SDL_snprintf(line + used, remaining, spec_text, arg.i);
+                break;
+            case 'c':
+                written = SDL_snprintf(line + used, remaining, spec_text, (int)arg.i);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                written = SDL_snprintf(line + used, remaining, spec_text, arg.u);
+                break;
+            case 'p':
+                written = SDL_snprintf(line + used, remaining, spec_text, arg.p);
+                break;
+            case 's':
+                written = SDL_snprintf(line + used, remaining, spec_text, record->strings + arg.string);
+                break;
+            default:
+                written = SDL_snprintf(line + used, remaining, spec_text, arg.f);
+                break;
+        }
+        if (written > 0) { used = SDL_min(used + (size_t)written, LOG_LINE_BYTES - 1); }
+    }
+
+    line[used] = '\0';
+}
+
+static void print_log_line(LogLevel level, LogCategory category, uint64_t timestamp_ns, const char* line) {
+    SDL_LogMessage(
+        SDL_LOG_CATEGORY_CUSTOM,
+        s_priorities[level],
+        "%10.6f %s: %s",
+        (double)timestamp_ns / 1e9,
+        s_category_names[category],
+        line
+    );
+}
+
+static bool drain_log_ring(LogRing* ring) {
+    bool is_drained_any = false;
+
+    for (;;) {
+        const int read = cf_atomic_get(&ring->read);
+        LogSlot*  slot = &ring->slots[read & (LOG_RING_CAPACITY - 1)];
+        if (cf_atomic_get(&slot->sequence) != wrap_add(read, 1)) { break; }
+
+        char line[LOG_LINE_BYTES];
+        format_log_record(&slot->record, line);
+        print_log_line(slot->record.level, slot->record.category, slot->record.timestamp_ns, line);
+
+        cf_atomic_set(&slot->sequence, wrap_add(read, LOG_RING_CAPACITY));
+        cf_atomic_set(&ring->read, wrap_add(read, 1));
+        is_drained_any = true;
+    }
+
+    const int dropped = cf_atomic_set(&ring->dropped, 0);
+    if (dropped > 0) {
+        char line[LOG_LINE_BYTES];
+        SDL_snprintf(line, sizeof(line), "%d records dropped, the ring was full", dropped);
+        print_log_line(LOG_LEVEL_WARN, LOG_CATEGORY_PLATFORM, SDL_GetTicksNS(), line);
+    }
+
+    return is_drained_any;
+}
+
+static int run_log_thread(void* udata) {
+    LogRing* ring = udata;
+    while (cf_atomic_get(&ring->is_running)) {
+        if (!drain_log_ring(ring)) { cf_sleep(LOG_IDLE_SLEEP_MS); }
+    }
+    drain_log_ring(ring);
+    return 0;
+}
+
+static void write_log_now(LogLevel level, LogCategory category, const char* format, va_list args) {
+    char line[LOG_LINE_BYTES];
+    SDL_vsnprintf(line, sizeof(line), format, args);
+    print_log_line(level, category, SDL_GetTicksNS(), line);
+}
+
+void write_log(LogLevel level, LogCategory category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    LogRing* ring = s_ring;
+    if (ring == nullptr || level == LOG_LEVEL_FATAL) {
+        // Everything queued before it goes out first
+        flush_log();
+        write_log_now(level, category, format, args);
+        va_end(args);
+        return;
+    }
+
+    // Claim the next free slot, or give up if the log thread is a whole ring behind
+    int      write = cf_atomic_get(&ring->write);
+    LogSlot* slot  = nullptr;
+    for (;;) {
+        slot           = &ring->slots[write & (LOG_RING_CAPACITY - 1)];
+        const int diff = wrap_diff(cf_atomic_get(&slot->sequence), write);
+        if (diff == 0 && cf_atomic_cas(&ring->write, write, wrap_add(write, 1))) { break; }
+        if (diff < 0) {
+            cf_atomic_add(&ring->dropped, 1);
+            va_end(args);
+            return;
+        }
+        write = cf_atomic_get(&ring->write);
+    }
+
+    LogRecord* record    = &slot->record;
+    record->format       = format;
+    record->timestamp_ns = SDL_GetTicksNS();
+    record->level        = (uint8_t)level;
+    record->category     = (uint8_t)category;
+    capture_args(record, format, &args);
+    va_end(args);
+
+    cf_atomic_set(&slot->sequence, wrap_add(write, 1));
+}
+
+void flush_log(void) {
+    LogRing* ring = s_ring;
+    if (ring == nullptr) { return; }
+
+    const int write = cf_atomic_get(&ring->write);
+    while (wrap_diff(cf_atomic_get(&ring->read), write) < 0) { cf_sleep(LOG_IDLE_SLEEP_MS); }
+}
+
+LogRing* get_log_ring(void) { return s_ring; }
+
+void set_log_ring(LogRing* ring) { s_ring = ring; }
+
+void start_log_thread(void) {
+    LogRing* ring = &s_log_ring;
+    for (int i = 0; i < LOG_RING_CAPACITY; ++i) { cf_atomic_set(&ring->slots[i].sequence, i); }
+    cf_atomic_set(&ring->write, 0);
+    cf_atomic_set(&ring->read, 0);
+    cf_atomic_set(&ring->dropped, 0);
+    cf_atomic_set(&ring->is_running, 1);
+
+    // Without threads, as on the web, logs stay on the calling thread
+    ring->thread = cf_thread_create(run_log_thread, "log", ring);
+    if (ring->thread == nullptr) { return; }
+    s_ring = ring;
+}
+
+void stop_log_thread(void) {
+    LogRing* ring = s_ring;
+    if (ring == nullptr) { return; }
+
+    // Later logs from this binary are printed on the calling thread
+    s_ring = nullptr;
+    cf_atomic_set(&ring->is_running, 0);
+    cf_thread_wait(ring->thread);
+    ring->thread = nullptr;
+}
@@ -1,21 +1,97 @@
 #pragma once
 
 #include <SDL3/SDL_log.h>
+#include <stdint.h>
 
-#ifndef APP_DEACTIVATE_LOGGING
+typedef enum LogLevel {
+    LOG_LEVEL_TRACE = 0,
+    LOG_LEVEL_DEBUG = 1,
+    LOG_LEVEL_INFO  = 2,
+    LOG_LEVEL_WARN  = 3,
+    LOG_LEVEL_ERROR = 4,
+    LOG_LEVEL_FATAL = 5,  // Written out before the call returns, the process is usually about to stop
+} LogLevel;
+
+typedef enum LogCategory {
+    LOG_CATEGORY_GAME,
+    LOG_CATEGORY_PLATFORM,  // Host executable: app startup, library loading and watching
+    LOG_CATEGORY_MEMORY,    // Arenas and the allocation tracker
+    LOG_CATEGORY_STATE,     // Game state layout, snapshots, rewind and rollback
+    LOG_CATEGORY_ASSETS,
+    LOG_CATEGORY_COUNT,
+} LogCategory;
 
+// Levels below this compile to nothing, arguments included. Numeric, so the preprocessor can compare it.
+#ifndef LOG_MIN_LEVEL
     #if DEBUG
-        #define APP_TRACE(...) SDL_LogTrace(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__)
-        #define APP_DEBUG(...) SDL_LogDebug(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__)
+        #define LOG_MIN_LEVEL 0  // LOG_LEVEL_TRACE
+    #else
+        #define LOG_MIN_LEVEL 2  // LOG_LEVEL_INFO
+    #endif
+#endif
+
+// Bit per LogCategory, calls in a masked out category are constant false and compiled out
+#ifndef LOG_CATEGORY_MASK
+    #define LOG_CATEGORY_MASK 0xFFFFFFFFu
+#endif
+
+// A translation unit picks its category by defining LOG_CATEGORY before any include
+#ifndef LOG_CATEGORY
+    #define LOG_CATEGORY LOG_CATEGORY_GAME
+#endif
+
+typedef struct LogRing LogRing;
+
+/*
+ * Log
+ *
+ * write_log() copies the format pointer, a timestamp and the arguments into a lock-free ring and returns, a thread
+ * started by the platform formats and prints the records. Strings are copied, so buffers may be reused right after
+ * the call. Format pointers are not, the platform flushes before unloading the library they point into. Until a
+ * binary is handed the ring with set_log_ring(), its logs are formatted and printed on the calling thread.
+ */
+void write_log(LogLevel level, LogCategory category, SDL_PRINTF_FORMAT_STRING const char* format, ...)
+    SDL_PRINTF_VARARG_FUNC(3);
+
+void     flush_log(void);
+LogRing* get_log_ring(void);
+void     set_log_ring(LogRing* ring);
+void     start_log_thread(void);
+void     stop_log_thread(void);
+
+#ifndef APP_DEACTIVATE_LOGGING
+
+    #define APP_LOG(level, ...)                                                                             \
+        do {                                                                                                \
+            if (LOG_CATEGORY_MASK & (1u << LOG_CATEGORY)) { write_log((level), LOG_CATEGORY, __VA_ARGS__); } \
+        } while (0)
+
+    #if LOG_MIN_LEVEL <= 0
+        #define APP_TRACE(...) APP_LOG(LOG_LEVEL_TRACE, __VA_ARGS__)
     #else
         #define APP_TRACE(...)
+    #endif
+
+    #if LOG_MIN_LEVEL <= 1
+        #define APP_DEBUG(...) APP_LOG(LOG_LEVEL_DEBUG, __VA_ARGS__)
+    #else
         #define APP_DEBUG(...)
     #endif
 
-    #define APP_INFO(...)  SDL_LogInfo(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__)
-    #define APP_WARN(...)  SDL_LogWarn(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__)
-    #define APP_ERROR(...) SDL_LogError(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__)
-    #define APP_FATAL(...) SDL_LogCritical(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__)
+    #if LOG_MIN_LEVEL <= 2
+        #define APP_INFO(...) APP_LOG(LOG_LEVEL_INFO, __VA_ARGS__)
+    #else
+        #define APP_INFO(...)
+    #endif
+
+    #if LOG_MIN_LEVEL <= 3
+        #define APP_WARN(...) APP_LOG(LOG_LEVEL_WARN, __VA_ARGS__)
+    #else
+        #define APP_WARN(...)
+    #endif
+
+    #define APP_ERROR(...) APP_LOG(LOG_LEVEL_ERROR, __VA_ARGS__)
+    #define APP_FATAL(...) APP_LOG(LOG_LEVEL_FATAL, __VA_ARGS__)
 
 #else
 
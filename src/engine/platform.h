@@ -1,8 +1,70 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
+
+constexpr int ALLOCATION_WARMUP_FRAMES = 180;  // Frames after start or loading before the guard reports
+
+typedef enum AllocationTag {
+    ALLOCATION_TAG_UNTAGGED,    // Outside any scope, e.g. cute's own startup or worker threads
+    ALLOCATION_TAG_GAME_STATE,  // Platform.allocate_memory
+    ALLOCATION_TAG_UPDATE,      // Anything under game_update()
+    ALLOCATION_TAG_RENDER,      // Anything under game_render()
+    ALLOCATION_TAG_AUDIO,
+    ALLOCATION_TAG_GFX,
+    ALLOCATION_TAG_TEXT,
+    ALLOCATION_TAG_ASSETS,
+    ALLOCATION_TAG_DEBUG,  // ImGui and other debug tooling, never reported by the guard
+    ALLOCATION_TAG_COUNT,
+} AllocationTag;
+
+typedef struct AllocationCounts {
+    size_t count[ALLOCATION_TAG_COUNT];
+    size_t bytes[ALLOCATION_TAG_COUNT];
+    size_t frees;
+} AllocationCounts;
+
+/*
+ * Allocation Tracker
+ *
+ * Owned by the platform, so it survives game library reloads. Every heap allocation made through cute or
+ * Platform.allocate_memory is counted under the innermost tag pushed on the allocating thread.
+ */
+typedef struct AllocationTracker {
+    AllocationCounts last_frame;
+    AllocationCounts total;
+    uint64_t         frame;
+    int              warmup_frames;  // Frames left before the guard reports, the game rearms it after loading
+    bool             guard;          // Report allocations inside game_update()/game_render() with their callsite
+    size_t           guard_reports;
+} AllocationTracker;
+
+typedef struct LogRing LogRing;
 
 typedef struct Platform {
     void* (*allocate_memory)(size_t size);
     void (*free_memory)(void* p);
+    void (*push_allocation_tag)(AllocationTag tag);
+    void (*pop_allocation_tag)(void);
+    AllocationTracker* allocations;
+    LogRing*           log_ring;      // Handed to the game library, so its logs go through the platform's log thread
+    bool               is_soak_test;        // A bot plays instead of reading input
+    bool               is_recording_draws;  // Draws are recorded by gfx and never reach the GPU
+    bool               is_headless;         // No audio, input, window or GPU work, draws are only recorded
 } Platform;
+
+static inline const char* get_allocation_tag_name(AllocationTag tag) {
+    switch (tag) {
+        case ALLOCATION_TAG_UNTAGGED:   return "untagged";
+        case ALLOCATION_TAG_GAME_STATE: return "game state";
+        case ALLOCATION_TAG_UPDATE:     return "update";
+        case ALLOCATION_TAG_RENDER:     return "render";
+        case ALLOCATION_TAG_AUDIO:      return "audio";
+        case ALLOCATION_TAG_GFX:        return "gfx";
+        case ALLOCATION_TAG_TEXT:       return "text";
+        case ALLOCATION_TAG_ASSETS:     return "assets";
+        case ALLOCATION_TAG_DEBUG:      return "debug";
+        case ALLOCATION_TAG_COUNT:      break;
+    }
+    return "unknown";
+}
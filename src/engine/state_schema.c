@@ -0,0 +1,294 @@
+#define LOG_CATEGORY LOG_CATEGORY_STATE
+
+#include "state_schema.h"
+
+#include <cute_c_runtime.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "arena.h"
+#include "log.h"
+
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME        = 16777619u;
+constexpr int      SCHEMA_MAX_GAP   = 8;  // Unlisted bytes beyond this are a field missing from the schema
+
+static uint32_t hash_bytes(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for (size_t i = 0; i < size; ++i) { hash = (hash ^ bytes[i]) * FNV_PRIME; }
+    return hash;
+}
+
+void init_state_schema(StateSchema* schema) {
+    // Zeroed, so the unused tails of the name buffers hash the same in every build
+    memset(schema, 0, sizeof(*schema));
+}
+
+void add_schema_struct(
+    StateSchema* schema, const char* name, size_t size, const FieldSchema* fields, size_t field_count
+) {
+    CF_ASSERT(schema->struct_count < SCHEMA_MAX_STRUCTS);
+    CF_ASSERT(schema->field_count + field_count <= SCHEMA_MAX_FIELDS);
+    CF_ASSERT(strlen(name) < SCHEMA_NAME_SIZE);
+
+    auto layout = &schema->structs[schema->struct_count++];
+    strncpy(layout->name, name, SCHEMA_NAME_SIZE - 1);
+    layout->size        = (uint32_t)size;
+    layout->first_field = schema->field_count;
+    layout->field_count = (uint32_t)field_count;
+
+    memcpy(&schema->fields[schema->field_count], fields, field_count * sizeof(FieldSchema));
+    schema->field_count += (uint32_t)field_count;
+}
+
+#ifdef DEBUG
+static void mark_covered(uint8_t* covered, uint32_t offset, uint32_t size) { memset(covered + offset, 1, size); }
+
+// Catches fields added to a struct but not to its schema, which would silently be dropped by a migration
+static void check_schema_coverage(const StateSchema* schema) {
+    for (uint32_t s = 0; s < schema->struct_count; ++s) {
+        auto     layout  = &schema->structs[s];
+        uint8_t* covered = cf_calloc(layout->size, 1);
+
+        for (uint32_t f = 0; f < layout->field_count; ++f) {
+            auto field = &schema->fields[layout->first_field + f];
+            mark_covered(covered, field->offset, field->size);
+            if (field->kind == FIELD_KIND_ENTITY_ARRAY) {
+                mark_covered(covered, field->count_offset, sizeof(size_t));
+                mark_covered(covered, field->capacity_offset, sizeof(size_t));
+            }
+        }
+
+        uint32_t gap = 0;
+        for (uint32_t i = 0; i <= layout->size; ++i) {
+            if (i < layout->size && !covered[i]) {
+                gap++;
+                continue;
+            }
+            if (gap >= SCHEMA_MAX_GAP) {
+                APP_WARN("Schema for %s misses %u bytes at offset %u", layout->name, gap, i - gap);
+            }
+            gap = 0;
+        }
+
+        cf_free(covered);
+    }
+}
+#endif
+
+// Covers nested structs by their layout rather than their index, which depends on the order they were added in
+static uint32_t hash_struct_layout(const StateSchema* schema, uint32_t index) {
+    auto     layout = &schema->structs[index];
+    uint32_t hash   = hash_bytes(FNV_OFFSET_BASIS, layout->name, sizeof(layout->name));
+    hash            = hash_bytes(hash, &layout->size, sizeof(layout->size));
+
+    for (uint32_t f = 0; f < layout->field_count; ++f) {
+        auto field = &schema->fields[layout->first_field + f];
+        hash       = hash_bytes(hash, field, offsetof(FieldSchema, struct_index));
+        hash       = hash_bytes(hash, &field->count_offset, sizeof(*field) - offsetof(FieldSchema, count_offset));
+        if (field->struct_index >= 0) {
+            const uint32_t nested = hash_struct_layout(schema, (uint32_t)field->struct_index);
+            hash                  = hash_bytes(hash, &nested, sizeof(nested));
+        }
+    }
+    return hash;
+}
+
+void finish_state_schema(StateSchema* schema) {
+    for (uint32_t s = 0; s < schema->struct_count; ++s) { schema->structs[s].layout = hash_struct_layout(schema, s); }
+    schema->version = hash_bytes(FNV_OFFSET_BASIS, &schema->struct_count, sizeof(*schema) - sizeof(schema->version));
+#ifdef DEBUG
+    check_schema_coverage(schema);
+#endif
+}
+
+static const FieldSchema* find_field(const StateSchema* schema, const StructSchema* layout, const char* name) {
+    for (uint32_t i = 0; i < layout->field_count; ++i) {
+        auto field = &schema->fields[layout->first_field + i];
+        if (strcmp(field->name, name) == 0) { return field; }
+    }
+    return nullptr;
+}
+
+const void* find_state_field(const StateSchema* schema, const void* state, const char* name) {
+    const FieldSchema* field = find_field(schema, &schema->structs[0], name);
+    return field ? (const uint8_t*)state + field->offset : nullptr;
+}
+
+const void* find_matching_state_field(
+    const StateSchema* schema, const StateSchema* from, const void* state, const char* name
+) {
+    const FieldSchema* field     = find_field(schema, &schema->structs[0], name);
+    const FieldSchema* old_field = find_field(from, &from->structs[0], name);
+    if (field == nullptr || old_field == nullptr) { return nullptr; }
+    if (field->kind != old_field->kind || field->size != old_field->size || strcmp(field->type, old_field->type) != 0) {
+        return nullptr;
+    }
+
+    const bool is_nested = field->struct_index >= 0 && old_field->struct_index >= 0;
+    if (is_nested && schema->structs[field->struct_index].layout != from->structs[old_field->struct_index].layout) {
+        return nullptr;
+    }
+    return (const uint8_t*)state + old_field->offset;
+}
+
+typedef struct MigrationContext {
+    const StateSchema* to;
+    const StateSchema* from;
+    Arena*             storage;
+    SchemaMigration    result;
+    bool               is_counting;  // Off past the first element of an array, so changes count once per field
+} MigrationContext;
+
+static void fail_migration(MigrationContext* context, const FieldSchema* field) {
+    if (!context->result.ok) { return; }
+    context->result.ok = false;
+    strncpy(context->result.failed_field, field->name, SCHEMA_NAME_SIZE - 1);
+}
+
+static void migrate_struct(
+    MigrationContext* context, int32_t to_index, void* destination, int32_t from_index, const void* source
+);
+
+static void migrate_entity_array(
+    MigrationContext* context, const FieldSchema* field, const FieldSchema* old_field, uint8_t* dst, const uint8_t* src
+) {
+    const size_t   element_size = context->to->structs[field->struct_index].size;
+    const size_t   old_size     = context->from->structs[old_field->struct_index].size;
+    const uint8_t* old_items    = *(uint8_t* const*)(src + old_field->offset);
+    const size_t   old_count    = *(const size_t*)(src + old_field->count_offset);
+
+    uint8_t* items = arena_alloc(context->storage, field->capacity * element_size);
+    if (items == nullptr) {
+        fail_migration(context, field);
+        return;
+    }
+    memset(items, 0, field->capacity * element_size);
+
+    const size_t count       = old_count < field->capacity ? old_count : field->capacity;
+    const bool   is_counting = context->is_counting;
+    for (size_t i = 0; i < count; ++i) {
+        migrate_struct(
+            context, field->struct_index, items + i * element_size, old_field->struct_index, old_items + i * old_size
+        );
+        context->is_counting = false;
+    }
+    context->is_counting = is_counting;
+    context->result.dropped_elements += old_count - count;
+
+    *(uint8_t**)(dst + field->offset)        = items;
+    *(size_t*)(dst + field->count_offset)    = count;
+    *(size_t*)(dst + field->capacity_offset) = field->capacity;
+}
+
+static void migrate_data(
+    MigrationContext* context, const FieldSchema* field, const FieldSchema* old_field, uint8_t* dst, const uint8_t* src
+) {
+    if (old_field->size == field->size) {
+        memcpy(dst + field->offset, src + old_field->offset, field->size);
+        return;
+    }
+
+    // Only an array of scalars keeps its meaning up to the shorter length, anything else of another size is retyped
+    if (!(field->flags & old_field->flags & FIELD_FLAG_ARRAY)) {
+        context->result.retyped += context->is_counting;
+        if (field->flags & FIELD_FLAG_REQUIRED) { fail_migration(context, field); }
+        return;
+    }
+
+    context->result.resized += context->is_counting;
+    if (field->flags & FIELD_FLAG_REQUIRED) { fail_migration(context, field); }
+    const uint32_t size = old_field->size < field->size ? old_field->size : field->size;
+    memcpy(dst + field->offset, src + old_field->offset, size);
+}
+
+static void migrate_nested_structs(
+    MigrationContext* context, const FieldSchema* field, const FieldSchema* old_field, uint8_t* dst, const uint8_t* src
+) {
+    const StructSchema* layout     = &context->to->structs[field->struct_index];
+    const StructSchema* old_layout = &context->from->structs[old_field->struct_index];
+
+    if (layout->layout == old_layout->layout && field->size == old_field->size) {
+        memcpy(dst + field->offset, src + old_field->offset, field->size);
+        return;
+    }
+
+    // Resources of a required subsystem were set up for its exact layout
+    if (field->flags & FIELD_FLAG_REQUIRED) {
+        fail_migration(context, field);
+        return;
+    }
+
+    const uint32_t count     = field->size / layout->size;
+    const uint32_t old_count = old_field->size / old_layout->size;
+    if (count != old_count) { context->result.resized += context->is_counting; }
+
+    const bool is_counting = context->is_counting;
+    for (uint32_t i = 0; i < count && i < old_count; ++i) {
+        migrate_struct(
+            context,
+            field->struct_index,
+            dst + field->offset + i * layout->size,
+            old_field->struct_index,
+            src + old_field->offset + i * old_layout->size
+        );
+        context->is_counting = false;
+    }
+    context->is_counting = is_counting;
+}
+
+static void migrate_struct(
+    MigrationContext* context, int32_t to_index, void* destination, int32_t from_index, const void* source
+) {
+    const StructSchema* layout     = &context->to->structs[to_index];
+    const StructSchema* old_layout = &context->from->structs[from_index];
+    uint8_t*            dst        = destination;
+    const uint8_t*      src        = source;
+
+    for (uint32_t i = 0; i < layout->field_count; ++i) {
+        auto field = &context->to->fields[layout->first_field + i];
+        if (field->flags & FIELD_FLAG_TRANSIENT) { continue; }
+
+        auto old_field = find_field(context->from, old_layout, field->name);
+        if (old_field == nullptr) {
+            context->result.added += context->is_counting;
+            if (field->flags & FIELD_FLAG_REQUIRED) { fail_migration(context, field); }
+            continue;
+        }
+
+        if (old_field->kind != field->kind || strcmp(old_field->type, field->type) != 0) {
+            context->result.retyped += context->is_counting;
+            if (field->flags & FIELD_FLAG_REQUIRED) { fail_migration(context, field); }
+            continue;
+        }
+
+        switch ((FieldKind)field->kind) {
+            case FIELD_KIND_DATA: migrate_data(context, field, old_field, dst, src); break;
+            case FIELD_KIND_STRUCT: migrate_nested_structs(context, field, old_field, dst, src); break;
+            case FIELD_KIND_ENTITY_ARRAY: migrate_entity_array(context, field, old_field, dst, src); break;
+        }
+    }
+
+    for (uint32_t i = 0; i < old_layout->field_count; ++i) {
+        auto old_field = &context->from->fields[old_layout->first_field + i];
+        if (find_field(context->to, layout, old_field->name) == nullptr) {
+            context->result.removed += context->is_counting;
+        }
+    }
+}
+
+SchemaMigration migrate_state(
+    const StateSchema* to, void* destination, const StateSchema* from, const void* source, Arena* storage
+) {
+    MigrationContext context = {
+        .to          = to,
+        .from        = from,
+        .storage     = storage,
+        .result      = {.ok = true},
+        .is_counting = true,
+    };
+
+    migrate_struct(&context, 0, destination, 0, source);
+    return context.result;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+constexpr int SCHEMA_NAME_SIZE   = 32;
+constexpr int SCHEMA_MAX_STRUCTS = 64;
+constexpr int SCHEMA_MAX_FIELDS  = 512;
+
+typedef enum FieldKind {
+    FIELD_KIND_DATA,          // Scalars, pointers and types of other libraries, copied while type and size match
+    FIELD_KIND_STRUCT,        // Nested struct or fixed array of them, migrated with its own schema
+    FIELD_KIND_ENTITY_ARRAY,  // Pointer plus `_count`/`_capacity` fields, migrated element by element
+} FieldKind;
+
+typedef enum FieldFlags {
+    FIELD_FLAG_NONE     = 0,
+    FIELD_FLAG_REQUIRED  = 1 << 0,  // Owns resources that cannot be rebuilt, the migration fails unless it is unchanged
+    FIELD_FLAG_ARRAY     = 1 << 1,  // Fixed array of scalars, a different length keeps the common prefix
+    FIELD_FLAG_TRANSIENT = 1 << 2,  // Rebuilt by the game after a reload, a migration leaves it zeroed
+} FieldFlags;
+
+typedef struct FieldSchema {
+    char     name[SCHEMA_NAME_SIZE];
+    char     type[SCHEMA_NAME_SIZE];  // Element type for arrays, so a grown array still matches
+    uint32_t offset;
+    uint32_t size;
+    uint32_t kind;             // FieldKind
+    uint32_t flags;            // FieldFlags
+    int32_t  struct_index;     // StateSchema.structs for FIELD_KIND_STRUCT and FIELD_KIND_ENTITY_ARRAY, -1 otherwise
+    uint32_t count_offset;     // FIELD_KIND_ENTITY_ARRAY only
+    uint32_t capacity_offset;  // FIELD_KIND_ENTITY_ARRAY only
+    uint32_t capacity;         // FIELD_KIND_ENTITY_ARRAY only, elements allocated when migrating into this layout
+} FieldSchema;
+
+typedef struct StructSchema {
+    char     name[SCHEMA_NAME_SIZE];
+    uint32_t size;
+    uint32_t layout;  // Hash of its fields and the structs they nest, equal hashes are copied as bytes
+    uint32_t first_field;
+    uint32_t field_count;
+} StructSchema;
+
+/*
+ * State Schema
+ *
+ * Layout of GameState and the structs it stores, as compiled into one game library. It holds no pointers or
+ * string literals, so a copy can be read after the library that built it was unloaded. `structs[0]` is the root.
+ * Structs of the game get a schema of their own, only scalars, pointers and types of other libraries are DATA.
+ */
+typedef struct StateSchema {
+    uint32_t     version;  // Hash of everything below, differs whenever any layout differs
+    uint32_t     struct_count;
+    uint32_t     field_count;
+    StructSchema structs[SCHEMA_MAX_STRUCTS];
+    FieldSchema  fields[SCHEMA_MAX_FIELDS];
+} StateSchema;
+
+typedef struct SchemaMigration {
+    bool   ok;
+    int    added;             // New fields, left zeroed
+    int    removed;           // Fields the new layout dropped
+    int    resized;           // Fixed arrays of another length, copied up to the shorter one
+    int    retyped;           // Different type, kind or size, left zeroed
+    size_t dropped_elements;  // Entities past a smaller capacity
+    char   failed_field[SCHEMA_NAME_SIZE];
+} SchemaMigration;
+
+#define SCHEMA_FIELD_OF(owner, field, type_name, field_kind, field_flags) \
+    {                                                                     \
+        .name         = #field,                                           \
+        .type         = #type_name,                                       \
+        .offset       = offsetof(owner, field),                           \
+        .size         = sizeof(((owner*)0)->field),                       \
+        .kind         = (field_kind),                                     \
+        .flags        = (field_flags),                                    \
+        .struct_index = -1,                                               \
+    }
+
+#define SCHEMA_DATA(owner, field, type_name)                                   \
+    SCHEMA_FIELD_OF(owner, field, type_name, FIELD_KIND_DATA, FIELD_FLAG_NONE)
+#define SCHEMA_REQUIRED(owner, field, type_name)                                   \
+    SCHEMA_FIELD_OF(owner, field, type_name, FIELD_KIND_DATA, FIELD_FLAG_REQUIRED)
+#define SCHEMA_ARRAY(owner, field, type_name)                                   \
+    SCHEMA_FIELD_OF(owner, field, type_name, FIELD_KIND_DATA, FIELD_FLAG_ARRAY)
+#define SCHEMA_TRANSIENT(owner, field, type_name)                                   \
+    SCHEMA_FIELD_OF(owner, field, type_name, FIELD_KIND_DATA, FIELD_FLAG_TRANSIENT)
+
+#define SCHEMA_STRUCT_OF(owner, field, type_name, index, field_flags) \
+    {                                                                 \
+        .name         = #field,                                       \
+        .type         = #type_name,                                   \
+        .offset       = offsetof(owner, field),                       \
+        .size         = sizeof(((owner*)0)->field),                   \
+        .kind         = FIELD_KIND_STRUCT,                            \
+        .flags        = (field_flags),                                \
+        .struct_index = (index),                                      \
+    }
+
+#define SCHEMA_STRUCT(owner, field, type_name, index)                 \
+    SCHEMA_STRUCT_OF(owner, field, type_name, index, FIELD_FLAG_NONE)
+#define SCHEMA_REQUIRED_STRUCT(owner, field, type_name, index)            \
+    SCHEMA_STRUCT_OF(owner, field, type_name, index, FIELD_FLAG_REQUIRED)
+
+#define SCHEMA_ENTITY_ARRAY(owner, field, type_name, index, max) \
+    {                                                            \
+        .name            = #field,                               \
+        .type            = #type_name,                           \
+        .offset          = offsetof(owner, field),               \
+        .size            = sizeof(type_name*),                   \
+        .kind            = FIELD_KIND_ENTITY_ARRAY,              \
+        .struct_index    = (index),                              \
+        .count_offset    = offsetof(owner, field##_count),       \
+        .capacity_offset = offsetof(owner, field##_capacity),    \
+        .capacity        = (max),                                \
+    }
+
+void        init_state_schema(StateSchema* schema);
+void        finish_state_schema(StateSchema* schema);
+const void* find_state_field(const StateSchema* schema, const void* state, const char* name);
+// A root field of a state laid out by `from`, nullptr unless `schema` lays it out the same way
+const void* find_matching_state_field(
+    const StateSchema* schema, const StateSchema* from, const void* state, const char* name
+);
+void        add_schema_struct(
+    StateSchema* schema, const char* name, size_t size, const FieldSchema* fields, size_t field_count
+);
+
+SchemaMigration migrate_state(
+    const StateSchema* to, void* destination, const StateSchema* from, const void* source, Arena* storage
+);
@@ -1,12 +1,17 @@
+#define LOG_CATEGORY LOG_CATEGORY_ASSETS
+
 #include "audio.h"
 
 #include <cute_audio.h>
 #include <cute_c_runtime.h>
 #include <cute_result.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "../../engine/game_state.h"
 #include "../../engine/log.h"
+#include "../voice.h"
+#include "loader.h"
 #include "utils.h"
 
 static const char* const s_audio_files[AUDIO_COUNT] = {
@@ -19,6 +24,8 @@ static const char* const s_audio_files[AUDIO_COUNT] = {
     [SOUND_HIT]        = "assets/hit-hurt.ogg",
 };
 
+// Decodes the whole file, music included: cf_music_play() only takes a fully decoded CF_Audio and cute has no way to
+// feed the mixer PCM in chunks, so a music track stays resident for as long as it is loaded
 CF_Audio load_audio(const char* path) {
     CF_ASSERT(path);
 
@@ -38,11 +45,81 @@ CF_Audio load_audio(const char* path) {
     return audio;
 }
 
-void load_audios() {
-    for (size_t i = 0; i < AUDIO_COUNT; ++i) { g_state->audio_assets[i] = load_audio(s_audio_files[i]); }
+static bool is_music(const Audio audio) { return audio == MUSIC_BACKGROUND; }
+
+// Decoded PCM size, cute_sound keeps every channel as 16-bit samples
+static size_t get_resident_bytes(const CF_Audio audio) {
+    return (size_t)cf_audio_sample_count(audio) * (size_t)cf_audio_channel_count(audio) * sizeof(int16_t);
+}
+
+void load_audios(GameState* state) {
+    // Sound effects are needed as soon as gameplay starts, the music is decoded after them and plays once it lands.
+    // This only moves the music decode off the startup path, it costs the same time and memory as before.
+    for (size_t i = 0; i < AUDIO_COUNT; ++i) {
+        const bool required     = !is_music((Audio)i);
+        state->audio.handles[i] = load_audio_async(state, s_audio_files[i], required);
+    }
+    start_asset_loader(state);
+}
+
+void update_audio(GameState* state) {
+    auto stats = &state->audio.stats;
+
+    // Account for each asset once its decode lands
+    if (stats->loaded_count < AUDIO_COUNT) {
+        for (size_t i = 0; i < AUDIO_COUNT; ++i) {
+            if (stats->resident_bytes[i] != 0 || !is_audio_ready(state, (Audio)i)) { continue; }
+
+            stats->resident_bytes[i] = get_resident_bytes(get_audio(state, (Audio)i));
+            stats->decode_ms[i]      = get_asset_decode_ms(state, state->audio.handles[i]);
+            stats->loaded_count++;
+
+            if (is_music((Audio)i)) {
+                stats->music_bytes += stats->resident_bytes[i];
+            } else {
+                stats->sound_bank_bytes += stats->resident_bytes[i];
+            }
+
+            APP_DEBUG(
+                "Decoded %s: %zu KiB in %.2f ms", s_audio_files[i], stats->resident_bytes[i] / 1024, stats->decode_ms[i]
+            );
+        }
+
+        if (stats->loaded_count == AUDIO_COUNT) {
+            APP_INFO(
+                "Audio resident: %zu KiB sound bank, %zu KiB music",
+                stats->sound_bank_bytes / 1024,
+                stats->music_bytes / 1024
+            );
+        }
+    }
+
+    if (state->audio.has_queued_music && is_audio_ready(state, state->audio.queued_music)) {
+        state->audio.has_queued_music = false;
+        play_music(state, state->audio.queued_music);
+    }
+}
+
+bool is_audio_ready(GameState* state, const Audio audio) {
+    return is_asset_ready(state, state->audio.handles[audio]);
 }
 
-CF_Audio get_audio(const Audio audio) { return g_state->audio_assets[audio]; }
+CF_Audio get_audio(GameState* state, const Audio audio) {
+    return get_asset_audio(state, state->audio.handles[audio]);
+}
+
+void play_sound(GameState* state, const Audio audio) {
+    // Ticks simulated again after a misprediction already played their sounds
+    if (state->is_headless || !is_audio_ready(state, audio) || state->rollback.is_resimulating) { return; }
+    request_voice(state, audio);
+}
 
-void play_sound(const Audio audio) { cf_play_sound(get_audio(audio), cf_sound_params_defaults()); }
-void play_music(const Audio audio) { cf_music_play(get_audio(audio), 0.5f); }
+void play_music(GameState* state, const Audio audio) {
+    if (state->is_headless) { return; }
+    if (!is_audio_ready(state, audio)) {
+        state->audio.queued_music     = audio;
+        state->audio.has_queued_music = true;
+        return;
+    }
+    cf_music_play(get_audio(state, audio), 0.5f);
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <stddef.h>
+
+typedef struct GameState GameState;
+
 typedef struct CF_Audio CF_Audio;
 typedef enum Audio {
     MUSIC_BACKGROUND,
@@ -12,8 +16,24 @@ typedef enum Audio {
     AUDIO_COUNT
 } Audio;
 
+/*
+ * Audio Stats
+ *
+ * Resident decoded PCM, split between the sound effect bank and music tracks. Music is decoded whole like the
+ * sound effects, these are the numbers to compare against if it is ever streamed.
+ */
+typedef struct AudioStats {
+    size_t resident_bytes[AUDIO_COUNT];
+    double decode_ms[AUDIO_COUNT];
+    size_t sound_bank_bytes;
+    size_t music_bytes;
+    size_t loaded_count;
+} AudioStats;
+
 CF_Audio load_audio(const char* path);
-void     load_audios(void);
-CF_Audio get_audio(const Audio audio);
-void     play_sound(const Audio audio);
-void     play_music(const Audio audio);
+void     load_audios(GameState* state);
+void     update_audio(GameState* state);
+bool     is_audio_ready(GameState* state, const Audio audio);
+CF_Audio get_audio(GameState* state, const Audio audio);
+void     play_sound(GameState* state, const Audio audio);
+void     play_music(GameState* state, const Audio audio);  // Starts once the track is decoded if it is still loading
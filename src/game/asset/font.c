@@ -1,3 +1,5 @@
+#define LOG_CATEGORY LOG_CATEGORY_ASSETS
+
 #include "font.h"
 
 #include <cute_draw.h>
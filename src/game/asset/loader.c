@@ -0,0 +1,152 @@
+#define LOG_CATEGORY LOG_CATEGORY_ASSETS
+
+#include "loader.h"
+
+#include <cute_c_runtime.h>
+#include <cute_multithreading.h>
+#include <cute_time.h>
+#include <string.h>
+
+#include "../../engine/game_state.h"
+#include "../../engine/log.h"
+#include "audio.h"
+
+static void load_job(void* param) {
+    AssetJob*          job       = param;
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+    const CF_Audio     audio     = load_audio(job->path);
+
+    // Publish the results before the status, the main thread only reads them once the job is done
+    job->audio     = audio;
+    job->decode_ms = cf_stopwatch_milliseconds(stopwatch);
+    cf_atomic_set(&job->status, audio.id != 0 ? ASSET_STATUS_READY : ASSET_STATUS_FAILED);
+}
+
+static CF_Threadpool* make_loader_threadpool(void) {
+    // Leave a core for the main thread
+    const int cores = cf_core_count();
+    return cf_make_threadpool(cores > 2 ? cores - 1 : 1);
+}
+
+void init_asset_loader(GameState* state) {
+    auto loader = &state->asset_loader;
+
+    *loader = (AssetLoader){
+        .threadpool = make_loader_threadpool(),
+        .stopwatch  = cf_make_stopwatch(),
+    };
+}
+
+void shutdown_asset_loader(GameState* state) {
+    auto loader = &state->asset_loader;
+    if (loader->threadpool == nullptr) { return; }
+
+    // Joins the workers, so nothing writes into GameState after this
+    cf_destroy_threadpool(loader->threadpool);
+    loader->threadpool = nullptr;
+}
+
+// Unlike shutdown, the loader keeps its jobs, and the ones that never reached a worker stay queued
+void pause_asset_loader(GameState* state) { shutdown_asset_loader(state); }
+
+static bool is_job_submitted(const AssetLoader* loader, const AssetJob* job) {
+    // Optional jobs reach the pool once the required ones are done
+    return job->required || loader->required_ready_ms > 0.0;
+}
+
+void resume_asset_loader(GameState* state) {
+    auto loader = &state->asset_loader;
+    CF_ASSERT(loader->threadpool == nullptr);
+
+    int resubmitted = 0;
+    for (int i = 0; i < loader->job_count; ++i) {
+        auto job = &loader->jobs[i];
+        if (cf_atomic_get(&job->status) != ASSET_STATUS_QUEUED) { continue; }
+
+        if (loader->threadpool == nullptr) { loader->threadpool = make_loader_threadpool(); }
+        if (!is_job_submitted(loader, job)) { continue; }
+
+        cf_threadpool_add_task(loader->threadpool, load_job, job);
+        resubmitted++;
+    }
+
+    if (resubmitted > 0) {
+        cf_threadpool_kick(loader->threadpool);
+        APP_INFO("Resubmitted %d asset jobs after the reload", resubmitted);
+    }
+}
+
+AssetHandle load_audio_async(GameState* state, const char* path, bool required) {
+    auto loader = &state->asset_loader;
+    CF_ASSERT(path && strlen(path) < ASSET_PATH_LENGTH);
+    CF_ASSERT(loader->job_count < ASSET_LOADER_MAX_JOBS);
+
+    const int index     = loader->job_count++;
+    loader->jobs[index] = (AssetJob){.required = required};
+    // Copied, the path may be a literal owned by a game library that is unloaded before the job runs
+    strncpy(loader->jobs[index].path, path, ASSET_PATH_LENGTH - 1);
+    cf_atomic_set(&loader->jobs[index].status, ASSET_STATUS_QUEUED);
+
+    return (AssetHandle){.index = index};
+}
+
+static void submit_jobs(AssetLoader* loader, bool required) {
+    for (int i = 0; i < loader->job_count; ++i) {
+        if (loader->jobs[i].required != required) { continue; }
+        cf_threadpool_add_task(loader->threadpool, load_job, &loader->jobs[i]);
+    }
+    cf_threadpool_kick(loader->threadpool);
+}
+
+// Other jobs reach the pool once the required ones are done, so whatever order the pool runs its tasks in and
+// however few workers it has, a long decode never holds up gameplay
+void start_asset_loader(GameState* state) { submit_jobs(&state->asset_loader, true); }
+
+AssetStatus get_asset_status(GameState* state, AssetHandle handle) {
+    auto loader = &state->asset_loader;
+    if (handle.index < 0 || handle.index >= loader->job_count) { return ASSET_STATUS_FAILED; }
+
+    return (AssetStatus)cf_atomic_get(&loader->jobs[handle.index].status);
+}
+
+bool is_asset_ready(GameState* state, AssetHandle handle) {
+    return get_asset_status(state, handle) == ASSET_STATUS_READY;
+}
+
+CF_Audio get_asset_audio(GameState* state, AssetHandle handle) {
+    if (!is_asset_ready(state, handle)) { return (CF_Audio){0}; }
+    return state->asset_loader.jobs[handle.index].audio;
+}
+
+double get_asset_decode_ms(GameState* state, AssetHandle handle) {
+    if (get_asset_status(state, handle) == ASSET_STATUS_QUEUED) { return 0.0; }
+    return state->asset_loader.jobs[handle.index].decode_ms;
+}
+
+bool are_required_assets_ready(GameState* state) {
+    auto loader = &state->asset_loader;
+    if (loader->required_ready_ms > 0.0) { return true; }
+
+    for (int i = 0; i < loader->job_count; ++i) {
+        auto job = &loader->jobs[i];
+        if (job->required && cf_atomic_get(&job->status) == ASSET_STATUS_QUEUED) { return false; }
+    }
+
+    loader->required_ready_ms = cf_stopwatch_milliseconds(loader->stopwatch);
+    APP_INFO("Required assets ready in %.2f ms", loader->required_ready_ms);
+    submit_jobs(loader, false);
+
+    return true;
+}
+
+float get_asset_loader_progress(GameState* state) {
+    auto loader = &state->asset_loader;
+    if (loader->job_count == 0) { return 1.0f; }
+
+    int done = 0;
+    for (int i = 0; i < loader->job_count; ++i) {
+        if (cf_atomic_get(&loader->jobs[i].status) != ASSET_STATUS_QUEUED) { done++; }
+    }
+
+    return (float)done / (float)loader->job_count;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cute_audio.h>
+#include <cute_multithreading.h>
+#include <cute_time.h>
+
+typedef struct GameState GameState;
+
+constexpr int ASSET_LOADER_MAX_JOBS = 32;
+constexpr int ASSET_PATH_LENGTH     = 64;
+
+typedef enum AssetStatus {
+    ASSET_STATUS_QUEUED,
+    ASSET_STATUS_READY,
+    ASSET_STATUS_FAILED,
+} AssetStatus;
+
+typedef struct AssetHandle {
+    int index;  // Into AssetLoader.jobs, -1 for an invalid handle
+} AssetHandle;
+
+/*
+ * Asset Job
+ *
+ * Decode work owned by a worker thread until `status` leaves ASSET_STATUS_QUEUED. Holds no pointers into the game
+ * library or GameState, so a job that never ran can be submitted again after a reload or a migration.
+ */
+typedef struct AssetJob {
+    char         path[ASSET_PATH_LENGTH];
+    CF_Audio     audio;      // Written by the worker, valid once the job is done
+    bool         required;   // Gameplay waits for required assets, the rest become ready in the background
+    double       decode_ms;  // Written by the worker, valid once the job is done
+    CF_AtomicInt status;
+} AssetJob;
+
+/*
+ * Asset Loader
+ *
+ * Decodes assets on a cute threadpool. Only work that does not touch cute's GPU side or global caches (audio
+ * decoding) runs on the workers; sprites and fonts stay on the main thread. The workers run code from the game
+ * library, so pause_asset_loader() joins them before the library is unloaded and resume_asset_loader() submits
+ * whatever did not run from the new one.
+ */
+typedef struct AssetLoader {
+    CF_Threadpool* threadpool;
+    AssetJob       jobs[ASSET_LOADER_MAX_JOBS];
+    int            job_count;
+    CF_Stopwatch   stopwatch;
+    double         required_ready_ms;  // Time from init until every required asset was ready, 0 while waiting
+} AssetLoader;
+
+// load_audio_async() is called before start_asset_loader()
+void        init_asset_loader(GameState* state);
+void        shutdown_asset_loader(GameState* state);
+void        pause_asset_loader(GameState* state);   // Joins the workers, jobs that did not start stay queued
+void        resume_asset_loader(GameState* state);  // Submits the queued jobs to a new threadpool
+AssetHandle load_audio_async(GameState* state, const char* path, bool required);
+void        start_asset_loader(GameState* state);
+AssetStatus get_asset_status(GameState* state, AssetHandle handle);
+bool        is_asset_ready(GameState* state, AssetHandle handle);
+CF_Audio    get_asset_audio(GameState* state, AssetHandle handle);  // Zero until the asset is ready
+double      get_asset_decode_ms(GameState* state, AssetHandle handle);
+bool        are_required_assets_ready(GameState* state);
+float       get_asset_loader_progress(GameState* state);
@@ -1,16 +1,27 @@
+#define LOG_CATEGORY LOG_CATEGORY_ASSETS
+
 #include "sprite.h"
 
+#include <cute_alloc.h>
+#include <cute_array.h>
 #include <cute_c_runtime.h>
 #include <cute_draw.h>
+#include <cute_file_system.h>
+#include <cute_hashtable.h>
 #include <cute_math.h>
 #include <cute_result.h>
 #include <cute_sprite.h>
+#include <cute_string.h>
+#include <cute_time.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
-#include "../../engine/cute_macros.h"
 #include "../../engine/game_state.h"
 #include "../../engine/log.h"
 #include "../component.h"
+#include "../render_queue.h"
+#include "sprite_pack.h"
 #include "utils.h"
 
 static const char* const s_sprite_files[SPRITE_COUNT] = {
@@ -50,23 +61,178 @@ CF_Sprite load_sprite(const char* path) {
     return sprite;
 }
 
-void prefetch_sprites() {
-    for (size_t i = 0; i < SPRITE_COUNT; ++i) { cf_draw_prefetch(&g_state->sprite_assets[i]); }
+void prefetch_sprites(GameState* state) {
+    for (size_t i = 0; i < SPRITE_COUNT; ++i) { cf_draw_prefetch(&state->sprite_assets[i]); }
 }
 
-void load_sprites() {
-    for (size_t i = 0; i < SPRITE_COUNT; ++i) { g_state->sprite_assets[i] = load_sprite(s_sprite_files[i]); }
+// Views into the pack file, valid while its data is
+typedef struct SpritePack {
+    const SpritePackHeader*    header;
+    const SpritePackSprite*    sprites;
+    const SpritePackFrame*     frames;
+    const SpritePackAnimation* animations;
+    const CF_Pixel*            atlas;
+} SpritePack;
+
+static const SpritePackSprite* find_pack_sprite(const SpritePack* pack, const char* path) {
+    for (uint32_t i = 0; i < pack->header->sprite_count; ++i) {
+        if (strncmp(pack->sprites[i].path, path, SPRITE_PACK_PATH_SIZE) == 0) { return &pack->sprites[i]; }
+    }
+    return nullptr;
 }
 
-CF_Sprite  get_sprite(const Sprite sprite) { return g_state->sprite_assets[sprite]; }
-CF_Sprite* get_sprite_ptr(const Sprite sprite) { return &g_state->sprite_assets[sprite]; }
+static bool is_valid_pack_sprite(const SpritePack* pack, const SpritePackSprite* sprite) {
+    const SpritePackHeader* header = pack->header;
+    if ((uint32_t)sprite->first_frame + sprite->frame_count > header->frame_count || sprite->frame_count == 0) {
+        return false;
+    }
+    if ((uint32_t)sprite->first_animation + sprite->animation_count > header->animation_count) { return false; }
 
-void render_sprite(CF_Sprite* sprite, const CF_V2 position, const ZIndex z_index) {
-    cf_sprite_update(sprite);
-    cf_draw() {
-        cf_draw_layer(z_index) {
-            cf_draw_translate_v2(position);
-            cf_draw_sprite(sprite);
+    for (int i = 0; i < sprite->frame_count; ++i) {
+        const SpritePackFrame* frame = &pack->frames[sprite->first_frame + i];
+        if ((uint32_t)frame->x + sprite->w > header->atlas_w || (uint32_t)frame->y + sprite->h > header->atlas_h) {
+            return false;
         }
     }
+    for (int i = 0; i < sprite->animation_count; ++i) {
+        const SpritePackAnimation* animation = &pack->animations[sprite->first_animation + i];
+        if (animation->from_frame > animation->to_frame || animation->to_frame >= sprite->frame_count) { return false; }
+        if (memchr(animation->name, '\0', SPRITE_PACK_ANIMATION_SIZE) == nullptr) { return false; }
+    }
+    return true;
+}
+
+static bool open_pack(const uint8_t* data, size_t size, SpritePack* pack) {
+    if (data == nullptr || size < sizeof(SpritePackHeader)) { return false; }
+
+    const SpritePackHeader* header = (const SpritePackHeader*)data;
+    if (header->magic != SPRITE_PACK_MAGIC || header->version != SPRITE_PACK_VERSION) { return false; }
+
+    const size_t tables_size = sizeof(SpritePackHeader) + header->sprite_count * sizeof(SpritePackSprite) +
+                               header->frame_count * sizeof(SpritePackFrame) +
+                               header->animation_count * sizeof(SpritePackAnimation);
+    const size_t atlas_size  = (size_t)header->atlas_w * header->atlas_h * sizeof(CF_Pixel);
+    if (tables_size > header->atlas_offset || (size_t)header->atlas_offset + atlas_size > size) { return false; }
+
+    const SpritePackSprite* sprites = (const SpritePackSprite*)(header + 1);
+    const SpritePackFrame*  frames  = (const SpritePackFrame*)(sprites + header->sprite_count);
+
+    *pack = (SpritePack){
+        .header     = header,
+        .sprites    = sprites,
+        .frames     = frames,
+        .animations = (const SpritePackAnimation*)(frames + header->frame_count),
+        .atlas      = (const CF_Pixel*)(data + header->atlas_offset),
+    };
+
+    for (uint32_t i = 0; i < header->sprite_count; ++i) {
+        if (!is_valid_pack_sprite(pack, &pack->sprites[i])) { return false; }
+    }
+    return true;
+}
+
+// Copies a frame out of the atlas into `pixels` and hands it to cute, which keeps its own copy
+static CF_Sprite make_frame_sprite(const SpritePack* pack, const SpritePackSprite* entry, int index, CF_Pixel* pixels) {
+    const SpritePackFrame* frame = &pack->frames[entry->first_frame + index];
+    for (int y = 0; y < entry->h; ++y) {
+        const CF_Pixel* row = pack->atlas + (size_t)(frame->y + y) * pack->header->atlas_w + frame->x;
+        CF_MEMCPY(pixels + (size_t)y * entry->w, row, (size_t)entry->w * sizeof(CF_Pixel));
+    }
+    return cf_make_easy_sprite_from_pixels(pixels, entry->w, entry->h);
+}
+
+/*
+ * Builds the animation tables cute's Aseprite loader would have made, with each frame registered as an easy sprite
+ * image. Nothing is decoded, the pixels are copied straight out of the atlas. Sprites without animations, the baked
+ * PNGs, are single frame easy sprites.
+ */
+static CF_Sprite load_pack_sprite(const SpritePack* pack, const SpritePackSprite* entry, CF_Pixel* pixels) {
+    if (entry->animation_count == 0) { return make_frame_sprite(pack, entry, 0, pixels); }
+
+    uint64_t* frame_ids = cf_alloc((size_t)entry->frame_count * sizeof(uint64_t));
+    for (int i = 0; i < entry->frame_count; ++i) {
+        frame_ids[i] = make_frame_sprite(pack, entry, i, pixels).easy_sprite_id;
+    }
+
+    CF_Sprite sprite = cf_sprite_defaults();
+    sprite.name      = sintern(entry->path);
+    sprite.w         = entry->w;
+    sprite.h         = entry->h;
+
+    for (int i = 0; i < entry->animation_count; ++i) {
+        const SpritePackAnimation* source = &pack->animations[entry->first_animation + i];
+        CF_Animation*              animation = cf_alloc(sizeof(CF_Animation));
+        animation->name                      = sintern(source->name);
+        animation->play_direction            = (CF_PlayDirection)source->direction;
+        animation->frames                    = nullptr;
+
+        for (int f = source->from_frame; f <= source->to_frame; ++f) {
+            const float    delay = (float)pack->frames[entry->first_frame + f].duration_ms / 1000.0f;
+            const CF_Frame frame = {.id = frame_ids[f], .delay = delay};
+            apush(animation->frames, frame);
+        }
+
+        hset(sprite.animations, animation->name, animation);
+        if (i == 0) { sprite.animation = animation; }
+    }
+
+    cf_free(frame_ids);
+    return sprite;
+}
+
+void load_sprites(GameState* state) {
+    CF_Stopwatch stopwatch = cf_make_stopwatch();
+
+    // The whole pack comes in with one read, sprites it does not cover are loaded from their own files
+    size_t     size   = 0;
+    uint8_t*   data   = cf_fs_read_entire_file_to_memory(SPRITE_PACK_PATH, &size);
+    SpritePack pack   = {0};
+    int        packed = 0;
+
+    if (data && !open_pack(data, size, &pack)) {
+        APP_WARN("Ignoring invalid sprite pack %s, rebuild the bake_assets target", SPRITE_PACK_PATH);
+        cf_free(data);
+        data = nullptr;
+    }
+
+    // Scratch for one frame at a time, sized by the largest sprite
+    CF_Pixel* pixels = nullptr;
+    if (data) {
+        size_t largest = 0;
+        for (uint32_t i = 0; i < pack.header->sprite_count; ++i) {
+            const size_t area = (size_t)pack.sprites[i].w * pack.sprites[i].h;
+            largest           = area > largest ? area : largest;
+        }
+        pixels = cf_alloc(largest * sizeof(CF_Pixel));
+    }
+
+    for (size_t i = 0; i < SPRITE_COUNT; ++i) {
+        const SpritePackSprite* entry = data ? find_pack_sprite(&pack, s_sprite_files[i]) : nullptr;
+
+        if (entry) {
+            state->sprite_assets[i] = load_pack_sprite(&pack, entry, pixels);
+            packed++;
+        } else {
+            state->sprite_assets[i] = load_sprite(s_sprite_files[i]);
+        }
+    }
+
+    if (pixels) { cf_free(pixels); }
+    if (data) { cf_free(data); }
+
+    APP_INFO(
+        "Loaded %d sprites (%d from %s) in %.2f ms",
+        SPRITE_COUNT,
+        packed,
+        SPRITE_PACK_PATH,
+        cf_stopwatch_milliseconds(stopwatch)
+    );
+}
+
+CF_Sprite  get_sprite(GameState* state, const Sprite sprite) { return state->sprite_assets[sprite]; }
+CF_Sprite* get_sprite_ptr(GameState* state, const Sprite sprite) { return &state->sprite_assets[sprite]; }
+
+void render_sprite(GameState* state, CF_Sprite* sprite, const CF_V2 position, const ZIndex z_index) {
+    cf_sprite_update(sprite);
+    render_queue_push_sprite(state, sprite, position, cf_v2(1.0f, 1.0f), z_index);
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+typedef struct GameState GameState;
+
 typedef struct CF_Sprite CF_Sprite;
 typedef struct CF_V2     CF_V2;
 typedef enum ZIndex      ZIndex;
@@ -19,8 +21,8 @@ typedef enum Sprite {
 } Sprite;
 
 CF_Sprite  load_sprite(const char* path);
-CF_Sprite  get_sprite(const Sprite sprite);
-CF_Sprite* get_sprite_ptr(const Sprite sprite);
-void       load_sprites();
-void       prefetch_sprites();
-void       render_sprite(CF_Sprite* sprite, const CF_V2 position, const ZIndex z_index);
+CF_Sprite  get_sprite(GameState* state, const Sprite sprite);
+CF_Sprite* get_sprite_ptr(GameState* state, const Sprite sprite);
+void       load_sprites(GameState* state);
+void       prefetch_sprites(GameState* state);
+void       render_sprite(GameState* state, CF_Sprite* sprite, const CF_V2 position, const ZIndex z_index);
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Sprite Pack
+ *
+ * Binary file written by the asset baker (src/tools/asset_baker.c) and read by load_sprites() in one go:
+ *
+ *   SpritePackHeader
+ *   SpritePackSprite[sprite_count]
+ *   SpritePackFrame[frame_count]
+ *   SpritePackAnimation[animation_count]
+ *   atlas, RGBA8 pixels aligned to SPRITE_PACK_ALIGNMENT
+ *
+ * Every frame of every sprite is a rectangle of the one atlas, and the tables carry what cute would otherwise read
+ * out of the Aseprite files, so loading does no decoding at all. Sprite frames and animations are ranges of their
+ * tables, animation frames are relative to the sprite's first frame. All integers are little endian.
+ */
+
+constexpr uint32_t SPRITE_PACK_MAGIC          = 0x4b505352;  // "RSPK"
+constexpr uint32_t SPRITE_PACK_VERSION        = 3;
+constexpr int      SPRITE_PACK_PATH_SIZE      = 48;
+constexpr int      SPRITE_PACK_ANIMATION_SIZE = 24;
+constexpr int      SPRITE_PACK_ALIGNMENT      = 16;
+
+#define SPRITE_PACK_PATH "assets/sprites.pak"
+
+typedef struct SpritePackHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sprite_count;
+    uint32_t frame_count;
+    uint32_t animation_count;
+    uint16_t atlas_w;
+    uint16_t atlas_h;
+    uint32_t atlas_offset;  // From the start of the file
+    uint32_t reserved;
+} SpritePackHeader;
+
+typedef struct SpritePackSprite {
+    char     path[SPRITE_PACK_PATH_SIZE];  // Path the sprite was baked from, matches s_sprite_files
+    uint16_t w;
+    uint16_t h;
+    uint16_t first_frame;
+    uint16_t frame_count;
+    uint16_t first_animation;
+    uint16_t animation_count;  // 0 for PNGs, they load as single frame easy sprites
+} SpritePackSprite;
+
+typedef struct SpritePackFrame {
+    uint16_t x;  // Top left corner in the atlas, the size is the sprite's
+    uint16_t y;
+    uint16_t duration_ms;
+    uint16_t reserved;
+} SpritePackFrame;
+
+typedef struct SpritePackAnimation {
+    char     name[SPRITE_PACK_ANIMATION_SIZE];
+    uint16_t from_frame;
+    uint16_t to_frame;   // Inclusive
+    uint8_t  direction;  // CF_PlayDirection, Aseprite numbers its loop directions the same way
+    uint8_t  reserved[3];
+} SpritePackAnimation;
@@ -1,21 +1,22 @@
 #include "background_scroll.h"
 
-#include <cute_draw.h>
+#include <cute_graphics.h>
 #include <cute_math.h>
 #include <cute_sprite.h>
 
-#include "../engine/cute_macros.h"
 #include "../engine/game_state.h"
 #include "asset/sprite.h"
+#include "gfx.h"
 
-BackgroundScroll make_background_scroll(void) {
+BackgroundScroll make_background_scroll(GameState* state) {
     auto background_scroll = (BackgroundScroll){
         .position = cf_v2(0, 0),
         .velocity = cf_v2(0, 0.5f),
+        .mode     = BACKGROUND_SCROLL_MODE_TILED,
     };
 
     for (int i = 0; i < BACKGROUND_SCROLL_SPRITE_COUNT; ++i) {
-        background_scroll.sprites[i] = get_sprite(SPRITE_BACKGROUND);
+        background_scroll.sprites[i] = get_sprite(state, SPRITE_BACKGROUND);
 
         // Set the initial frame to 0 or 1 based on the index to create a
         // checkerboard pattern
@@ -27,31 +28,74 @@ BackgroundScroll make_background_scroll(void) {
     return background_scroll;
 }
 
-void update_background_scroll() {
-    g_state->background_scroll.y_offset += 0.1f;
-    if (g_state->background_scroll.y_offset >= g_state->background_scroll.max_y_offset) {
-        g_state->background_scroll.y_offset = 0;
-    }
-}
-
-void render_background_scroll(void) {
-    cf_draw() {
-        cf_draw_translate(
-            0,
-            g_state->canvas_size.y / 2.0f - g_state->background_scroll.y_offset +
-                g_state->background_scroll.max_y_offset * 0.5f
-        );
+// Draws the tile grid centered vertically on `center_y`
+static void draw_background_tiles(
+    GameState* state, BackgroundScroll* background_scroll, float center_y, bool update_sprites
+) {
+    gfx_draw(state) {
+        gfx_translate(state, cf_v2(0, center_y));
         int i = 0;
         for (int y = 0; y < (BACKGROUND_SCROLL_SPRITE_COUNT / 3); ++y) {
             for (int x = -1; x <= 1; ++x) {
-                CF_Sprite* sprite = &g_state->background_scroll.sprites[i];
-                cf_draw() {
-                    cf_draw_translate(x * sprite->w, -y * sprite->h);
-                    cf_sprite_update(sprite);
-                    cf_sprite_draw(sprite);
+                CF_Sprite* sprite = &background_scroll->sprites[i];
+                gfx_draw(state) {
+                    gfx_translate(state, cf_v2(x * sprite->w, -y * sprite->h));
+                    if (update_sprites) { cf_sprite_update(sprite); }
+                    gfx_draw_sprite(state, sprite);
                 }
                 ++i;
             }
         }
     }
 }
+
+/*
+ * Renders the tile grid once into a canvas covering the screen plus one tile row, which is exactly what the tiled
+ * mode draws at a zero scroll offset. Must be called after the app canvas size is set and before anything else is
+ * queued for drawing, since gfx_render_to() flushes the whole draw list.
+ */
+void bake_background_scroll(GameState* state, BackgroundScroll* background_scroll, float scale) {
+    const CF_V2 canvas_size         = state->canvas_size;
+    background_scroll->baked_size   = cf_v2(canvas_size.x, canvas_size.y + background_scroll->max_y_offset);
+
+    const int canvas_w              = (int)(background_scroll->baked_size.x * scale);
+    const int canvas_h              = (int)(background_scroll->baked_size.y * scale);
+    background_scroll->baked_canvas = cf_make_canvas(cf_canvas_defaults(canvas_w, canvas_h));
+
+    // Draw calls are projected onto the logical canvas size, so squash the taller grid to fit. Drawing the baked
+    // canvas at its own logical size stretches it back.
+    gfx_draw(state) {
+        gfx_scale(state, cf_v2(1.0f, canvas_size.y / background_scroll->baked_size.y));
+        draw_background_tiles(state, background_scroll, canvas_size.y / 2.0f, false);
+    }
+    gfx_render_to(state, background_scroll->baked_canvas, true);
+
+    background_scroll->mode = BACKGROUND_SCROLL_MODE_BAKED;
+}
+
+void update_background_scroll(GameState* state) {
+    state->background_scroll.y_offset += 0.1f;
+    if (state->background_scroll.y_offset >= state->background_scroll.max_y_offset) {
+        state->background_scroll.y_offset = 0;
+    }
+}
+
+void render_background_scroll(GameState* state) {
+    auto background_scroll = &state->background_scroll;
+
+    if (background_scroll->mode == BACKGROUND_SCROLL_MODE_BAKED) {
+        // The baked canvas hangs one tile row above the screen and slides down by the scroll offset
+        const float center_y = background_scroll->max_y_offset * 0.5f - background_scroll->y_offset;
+        gfx_draw(state) {
+            gfx_draw_canvas(state, background_scroll->baked_canvas, cf_v2(0, center_y), background_scroll->baked_size);
+        }
+        return;
+    }
+
+    draw_background_tiles(
+        state,
+        background_scroll,
+        state->canvas_size.y / 2.0f - background_scroll->y_offset + background_scroll->max_y_offset * 0.5f,
+        true
+    );
+}
@@ -1,21 +1,33 @@
 #pragma once
 
+#include <cute_graphics.h>
 #include <cute_math.h>
 #include <cute_sprite.h>
 
 #include "component.h"
 
+typedef struct GameState GameState;
+
 constexpr int BACKGROUND_SCROLL_SPRITE_COUNT = 6 * 3;
 
+typedef enum BackgroundScrollMode {
+    BACKGROUND_SCROLL_MODE_TILED,  // Draw every tile sprite each frame
+    BACKGROUND_SCROLL_MODE_BAKED,  // Draw the tiles baked into a single canvas with one quad
+} BackgroundScrollMode;
+
 typedef struct BackgroundScroll {
-    CF_V2     position;
-    CF_V2     velocity;
-    CF_Sprite sprites[BACKGROUND_SCROLL_SPRITE_COUNT];  // Background sprite
-    float     y_offset;                                 // Vertical offset for scrolling
-    float     max_y_offset;                             // Maximum offset before resetting
-    ZIndex    z_index;                                  // Rendering order
+    CF_V2                position;
+    CF_V2                velocity;
+    CF_Sprite            sprites[BACKGROUND_SCROLL_SPRITE_COUNT];  // Background sprite
+    float                y_offset;                                 // Vertical offset for scrolling
+    float                max_y_offset;                             // Maximum offset before resetting
+    ZIndex               z_index;                                  // Rendering order
+    BackgroundScrollMode mode;
+    CF_Canvas            baked_canvas;  // Tile pattern baked at init, one tile row taller than the screen
+    CF_V2                baked_size;    // Logical size of the baked canvas
 } BackgroundScroll;
 
-BackgroundScroll make_background_scroll(void);
-void             update_background_scroll(void);
-void             render_background_scroll(void);
+BackgroundScroll make_background_scroll(GameState* state);
+void             bake_background_scroll(GameState* state, BackgroundScroll* background_scroll, float scale);
+void             update_background_scroll(GameState* state);
+void             render_background_scroll(GameState* state);
@@ -0,0 +1,110 @@
+#include "bot.h"
+
+#include <cute_math.h>
+#include <stddef.h>
+
+#include "../engine/game_state.h"
+#include "component.h"
+
+typedef struct BotThreat {
+    float ticks;      // Until it overlaps the player
+    float offset_x;   // Where it crosses the player's row, relative to the player
+    float clearance;  // How far the player has to step sideways to let it pass
+} BotThreat;
+
+// Only threats coming down from above are predicted, nothing in the game moves up into the player
+static bool predict_threat(
+    const Player* player, CF_V2 position, CF_V2 velocity, CF_V2 half_extents, BotThreat* threat
+) {
+    const CF_V2 reach = cf_add_v2(cf_add_v2(player->collider.half_extents, half_extents), cf_v2(BOT_DANGER_MARGIN, 0));
+    const CF_V2 delta = cf_sub_v2(position, player->position);
+    if (delta.y < -reach.y) { return false; }
+
+    float ticks = 0.0f;
+    if (delta.y > reach.y) {
+        if (velocity.y >= 0.0f) { return false; }
+        ticks = (delta.y - reach.y) / -velocity.y;
+    }
+    if (ticks > BOT_LOOKAHEAD_TICKS) { return false; }
+
+    const float offset_x = delta.x + velocity.x * ticks;
+    if (cf_abs(offset_x) > reach.x) { return false; }
+
+    *threat = (BotThreat){.ticks = ticks, .offset_x = offset_x, .clearance = reach.x - cf_abs(offset_x)};
+    return true;
+}
+
+static bool find_soonest_threat(GameState* state, const Player* player, BotThreat* soonest) {
+    bool      is_found = false;
+    BotThreat threat   = {0};
+
+    for (size_t i = 0; i < state->enemy_bullets_count; ++i) {
+        const EnemyBullet* bullet = &state->enemy_bullets[i];
+        if (!bullet->is_alive) { continue; }
+        if (!predict_threat(player, bullet->position, bullet->velocity, bullet->collider.half_extents, &threat)) {
+            continue;
+        }
+        if (!is_found || threat.ticks < soonest->ticks) { *soonest = threat; }
+        is_found = true;
+    }
+
+    for (size_t i = 0; i < state->enemies_count; ++i) {
+        const Enemy* enemy = &state->enemies[i];
+        if (!enemy->is_alive) { continue; }
+        if (!predict_threat(player, enemy->position, enemy->velocity, enemy->collider.half_extents, &threat)) {
+            continue;
+        }
+        if (!is_found || threat.ticks < soonest->ticks) { *soonest = threat; }
+        is_found = true;
+    }
+
+    return is_found;
+}
+
+static bool find_nearest_enemy_x(GameState* state, const Player* player, float* x) {
+    bool  is_found = false;
+    float nearest  = 0.0f;
+
+    for (size_t i = 0; i < state->enemies_count; ++i) {
+        const Enemy* enemy = &state->enemies[i];
+        if (!enemy->is_alive || enemy->position.y <= player->position.y) { continue; }
+
+        const float distance = cf_abs(enemy->position.x - player->position.x);
+        if (!is_found || distance < nearest) {
+            nearest = distance;
+            *x      = enemy->position.x;
+        }
+        is_found = true;
+    }
+
+    return is_found;
+}
+
+void update_bot_input(GameState* state, const Player* player, Input* input) {
+    // Shooting also restarts the game after a game over
+    *input = (Input){.shoot = true};
+    if (!player->is_alive) { return; }
+
+    BotThreat threat = {0};
+    if (find_soonest_threat(state, player, &threat)) {
+        // Step away from where it crosses, unless the edge of the canvas leaves no room
+        const float half_width      = state->canvas_size.x / 2.0f;
+        bool        is_dodging_left = threat.offset_x >= 0.0f;
+        if (is_dodging_left && player->position.x - threat.clearance < -half_width) { is_dodging_left = false; }
+        if (!is_dodging_left && player->position.x + threat.clearance > half_width) { is_dodging_left = true; }
+
+        input->left  = is_dodging_left;
+        input->right = !is_dodging_left;
+        return;
+    }
+
+    float target_x = 0.0f;
+    if (!find_nearest_enemy_x(state, player, &target_x)) { target_x = player->spawn_position.x; }
+
+    input->left  = target_x < player->position.x - BOT_TRACK_DEADZONE;
+    input->right = target_x > player->position.x + BOT_TRACK_DEADZONE;
+
+    // Drift back to the spawn row, dodging only works sideways
+    input->down  = player->position.y > player->spawn_position.y + BOT_TRACK_DEADZONE;
+    input->up    = player->position.y < player->spawn_position.y - BOT_TRACK_DEADZONE;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "input.h"
+#include "player.h"
+
+typedef struct GameState GameState;
+
+constexpr int   BOT_LOOKAHEAD_TICKS = 45;    // Threats further away than this are ignored
+constexpr float BOT_DANGER_MARGIN   = 4.0f;  // Added around the player's collider when predicting hits
+constexpr float BOT_TRACK_DEADZONE  = 2.0f;  // Close enough under an enemy to stop moving
+
+// Reads the state and fills in the input a player would press this tick. It dodges the enemy or bullet that will hit
+// the soonest, otherwise it follows the nearest enemy horizontally, and it always fires.
+void update_bot_input(GameState* state, const Player* player, Input* input);
@@ -4,17 +4,14 @@
 #include <stddef.h>
 
 #include "../engine/game_state.h"
-#include "asset/audio.h"
 #include "enemy.h"
-#include "explosion.h"
-#include "explosion_particle.h"
-#include "floating_score.h"
-#include "hit_particle.h"
+#include "gameplay_event.h"
 #include "player.h"
 #include "player_bullet.h"
-#include "screenshake.h"
+#include "sim_math.h"
 
 static void player_bullets_vs_enemies(
+    GameState* state,
     const size_t player_bullets_count,
     PlayerBullet player_bullets[static restrict player_bullets_count],
     const size_t enemies_count,
@@ -27,44 +24,45 @@ static void player_bullets_vs_enemies(
         if (!bullet->is_alive) { continue; }
 
         // Calculate bullet AABB once per bullet (not per enemy)
-        auto bullet_aabb = cf_make_aabb_center_half_extents(bullet->position, bullet->collider.half_extents);
+        auto bullet_aabb = sim_make_aabb(bullet->position, bullet->collider.half_extents);
 
         for (size_t j = 0; j < enemies_count; ++j) {
             if (!enemies[j].is_alive) { continue; }
 
             auto enemy      = &enemies[j];
-            auto enemy_aabb = cf_make_aabb_center_half_extents(enemy->position, enemy->collider.half_extents);
+            auto enemy_aabb = sim_make_aabb(enemy->position, enemy->collider.half_extents);
 
-            if (cf_aabb_to_aabb(bullet_aabb, enemy_aabb)) {
+            if (sim_aabb_to_aabb(bullet_aabb, enemy_aabb)) {
                 // Damage the enemy
                 enemy->health.current -= 1;
 
                 // Destroy bullet
                 bullet->is_alive = false;
 
-                // If enemy survives, push it upwards and spawn particles
+                // If enemy survives, push it upwards, effects follow from the events after collision
                 if (enemy->health.current > 0) {
-                    enemy->position.y += 5.0f;  // Push upwards by 5 pixels
-                    screenshake_add(&g_state->screenshake, 0.5f);
-                    play_sound(SOUND_HIT);
+                    enemy->position.y = sim_add(enemy->position.y, 5.0f);  // Push upwards by 5 pixels
+                    emit_gameplay_event(state, (GameplayEvent){
+                        .type     = GAMEPLAY_EVENT_HIT,
+                        .position = enemy->position,
+                        .data.hit = {.bullet_velocity = bullet->velocity},
+                    });
                 } else {
-                    g_state->score += enemy->score;
+                    state->score += enemy->score;
                     // Destroy enemy
                     enemy->is_alive = false;
 
-                    spawn_explosion(make_explosion(enemy->position));
-                    spawn_explosion_particle_burst(enemy->position, COLOR_SOURCE_ENEMY(enemy->type));
-                    spawn_floating_score(make_floating_score(enemy->position, enemy->score));
-                    screenshake_add(&g_state->screenshake, 1.0f);
-                    play_sound(SOUND_EXPLOSION);
+                    emit_gameplay_event(state, (GameplayEvent){
+                        .type      = GAMEPLAY_EVENT_KILL,
+                        .position  = enemy->position,
+                        .data.kill = {
+                            .bullet_velocity = bullet->velocity,
+                            .enemy_type      = enemy->type,
+                            .score           = enemy->score,
+                        },
+                    });
                 }
 
-                // Get bullet direction from velocity and reverse it
-                auto bullet_dir = cf_mul(cf_norm(bullet->velocity), -1.0f);
-
-                // Spawn white debris particles opposite to the bullet's direction
-                spawn_hit_particle_burst(5, enemy->position, bullet_dir);
-
                 // Bullet is destroyed, no need to check against more enemies
                 break;
             }
@@ -73,7 +71,8 @@ static void player_bullets_vs_enemies(
 }
 
 static void player_vs_threats(
-    const Player* restrict player,
+    GameState* state,
+    Player* restrict player,
     const size_t enemies_count,
     Enemy        enemies[static restrict enemies_count],
     const size_t enemy_bullets_count,
@@ -82,18 +81,18 @@ static void player_vs_threats(
     if (enemies_count == 0 && enemy_bullets_count == 0) { return; }
     if (!player->is_alive || player->is_invincible) { return; }
 
-    auto player_aabb = cf_make_aabb_center_half_extents(player->position, player->collider.half_extents);
+    auto player_aabb = sim_make_aabb(player->position, player->collider.half_extents);
 
     // Check collisions with enemies
     for (size_t i = 0; i < enemies_count; ++i) {
         if (!enemies[i].is_alive) { continue; }
 
         auto enemy      = &enemies[i];
-        auto enemy_aabb = cf_make_aabb_center_half_extents(enemy->position, enemy->collider.half_extents);
+        auto enemy_aabb = sim_make_aabb(enemy->position, enemy->collider.half_extents);
 
-        if (cf_aabb_to_aabb(player_aabb, enemy_aabb)) {
+        if (sim_aabb_to_aabb(player_aabb, enemy_aabb)) {
             enemy->is_alive = false;
-            damage_player();
+            damage_player(state, player);
             return;  // Player is dead, no need to check more collisions
         }
     }
@@ -103,21 +102,28 @@ static void player_vs_threats(
         if (!enemy_bullets[i].is_alive) { continue; }
 
         auto enemy_bullet = &enemy_bullets[i];
-        auto enemy_aabb = cf_make_aabb_center_half_extents(enemy_bullet->position, enemy_bullet->collider.half_extents);
+        auto enemy_aabb   = sim_make_aabb(enemy_bullet->position, enemy_bullet->collider.half_extents);
 
-        if (cf_aabb_to_aabb(player_aabb, enemy_aabb)) {
+        if (sim_aabb_to_aabb(player_aabb, enemy_aabb)) {
             enemy_bullet->is_alive = false;
-            damage_player();
+            damage_player(state, player);
             return;  // Player is dead, no need to check more collisions
         }
     }
 }
 
-void update_collision(void) {
+void update_collision(GameState* state) {
     player_bullets_vs_enemies(
-        g_state->player_bullets_count, g_state->player_bullets, g_state->enemies_count, g_state->enemies
-    );
-    player_vs_threats(
-        &g_state->player, g_state->enemies_count, g_state->enemies, g_state->enemy_bullets_count, g_state->enemy_bullets
+        state, state->player_bullets_count, state->player_bullets, state->enemies_count, state->enemies
     );
+    for (size_t i = 0; i < state->players_count; ++i) {
+        player_vs_threats(
+            state,
+            &state->players[i],
+            state->enemies_count,
+            state->enemies,
+            state->enemy_bullets_count,
+            state->enemy_bullets
+        );
+    }
 }
@@ -1,3 +1,5 @@
 #pragma once
 
-void update_collision(void);
+typedef struct GameState GameState;
+
+void update_collision(GameState* state);
@@ -1,6 +0,0 @@
-#pragma once
-#include <cute_coroutine.h>
-
-void init_coroutines(void);
-void cleanup_coroutines(void);
-void update_coroutine(void);
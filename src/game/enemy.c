@@ -7,11 +7,13 @@
 #include <stddef.h>
 
 #include "../engine/game_state.h"
-#include "asset/audio.h"
 #include "asset/sprite.h"
 #include "component.h"
+#include "gameplay_event.h"
+#include "sim_math.h"
+#include "soak.h"
 
-Enemy make_enemy_of_type(CF_V2 position, EnemyType type) {
+Enemy make_enemy_of_type(GameState* state, CF_V2 position, EnemyType type) {
     // Sprite
     Sprite sprite;
     int    score_value;
@@ -50,7 +52,7 @@ Enemy make_enemy_of_type(CF_V2 position, EnemyType type) {
     };
 
     // Sprite
-    enemy.sprite                = get_sprite(sprite);
+    enemy.sprite                = get_sprite(state, sprite);
 
     // Collider
     enemy.collider.half_extents = cf_v2(enemy.sprite.w / 3.0f, enemy.sprite.h / 3.0f);
@@ -59,22 +61,22 @@ Enemy make_enemy_of_type(CF_V2 position, EnemyType type) {
     enemy.health.current = enemy.health.maximum = health_value;
 
     // Weapon
-    enemy.cooldown                              = cf_rnd_range_float(&g_state->rnd, 2.5f, 6.5f);
-    enemy.time_since_shot                       = cf_rnd_range_float(&g_state->rnd, 0.0f, enemy.cooldown);
+    enemy.cooldown                              = sim_rnd_range(&state->rnd.gameplay, 2.5f, 6.5f);
+    enemy.time_since_shot                       = sim_rnd_range(&state->rnd.gameplay, 0.0f, enemy.cooldown);
     enemy.shoot_chance                          = 0.3f;  // 30% chance to shoot when cooldown ready
 
     return enemy;
 }
 
-Enemy make_random_enemy(CF_V2 position) {
+Enemy make_random_enemy(GameState* state, CF_V2 position) {
     EnemyType types[] = {ENEMY_TYPE_ALAN, ENEMY_TYPE_BON_BON, ENEMY_TYPE_LIPS};
-    int       type    = cf_rnd_range_int(&g_state->rnd, 0, 2);
-    return make_enemy_of_type(position, types[type]);
+    int       type    = cf_rnd_range_int(&state->rnd.gameplay, 0, 2);
+    return make_enemy_of_type(state, position, types[type]);
 }
 
 void set_enemy_shoot_chance(Enemy* enemy, float shoot_chance) { enemy->shoot_chance = shoot_chance; }
 
-EnemyBullet make_enemy_bullet(CF_V2 position, CF_V2 direction) {
+EnemyBullet make_enemy_bullet(GameState* state, CF_V2 position, CF_V2 direction) {
     EnemyBullet bullet = (EnemyBullet){
         .is_alive = true,
         .position = position,
@@ -85,7 +87,7 @@ EnemyBullet make_enemy_bullet(CF_V2 position, CF_V2 direction) {
     bullet.velocity.y            = ENEMY_BULLET_DEFAULT_SPEED * direction.y;
 
     // Sprite
-    bullet.sprite                = get_sprite(SPRITE_ENEMY_BULLET);
+    bullet.sprite                = get_sprite(state, SPRITE_ENEMY_BULLET);
     bullet.z_index               = Z_SPRITES;
 
     // Collider
@@ -94,51 +96,55 @@ EnemyBullet make_enemy_bullet(CF_V2 position, CF_V2 direction) {
     return bullet;
 }
 
-void spawn_enemy_bullet(EnemyBullet bullet) {
-    CF_ASSERT(g_state->enemy_bullets);
-    CF_ASSERT(g_state->enemy_bullets_count < g_state->enemy_bullets_capacity);
+void spawn_enemy_bullet(GameState* state, EnemyBullet bullet) {
+    CF_ASSERT(state->enemy_bullets);
+    if (claim_pool_slots(state, SOAK_POOL_ENEMY_BULLETS, 1) == 0) { return; }
 
-    g_state->enemy_bullets[g_state->enemy_bullets_count++] = bullet;
+    state->enemy_bullets[state->enemy_bullets_count++] = bullet;
 }
 
-void spawn_enemy(Enemy enemy) {
-    CF_ASSERT(g_state->enemies);
-    CF_ASSERT(g_state->enemies_count < g_state->enemies_capacity - 1);
+void spawn_enemy(GameState* state, Enemy enemy) {
+    CF_ASSERT(state->enemies);
+    if (claim_pool_slots(state, SOAK_POOL_ENEMIES, 1) == 0) { return; }
 
-    g_state->enemies[g_state->enemies_count++] = enemy;
+    state->enemies[state->enemies_count++] = enemy;
 }
 
-void update_enemy(Enemy* enemy) {
+void update_enemy(GameState* state, Enemy* enemy) {
     // Update time since shot
-    enemy->time_since_shot += CF_DELTA_TIME;
+    sim_count_up(&enemy->time_since_shot);
 
     // Check if cooldown is ready
     if (enemy->time_since_shot >= enemy->cooldown) {
         // Random chance to shoot
-        float random_value = cf_rnd_float(&g_state->rnd);
+        float random_value = cf_rnd_float(&state->rnd.gameplay);
         if (random_value < enemy->shoot_chance) {
             enemy->time_since_shot = 0.0f;
 
             // Shoot downward (toward player)
-            spawn_enemy_bullet(make_enemy_bullet(enemy->position, cf_v2(0, -1)));
+            spawn_enemy_bullet(state, make_enemy_bullet(state, enemy->position, cf_v2(0, -1)));
 
-            play_sound(SOUND_LASER);
+            emit_gameplay_event(state, (GameplayEvent){
+                .type      = GAMEPLAY_EVENT_SHOT,
+                .position  = enemy->position,
+                .data.shot = {.is_enemy = true},
+            });
         }
     }
 }
 
-void cleanup_enemies(void) {
+void cleanup_enemies(GameState* state) {
     int write_idx = 0;
-    for (size_t i = 0; i < g_state->enemies_count; i++) {
-        if (g_state->enemies[i].is_alive) { g_state->enemies[write_idx++] = g_state->enemies[i]; }
+    for (size_t i = 0; i < state->enemies_count; i++) {
+        if (state->enemies[i].is_alive) { state->enemies[write_idx++] = state->enemies[i]; }
     }
-    g_state->enemies_count = write_idx;
+    state->enemies_count = write_idx;
 }
 
-void cleanup_enemy_bullets(void) {
+void cleanup_enemy_bullets(GameState* state) {
     int write_idx = 0;
-    for (size_t i = 0; i < g_state->enemy_bullets_count; i++) {
-        if (g_state->enemy_bullets[i].is_alive) { g_state->enemy_bullets[write_idx++] = g_state->enemy_bullets[i]; }
+    for (size_t i = 0; i < state->enemy_bullets_count; i++) {
+        if (state->enemy_bullets[i].is_alive) { state->enemy_bullets[write_idx++] = state->enemy_bullets[i]; }
     }
-    g_state->enemy_bullets_count = write_idx;
+    state->enemy_bullets_count = write_idx;
 }
@@ -5,6 +5,8 @@
 
 #include "component.h"
 
+typedef struct GameState GameState;
+
 constexpr float ENEMY_BULLET_DEFAULT_SPEED = 1.22f;
 constexpr float ENEMY_DEFAULT_SPEED        = 0.5f;
 
@@ -44,12 +46,12 @@ typedef struct EnemyBullet {
     ZIndex    z_index;  // Rendering order
 } EnemyBullet;
 
-Enemy       make_enemy_of_type(CF_V2 position, EnemyType type);
-Enemy       make_random_enemy(CF_V2 position);
+Enemy       make_enemy_of_type(GameState* state, CF_V2 position, EnemyType type);
+Enemy       make_random_enemy(GameState* state, CF_V2 position);
 void        set_enemy_shoot_chance(Enemy* enemy, float shoot_chance);
-EnemyBullet make_enemy_bullet(CF_V2 position, CF_V2 direction);
-void        spawn_enemy_bullet(EnemyBullet bullet);
-void        spawn_enemy(Enemy enemy);
-void        update_enemy(Enemy* enemy);
-void        cleanup_enemies(void);
-void        cleanup_enemy_bullets(void);
+EnemyBullet make_enemy_bullet(GameState* state, CF_V2 position, CF_V2 direction);
+void        spawn_enemy_bullet(GameState* state, EnemyBullet bullet);
+void        spawn_enemy(GameState* state, Enemy enemy);
+void        update_enemy(GameState* state, Enemy* enemy);
+void        cleanup_enemies(GameState* state);
+void        cleanup_enemy_bullets(GameState* state);
@@ -8,8 +8,9 @@
 #include "../engine/game_state.h"
 #include "asset/sprite.h"
 #include "component.h"
+#include "soak.h"
 
-Explosion make_explosion(CF_V2 position) {
+Explosion make_explosion(GameState* state, CF_V2 position) {
     Explosion explosion = (Explosion){
         .position = position,
         .z_index  = Z_SPRITES,
@@ -17,22 +18,22 @@ Explosion make_explosion(CF_V2 position) {
     };
 
     // Sprite
-    explosion.sprite = get_sprite(SPRITE_EXPLOSION);
+    explosion.sprite = get_sprite(state, SPRITE_EXPLOSION);
     cf_sprite_set_loop(&explosion.sprite, false);
 
     return explosion;
 }
 
-void spawn_explosion(Explosion explosion) {
-    CF_ASSERT(g_state->explosions);
-    CF_ASSERT(g_state->explosions_count <= g_state->explosions_capacity);
-    g_state->explosions[g_state->explosions_count++] = explosion;
+void spawn_explosion(GameState* state, Explosion explosion) {
+    CF_ASSERT(state->explosions);
+    if (claim_pool_slots(state, SOAK_POOL_EXPLOSIONS, 1) == 0) { return; }
+    state->explosions[state->explosions_count++] = explosion;
 }
 
-void cleanup_explosions(void) {
+void cleanup_explosions(GameState* state) {
     // Mark finished explosions as dead
-    for (size_t i = 0; i < g_state->explosions_count; ++i) {
-        auto explosion = &g_state->explosions[i];
+    for (size_t i = 0; i < state->explosions_count; ++i) {
+        auto explosion = &state->explosions[i];
 
         if (!explosion->is_alive) continue;
 
@@ -43,8 +44,8 @@ void cleanup_explosions(void) {
 
     size_t write_idx = 0;
     // Cleanup explosions array
-    for (size_t i = 0; i < g_state->explosions_count; ++i) {
-        if (g_state->explosions[i].is_alive) { g_state->explosions[write_idx++] = g_state->explosions[i]; }
+    for (size_t i = 0; i < state->explosions_count; ++i) {
+        if (state->explosions[i].is_alive) { state->explosions[write_idx++] = state->explosions[i]; }
     }
-    g_state->explosions_count = write_idx;
+    state->explosions_count = write_idx;
 }
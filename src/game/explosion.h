@@ -5,6 +5,8 @@
 
 #include "component.h"
 
+typedef struct GameState GameState;
+
 typedef struct Explosion {
     CF_V2     position;
     CF_V2     velocity;
@@ -14,6 +16,6 @@ typedef struct Explosion {
     ZIndex    z_index;  // Rendering order
 } Explosion;
 
-Explosion make_explosion(CF_V2 position);
-void      spawn_explosion(Explosion explosion);
-void      cleanup_explosions(void);
+Explosion make_explosion(GameState* state, CF_V2 position);
+void      spawn_explosion(GameState* state, Explosion explosion);
+void      cleanup_explosions(GameState* state);
@@ -2,138 +2,140 @@
 
 #include <cute_c_runtime.h>
 #include <cute_color.h>
-#include <cute_draw.h>
 #include <cute_math.h>
 #include <cute_rnd.h>
 #include <cute_sprite.h>
 #include <cute_time.h>
 #include <stddef.h>
-#include <string.h>
+#include <stdint.h>
 
-#include "../engine/common.h"
-#include "../engine/cute_macros.h"
 #include "../engine/game_state.h"
 #include "component.h"
 #include "enemy.h"
 #include "movement.h"
-
-static CF_Color sample_sprite_color(const EnemyType enemy_type) {
-    // TODO: Precompute these and store in static
-    CF_Color colors[ENEMY_TYPE_COUNT][3] = {
-        [ENEMY_TYPE_ALAN] =
-            {
-                               cf_make_color_hex(0x77cc2a),
-                               cf_make_color_hex(0x077d53),
-                               cf_make_color_hex(0xffc41f),
-                               },
-        [ENEMY_TYPE_BON_BON] =
-            {
-                               cf_make_color_hex(0xffc41f),
-                               cf_make_color_hex(0xe67300),
-                               cf_make_color_hex(0xf2f1f0),
-                               },
-        [ENEMY_TYPE_LIPS] = {
-                               cf_make_color_hex(0xea58ad),
-                               cf_make_color_hex(0x9e1328),
-                               cf_make_color_hex(0xffacbf),
-                               }
-    };
-
-    int      index = cf_rnd_range_int(&g_state->rnd, 0, lengthof(colors[enemy_type]));
-    CF_Color color = colors[enemy_type][index];
-
-    return color;
-}
-
-static CF_Color sample_player_sprite_color(void) {
-    CF_Color colors[] = {
-        cf_make_color_hex(0x9e1328),
-        cf_make_color_hex(0xff4646),
-        cf_make_color_hex(0x20a3f8),
-        cf_make_color_hex(0xf2f1f0),
-    };
-
-    int      index = cf_rnd_range_int(&g_state->rnd, 0, lengthof(colors));
-    CF_Color color = colors[index];
-
-    return color;
+#include "render_queue.h"
+#include "sim_math.h"
+#include "soak.h"
+
+// Every color an explosion can take, enemy palettes first and the player palette last
+static const int s_palette_hex[EXPLOSION_PALETTE_SIZE] = {
+    // ENEMY_TYPE_ALAN
+    0x77cc2a,
+    0x077d53,
+    0xffc41f,
+    // ENEMY_TYPE_BON_BON
+    0xffc41f,
+    0xe67300,
+    0xf2f1f0,
+    // ENEMY_TYPE_LIPS
+    0xea58ad,
+    0x9e1328,
+    0xffacbf,
+    // Player
+    0x9e1328,
+    0xff4646,
+    0x20a3f8,
+    0xf2f1f0,
+};
+
+typedef struct PaletteRange {
+    uint8_t first;
+    uint8_t count;
+} PaletteRange;
+
+static const PaletteRange s_enemy_palettes[ENEMY_TYPE_COUNT] = {
+    [ENEMY_TYPE_ALAN]    = {.first = 0, .count = 3},
+    [ENEMY_TYPE_BON_BON] = {.first = 3, .count = 3},
+    [ENEMY_TYPE_LIPS]    = {.first = 6, .count = 3},
+};
+static const PaletteRange s_player_palette = {.first = 9, .count = 4};
+
+static uint8_t sample_palette_index(GameState* state, const ColorSource source) {
+    const PaletteRange range =
+        source.type == COLOR_SOURCE_TYPE_PLAYER ? s_player_palette : s_enemy_palettes[source.data.enemy_type];
+
+    return (uint8_t)(range.first + cf_rnd_range_int(&state->rnd.particles, 0, range.count - 1));
 }
 
-static CF_Color sample_color_from_source(ColorSource source) {
-    if (source.type == COLOR_SOURCE_TYPE_PLAYER) {
-        return sample_player_sprite_color();
-    } else {
-        return sample_sprite_color(source.data.enemy_type);
+void bake_explosion_palette(GameState* state) {
+    // One pre-tinted 1x1 sprite per palette entry, so particles draw with the default shader
+    for (int i = 0; i < EXPLOSION_PALETTE_SIZE; ++i) {
+        const CF_Pixel pixel = cf_color_to_pixel(cf_make_color_hex(s_palette_hex[i]));
+        state->sprites.explosion_palette[i] = cf_make_easy_sprite_from_pixels(&pixel, 1, 1);
     }
 }
 
-ExplosionParticle make_explosion_particle(CF_V2 position, CF_Color color, float angle) {
-    float speed                = cf_rnd_range_float(&g_state->rnd, 0.5f, 1.0f);
+ExplosionParticle make_explosion_particle(GameState* state, CF_V2 position, uint8_t palette_index, float angle) {
+    CF_ASSERT(palette_index < EXPLOSION_PALETTE_SIZE);
+    float speed                = sim_rnd_range(&state->rnd.particles, 0.5f, 1.0f);
 
     ExplosionParticle particle = (ExplosionParticle){
-        .is_alive   = true,
-        .position   = position,
-        .velocity   = cf_v2(CF_COSF(angle) * speed, CF_SINF(angle) * speed),
-        .lifetime   = cf_rnd_range_float(&g_state->rnd, 0.5f, 0.8f),
-        .time_alive = 0.0f,
-        .size       = (float)cf_rnd_range_int(&g_state->rnd, 1, 2),
-        .color      = color,
-        .sprite     = g_state->sprites.particle,
+        .is_alive      = true,
+        .position      = position,
+        .velocity      = sim_polar(angle, speed),
+        .lifetime      = sim_rnd_range(&state->rnd.particles, 0.5f, 0.8f),
+        .time_alive    = 0.0f,
+        .size          = (float)cf_rnd_range_int(&state->rnd.particles, 1, 2),
+        .palette_index = palette_index,
+        .sprite        = state->sprites.explosion_palette[palette_index],
     };
 
     return particle;
 }
 
-void spawn_explosion_particle(ExplosionParticle particle) {
-    CF_ASSERT(g_state->explosion_particles);
-    CF_ASSERT(g_state->explosion_particles_count < g_state->explosion_particles_capacity);
+void spawn_explosion_particle(GameState* state, ExplosionParticle particle) {
+    CF_ASSERT(state->explosion_particles);
+    if (claim_pool_slots(state, SOAK_POOL_EXPLOSION_PARTICLES, 1) == 0) { return; }
 
-    g_state->explosion_particles[g_state->explosion_particles_count++] = particle;
+    state->explosion_particles[state->explosion_particles_count++] = particle;
 }
 
-void spawn_explosion_particles(size_t count, const ExplosionParticle particles[static restrict count]) {
-    CF_ASSERT(g_state->explosion_particles_count + count <= g_state->explosion_particles_capacity);
+void spawn_explosion_particles(
+    GameState* state, size_t count, const ExplosionParticle particles[static restrict count]
+) {
+    // A nearly full pool takes the start of the burst
+    count = claim_pool_slots(state, SOAK_POOL_EXPLOSION_PARTICLES, count);
 
-    CF_MEMCPY(&g_state->explosion_particles[g_state->explosion_particles_count], particles, count * sizeof(*particles));
+    CF_MEMCPY(&state->explosion_particles[state->explosion_particles_count], particles, count * sizeof(*particles));
 
-    g_state->explosion_particles_count += count;
+    state->explosion_particles_count += count;
 }
 
-void spawn_explosion_particle_burst(CF_V2 pos, const ColorSource color_source) {
+void spawn_explosion_particle_burst(GameState* state, CF_V2 pos, const ColorSource color_source) {
     // Create radial burst of particles
     constexpr size_t  particle_count = 10;
     ExplosionParticle burst[particle_count];
 
     for (size_t i = 0; i < particle_count; ++i) {
-        CF_Color color = sample_color_from_source(color_source);
+        uint8_t palette_index = sample_palette_index(state, color_source);
         // Calculate angle for radial dispersion (360 degrees)
-        float angle    = (float)i / (float)particle_count * CF_PI * 2.0f;
-        burst[i]       = make_explosion_particle(pos, color, angle);
+        float   angle         = (float)i / (float)particle_count * CF_PI * 2.0f;
+        burst[i]              = make_explosion_particle(state, pos, palette_index, angle);
     }
 
-    spawn_explosion_particles(particle_count, burst);
+    spawn_explosion_particles(state, particle_count, burst);
 }
 
-void cleanup_explosion_particles() {
+void cleanup_explosion_particles(GameState* state) {
     size_t write_idx = 0;
 
-    for (size_t i = 0; i < g_state->explosion_particles_count; i++) {
-        if (g_state->explosion_particles[i].is_alive) {
-            g_state->explosion_particles[write_idx++] = g_state->explosion_particles[i];
+    for (size_t i = 0; i < state->explosion_particles_count; i++) {
+        if (state->explosion_particles[i].is_alive) {
+            state->explosion_particles[write_idx++] = state->explosion_particles[i];
         }
     }
 
-    g_state->explosion_particles_count = write_idx;
+    state->explosion_particles_count = write_idx;
 }
 
-void update_explosion_particles() {
-    for (size_t i = 0; i < g_state->explosion_particles_count; ++i) {
-        auto particle = &g_state->explosion_particles[i];
+void update_explosion_particles(GameState* state) {
+    for (size_t i = 0; i < state->explosion_particles_count; ++i) {
+        auto particle = &state->explosion_particles[i];
 
         if (!particle->is_alive) { continue; }
 
         // Update particle lifetime
-        particle->time_alive += CF_DELTA_TIME;
+        sim_count_up(&particle->time_alive);
 
         // Destroy particle if lifetime exceeded
         if (particle->time_alive >= particle->lifetime) {
@@ -150,25 +152,12 @@ void update_explosion_particles() {
     }
 }
 
-void render_explosion_particles() {
-    // Render explosion particles with colors
-    cf_draw_push_shader(g_state->recolor);
-    for (size_t i = 0; i < g_state->explosion_particles_count; i++) {
-        cf_draw() {
-            cf_draw_layer(Z_PARTICLES) {
-                cf_draw_translate_v2(g_state->explosion_particles[i].position);
-                cf_draw_scale(g_state->explosion_particles[i].size, g_state->explosion_particles[i].size);
-                // Apply color to the sprite
-                cf_draw_push_vertex_attributes(
-                    g_state->explosion_particles[i].color.r,
-                    g_state->explosion_particles[i].color.g,
-                    g_state->explosion_particles[i].color.b,
-                    1.0f
-                );
-                cf_draw_sprite(&g_state->explosion_particles[i].sprite);
-                cf_draw_pop_vertex_attributes();
-            }
-        }
+void render_explosion_particles(GameState* state) {
+    // Sprites are already tinted, so these batch with the other particles
+    for (size_t i = 0; i < state->explosion_particles_count; i++) {
+        auto particle = &state->explosion_particles[i];
+        render_queue_push_sprite(
+            state, &particle->sprite, particle->position, cf_v2(particle->size, particle->size), Z_PARTICLES
+        );
     }
-    cf_draw_pop_shader();
 }
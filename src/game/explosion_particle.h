@@ -4,9 +4,14 @@
 #include <cute_math.h>
 #include <cute_sprite.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "../game/enemy.h"
 
+typedef struct GameState GameState;
+
+constexpr int EXPLOSION_PALETTE_SIZE = 13;
+
 #define COLOR_SOURCE_PLAYER()  ((ColorSource){.type = COLOR_SOURCE_TYPE_PLAYER})
 #define COLOR_SOURCE_ENEMY(et) ((ColorSource){.type = COLOR_SOURCE_TYPE_ENEMY, .data.enemy_type = (et)})
 
@@ -25,18 +30,21 @@ typedef struct ColorSource {
 typedef struct ExplosionParticle {
     CF_V2     position;
     CF_V2     velocity;
-    CF_Sprite sprite;
-    CF_Color  color;       // Sampled color from enemy sprite
-    float     lifetime;    // Total lifetime in seconds
-    float     time_alive;  // Time alive in seconds
-    float     size;        // Particle size scale
+    CF_Sprite sprite;         // Copy of the baked palette sprite, for per-particle opacity
+    float     lifetime;       // Total lifetime in seconds
+    float     time_alive;     // Time alive in seconds
+    float     size;           // Particle size scale
+    uint8_t   palette_index;  // Color sampled from the source sprite
     bool      is_alive;
 } ExplosionParticle;
 
-ExplosionParticle make_explosion_particle(CF_V2 position, CF_Color color, float angle);
-void              spawn_explosion_particle(ExplosionParticle particle);
-void              spawn_explosion_particles(size_t count, const ExplosionParticle particles[static restrict count]);
-void              spawn_explosion_particle_burst(CF_V2 pos, const ColorSource color_source);
-void              cleanup_explosion_particles(void);
-void              update_explosion_particles(void);
-void              render_explosion_particles(void);
+void              bake_explosion_palette(GameState* state);
+ExplosionParticle make_explosion_particle(GameState* state, CF_V2 position, uint8_t palette_index, float angle);
+void              spawn_explosion_particle(GameState* state, ExplosionParticle particle);
+void              spawn_explosion_particles(
+    GameState* state, size_t count, const ExplosionParticle particles[static restrict count]
+);
+void              spawn_explosion_particle_burst(GameState* state, CF_V2 pos, const ColorSource color_source);
+void              cleanup_explosion_particles(GameState* state);
+void              update_explosion_particles(GameState* state);
+void              render_explosion_particles(GameState* state);
@@ -2,15 +2,16 @@
 
 #include <cute_c_runtime.h>
 #include <cute_color.h>
-#include <cute_draw.h>
 #include <cute_math.h>
 #include <cute_time.h>
 #include <stddef.h>
-#include <stdio.h>
 
-#include "../engine/cute_macros.h"
 #include "../engine/game_state.h"
 #include "component.h"
+#include "gfx.h"
+#include "sim_math.h"
+#include "soak.h"
+#include "text_cache.h"
 
 constexpr float FLOATING_SCORE_SPEED    = 0.85f;
 constexpr float FLOATING_SCORE_LIFETIME = 1.0f;
@@ -26,22 +27,22 @@ FloatingScore make_floating_score(CF_V2 position, int score) {
     };
 }
 
-void spawn_floating_score(FloatingScore floating_score) {
-    CF_ASSERT(g_state->floating_scores);
-    CF_ASSERT(g_state->floating_scores_count < g_state->floating_scores_capacity);
-    g_state->floating_scores[g_state->floating_scores_count++] = floating_score;
+void spawn_floating_score(GameState* state, FloatingScore floating_score) {
+    CF_ASSERT(state->floating_scores);
+    if (claim_pool_slots(state, SOAK_POOL_FLOATING_SCORES, 1) == 0) { return; }
+    state->floating_scores[state->floating_scores_count++] = floating_score;
 }
 
-void update_floating_scores(void) {
-    for (size_t i = 0; i < g_state->floating_scores_count; i++) {
-        auto score = &g_state->floating_scores[i];
+void update_floating_scores(GameState* state) {
+    for (size_t i = 0; i < state->floating_scores_count; i++) {
+        auto score = &state->floating_scores[i];
         if (!score->is_alive) { continue; }
 
         // Move upward
-        score->position.y += score->velocity.y;
+        score->position.y = sim_add(score->position.y, score->velocity.y);
 
         // Update lifetime
-        score->lifetime -= CF_DELTA_TIME;
+        sim_count_down(&score->lifetime);
 
         // Fade out
         score->alpha = score->lifetime / FLOATING_SCORE_LIFETIME;
@@ -51,36 +52,30 @@ void update_floating_scores(void) {
     }
 }
 
-void render_floating_scores(void) {
-    for (size_t i = 0; i < g_state->floating_scores_count; i++) {
-        auto score = &g_state->floating_scores[i];
+void render_floating_scores(GameState* state) {
+    for (size_t i = 0; i < state->floating_scores_count; i++) {
+        auto score = &state->floating_scores[i];
         if (!score->is_alive) { continue; }
 
-        char score_text[16];
-        snprintf(score_text, sizeof(score_text), "%d", score->score);
+        const TextRun* run = text_cache_get_int(&state->text_cache, "TinyAndChunky", 7, "%d", score->score);
 
-        cf_draw() {
-            cf_font("TinyAndChunky") {
-                cf_push_font_size(7);
-                float text_width = cf_text_width(score_text, -1);
-
-                cf_draw_layer(Z_UI) {
-                    // Draw with alpha for fade effect
-                    cf_draw_color(cf_make_color_rgba(255, 255, 255, (int)(score->alpha * 255))) {
-                        cf_draw_text(score_text, cf_v2(score->position.x - text_width / 2.0f, score->position.y), -1);
-                    }
+        gfx_draw(state) {
+            gfx_draw_layer(state, Z_UI) {
+                // Draw with alpha for fade effect
+                gfx_draw_color(state, cf_make_color_rgba(255, 255, 255, (int)(score->alpha * 255))) {
+                    draw_text_run(state, run, cf_v2(score->position.x - run->width / 2.0f, score->position.y));
                 }
             }
         }
     }
 }
 
-void cleanup_floating_scores(void) {
+void cleanup_floating_scores(GameState* state) {
     int write_idx = 0;
-    for (size_t i = 0; i < g_state->floating_scores_count; i++) {
-        if (g_state->floating_scores[i].is_alive) {
-            g_state->floating_scores[write_idx++] = g_state->floating_scores[i];
+    for (size_t i = 0; i < state->floating_scores_count; i++) {
+        if (state->floating_scores[i].is_alive) {
+            state->floating_scores[write_idx++] = state->floating_scores[i];
         }
     }
-    g_state->floating_scores_count = write_idx;
+    state->floating_scores_count = write_idx;
 }
@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+typedef struct GameState GameState;
+
 typedef struct FloatingScore {
     CF_V2 position;
     CF_V2 velocity;
@@ -14,7 +16,7 @@ typedef struct FloatingScore {
 } FloatingScore;
 
 FloatingScore make_floating_score(CF_V2 position, int score);
-void          spawn_floating_score(FloatingScore floating_score);
-void          update_floating_scores(void);
-void          render_floating_scores(void);
-void          cleanup_floating_scores(void);
+void          spawn_floating_score(GameState* state, FloatingScore floating_score);
+void          update_floating_scores(GameState* state);
+void          render_floating_scores(GameState* state);
+void          cleanup_floating_scores(GameState* state);
@@ -6,6 +6,7 @@
 
 #include "../engine/common.h"
 #include "enemy.h"
+#include "sim_math.h"
 
 // Define the actual formations
 static const FormationPoint line_horizontal_points[] = {
@@ -107,25 +108,25 @@ const Formation FORMATION_WAVE = {
 };
 
 // Spawner implementation
-void formation_spawn(const Formation* formation, CF_V2 origin, EnemyType enemy_type) {
+void formation_spawn(GameState* state, const Formation* formation, CF_V2 origin, EnemyType enemy_type) {
     for (size_t i = 0; i < formation->points_count; ++i) {
         const FormationPoint* point     = &formation->points[i];
-        CF_V2                 world_pos = {origin.x + point->x_offset, origin.y + point->y_offset};
-        auto                  enemy     = make_enemy_of_type(world_pos, enemy_type);
+        CF_V2                 world_pos = sim_add_v2(origin, cf_v2(point->x_offset, point->y_offset));
+        auto                  enemy     = make_enemy_of_type(state, world_pos, enemy_type);
 
-        spawn_enemy(enemy);
+        spawn_enemy(state, enemy);
     }
 }
 
 void formation_spawn_with_shoot_chance(
-    const Formation* formation, CF_V2 origin, EnemyType enemy_type, float shoot_chance
+    GameState* state, const Formation* formation, CF_V2 origin, EnemyType enemy_type, float shoot_chance
 ) {
     for (size_t i = 0; i < formation->points_count; ++i) {
         const FormationPoint* point     = &formation->points[i];
-        CF_V2                 world_pos = {origin.x + point->x_offset, origin.y + point->y_offset};
-        auto                  enemy     = make_enemy_of_type(world_pos, enemy_type);
+        CF_V2                 world_pos = sim_add_v2(origin, cf_v2(point->x_offset, point->y_offset));
+        auto                  enemy     = make_enemy_of_type(state, world_pos, enemy_type);
 
         set_enemy_shoot_chance(&enemy, shoot_chance);
-        spawn_enemy(enemy);
+        spawn_enemy(state, enemy);
     }
 }
@@ -6,6 +6,8 @@
 
 #include "enemy.h"
 
+typedef struct GameState GameState;
+
 typedef struct {
     float x_offset;
     float y_offset;
@@ -27,7 +29,7 @@ extern const Formation FORMATION_V_SHAPE;
 extern const Formation FORMATION_WAVE;
 
 // Spawner functions
-void formation_spawn(const Formation* formation, CF_V2 origin, EnemyType enemy_type);
+void formation_spawn(GameState* state, const Formation* formation, CF_V2 origin, EnemyType enemy_type);
 void formation_spawn_with_shoot_chance(
-    const Formation* formation, CF_V2 origin, EnemyType enemy_type, float shoot_chance
+    GameState* state, const Formation* formation, CF_V2 origin, EnemyType enemy_type, float shoot_chance
 );
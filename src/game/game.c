@@ -9,250 +9,422 @@
 #include <cute_graphics.h>
 #include <cute_input.h>
 #include <cute_math.h>
-#include <cute_rnd.h>
 #include <cute_sprite.h>
 #include <cute_time.h>
 #include <dcimgui.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 
-#include "../engine/cute_macros.h"
+#include "../engine/arena.h"
+#include "../engine/common.h"
 #include "../engine/game_state.h"
 #include "../engine/log.h"
 #include "asset/audio.h"
 #include "asset/font.h"
+#include "asset/loader.h"
 #include "asset/sprite.h"
 #include "background_scroll.h"
 #include "collision.h"
 #include "component.h"
-#include "coroutine.h"
 #include "enemy.h"
 #include "explosion.h"
 #include "explosion_particle.h"
 #include "floating_score.h"
+#include "gameplay_event.h"
+#include "gfx.h"
 #include "hit_particle.h"
+#include "hud.h"
 #include "input.h"
 #include "movement.h"
 #include "player.h"
 #include "player_bullet.h"
 #include "render.h"
+#include "render_queue.h"
+#include "rewind.h"
+#include "rnd_stream.h"
+#include "rollback.h"
 #include "screenshake.h"
-#include "star_particle.h"
-
-#ifdef CF_RUNTIME_SHADER_COMPILATION
-const char s_recolor[] = {
-    #embed "recolor.glsl"
-    , '\0'  // null terminator
-};
-#else
-    #include "recolor_glsl.h"
-#endif
-
-GameState* g_state = nullptr;
+#include "sim_math.h"
+#include "snapshot.h"
+#include "soak.h"
+#include "spawner.h"
+#include "star_field.h"
+#include "state_layout.h"
+#include "text_cache.h"
+#include "voice.h"
+
+// Solo players start in the middle, co-op players side by side
+static float get_player_spawn_x(GameState* state, size_t index) {
+    if (state->players_count == 1) { return 0.0f; }
+    return (index == 0 ? -1.0f : 1.0f) * state->canvas_size.x / 6;
+}
 
-static void reset_game(void) {
+static void reset_game(GameState* state) {
     // Reset game state
-    g_state->is_game_over              = false;
-    g_state->lives                     = 3;
-    g_state->score                     = 0;
+    state->is_game_over              = false;
+    state->lives                     = 3;
+    state->score                     = 0;
 
     // Reset wave system
-    g_state->wave.current_wave         = 0;
-    g_state->wave.announcement_timer   = 0.0f;
-    g_state->wave.is_announcing        = true;
-
-    // Reset player
-    g_state->player                    = make_player(0.0f, -g_state->canvas_size.y / 3);
+    state->wave.current_wave         = 0;
+    state->wave.announcement_timer   = 0.0f;
+    state->wave.is_announcing        = true;
+
+    // Reset players, keeping the solo or co-op count
+    if (state->players_count == 0) { state->players_count = 1; }
+    for (size_t i = 0; i < state->players_count; ++i) {
+        state->players[i] = make_player(state, get_player_spawn_x(state, i), -state->canvas_size.y / 3);
+    }
 
     // Clear all entities
-    g_state->player_bullets_count      = 0;
-    g_state->enemies_count             = 0;
-    g_state->enemy_bullets_count       = 0;
-    g_state->explosions_count          = 0;
-    g_state->hit_particles_count       = 0;
-    g_state->explosion_particles_count = 0;
-    g_state->star_particles_count      = 0;
-    g_state->floating_scores_count     = 0;
-
-    // Re-initialize star particles
-    init_star_particles();
-
-    // Restart coroutines
-    cleanup_coroutines();
-    init_coroutines();
+    state->player_bullets_count      = 0;
+    state->enemies_count             = 0;
+    state->enemy_bullets_count       = 0;
+    state->explosions_count          = 0;
+    state->hit_particles_count       = 0;
+    state->explosion_particles_count = 0;
+    state->floating_scores_count     = 0;
+
+    // Restart the wave scripts
+    state->spawner                   = make_spawner();
 }
 
-EXPORT void game_init(Platform* platform) {
-    g_state = platform->allocate_memory(sizeof(GameState));
+// What game_init() allocates before the rollback ticks, which are optional and come last. A profile written by
+// another build may not cover it, so autosized capacities never go below it.
+static size_t get_permanent_init_bytes(void) {
+    const size_t sizes[] = {
+#ifdef DEBUG
+        REWIND_BUFFER_SIZE,
+        REWIND_MAX_FRAMES * sizeof(RewindFrame),
+#endif
+        GFX_RECORD_BUFFER_SIZE,
+        RENDER_QUEUE_CAPACITY * sizeof(RenderItem),
+        RENDER_QUEUE_CAPACITY * sizeof(RenderSortEntry),
+        RENDER_QUEUE_CAPACITY * sizeof(RenderSortEntry),
+    };
+    return get_arena_footprint(sizes, countof(sizes), DEFAULT_ARENA_ALIGNMENT);
+}
 
-    load_sprites();
-    prefetch_sprites();
+static size_t get_stage_init_bytes(void) {
+    const size_t sizes[] = {
+        MAX_ENEMIES * sizeof(Enemy),
+        MAX_ENEMY_BULLETS * sizeof(EnemyBullet),
+        MAX_EXPLOSIONS * sizeof(Explosion),
+        MAX_EXPLOSION_PARTICLES * sizeof(ExplosionParticle),
+        MAX_FLOATING_SCORES * sizeof(FloatingScore),
+        MAX_HIT_PARTICLES * sizeof(HitParticle),
+        MAX_PLAYER_BULLETS * sizeof(PlayerBullet),
+    };
+    return get_arena_footprint(sizes, countof(sizes), DEFAULT_ARENA_ALIGNMENT);
+}
 
-    g_state->display_id             = cf_default_display();
-    g_state->platform               = platform;
-    g_state->canvas_size            = cf_v2(CANVAS_WIDTH, CANVAS_HEIGHT);
-    g_state->scale                  = CANVAS_SCALE;
-    g_state->permanent_arena        = cf_make_arena(DEFAULT_ARENA_ALIGNMENT, PERMANENT_ARENA_SIZE);
-    g_state->stage_arena            = cf_make_arena(DEFAULT_ARENA_ALIGNMENT, STAGE_ARENA_SIZE);
-    g_state->scratch_arena          = cf_make_arena(DEFAULT_ARENA_ALIGNMENT, SCRATCH_ARENA_SIZE);
-    g_state->rnd                    = cf_rnd_seed((uint32_t)time(nullptr));
-    g_state->debug_bounding_boxes   = false;
-    g_state->coroutines.initialized = false;
+static Arena make_game_arena(const char* name, size_t default_capacity, size_t init_bytes, ArenaFlags flags) {
+#if ARENA_AUTOSIZE
+    // Reserve what a previous session actually used instead of the fixed defaults
+    const size_t capacity = get_profiled_arena_capacity(name, default_capacity, init_bytes);
+    APP_INFO("Arena %s sized to %zu bytes from %s, %zu needed at init", name, capacity, ARENA_PROFILE_PATH, init_bytes);
+#else
+    (void)init_bytes;
+    const size_t capacity = default_capacity;
+#endif
 
-    g_state->background_scroll      = make_background_scroll();
+    return make_arena(name, DEFAULT_ARENA_ALIGNMENT, capacity, flags);
+}
 
-    /**
-     * Shaders
-     */
-#ifdef CF_RUNTIME_SHADER_COMPILATION
-    g_state->recolor = cf_make_draw_shader_from_source(s_recolor);
-#else
-    g_state->recolor = cf_make_draw_shader_from_bytecode(s_recolor_bytecode);
+Arena make_stage_arena(void) {
+    return make_game_arena("stage", STAGE_ARENA_SIZE, get_stage_init_bytes(), ARENA_FLAG_HUGE_PAGES);
+}
+
+EXPORT void* game_init(Platform* platform) {
+    set_log_ring(platform->log_ring);
+
+    GameState* state   = platform->allocate_memory(sizeof(GameState));
+    state->platform    = platform;
+    state->is_headless = platform->is_headless;
+    write_state_header(state);
+
+    // Headless instances keep the sprites for their animations, but never upload them
+    allocation_tag(state, ALLOCATION_TAG_ASSETS) {
+        load_sprites(state);
+        if (!state->is_headless) { prefetch_sprites(state); }
+    }
+
+    const size_t permanent_init = get_permanent_init_bytes();
+
+    state->display_id             = cf_default_display();
+    state->canvas_size            = cf_v2(CANVAS_WIDTH, CANVAS_HEIGHT);
+    state->scale                  = CANVAS_SCALE;
+    state->permanent_arena        = make_game_arena("permanent", PERMANENT_ARENA_SIZE, permanent_init, ARENA_FLAG_NONE);
+    state->stage_arena            = make_stage_arena();
+    state->scratch_arena          = make_game_arena("scratch", SCRATCH_ARENA_SIZE, 0, ARENA_FLAG_NONE);
+    state->rnd                    = make_rnd_streams((uint64_t)time(nullptr));
+    state->debug_bounding_boxes   = false;
+#ifdef DEBUG
+    init_rewind_buffer(state, &state->rewind);
 #endif
 
-    screenshake_init(&g_state->screenshake, 6.0f);
+    state->background_scroll      = make_background_scroll(state);
+    state->star_field             = make_star_field(
+        (uint32_t)derive_rnd_seed(state->rnd.seed, RND_STREAM_STARS, 0)
+    );
+    APP_INFO("Rnd seed %llu", (unsigned long long)state->rnd.seed);
+
+    init_text_cache(&state->text_cache, !state->is_headless);
+    // Recording without forwarding skips every cute draw call, canvas pass and GPU upload
+    const bool is_recording = platform->is_recording_draws || state->is_headless;
+    init_gfx(state, is_recording ? GFX_BACKEND_RECORDING : GFX_BACKEND_CUTE);
+    gfx_clear_color(state, 0.0f, 0.0f, 0.0f, 1.0f);  // Background, the only place that sets it
+
+    screenshake_init(&state->screenshake, 6.0f);
 
-    if (!validate_game_state()) {
+    if (!validate_game_state(state)) {
         APP_FATAL("GameState validation failed in game_init");
         CF_ASSERT(false);
     }
 
-    int canvas_w    = (int)g_state->canvas_size.x * g_state->scale;
-    int canvas_h    = (int)g_state->canvas_size.y * g_state->scale;
-    g_state->canvas = cf_make_canvas(cf_canvas_defaults(canvas_w, canvas_h));
-    cf_app_set_canvas_size(canvas_w, canvas_h);
-    cf_app_set_size((int)g_state->canvas_size.x * g_state->scale, (int)g_state->canvas_size.y * g_state->scale);
-    cf_app_center_window();
+    // Headless apps have no GPU device or mixer, and the window and fonts are shared by every instance
+    if (!state->is_headless) {
+        int canvas_w    = (int)state->canvas_size.x * state->scale;
+        int canvas_h    = (int)state->canvas_size.y * state->scale;
+        state->canvas = cf_make_canvas(cf_canvas_defaults(canvas_w, canvas_h));
+        cf_app_set_canvas_size(canvas_w, canvas_h);
+        init_hud(state, canvas_w, canvas_h);
+        bake_background_scroll(state, &state->background_scroll, state->scale);
+        cf_app_set_size((int)state->canvas_size.x * state->scale, (int)state->canvas_size.y * state->scale);
+        cf_app_center_window();
 #ifdef DEBUG
-    cf_app_init_imgui();
+        if (gfx_is_submitting(state)) { cf_app_init_imgui(); }
 #endif
 
-    load_font("assets/tiny-and-chunky.ttf", "TinyAndChunky");
+        // Audio decodes on worker threads while the first frames render
+        allocation_tag(state, ALLOCATION_TAG_ASSETS) {
+            load_font("assets/tiny-and-chunky.ttf", "TinyAndChunky");
+            init_asset_loader(state);
+            load_audios(state);  // TODO: Rename the _audios to something better... sounding?
+        }
+    }
 
-    load_audios();  // TODO: Rename the _audios to something better... sounding?
+    init_render_queue(state, RENDER_QUEUE_CAPACITY);
 
     // Prepare the storage for player bullets
-    INIT_ENTITY_STORAGE(Enemy, enemies, MAX_ENEMIES);
-    INIT_ENTITY_STORAGE(EnemyBullet, enemy_bullets, MAX_ENEMY_BULLETS);
-    INIT_ENTITY_STORAGE(Explosion, explosions, MAX_EXPLOSIONS);
-    INIT_ENTITY_STORAGE(ExplosionParticle, explosion_particles, MAX_EXPLOSION_PARTICLES);
-    INIT_ENTITY_STORAGE(FloatingScore, floating_scores, MAX_FLOATING_SCORES);
-    INIT_ENTITY_STORAGE(HitParticle, hit_particles, MAX_HIT_PARTICLES);
-    INIT_ENTITY_STORAGE(PlayerBullet, player_bullets, MAX_PLAYER_BULLETS);
-    INIT_ENTITY_STORAGE(StarParticle, star_particles, MAX_STAR_PARTICLES);
+    INIT_ENTITY_STORAGE(state, Enemy, enemies, MAX_ENEMIES);
+    INIT_ENTITY_STORAGE(state, EnemyBullet, enemy_bullets, MAX_ENEMY_BULLETS);
+    INIT_ENTITY_STORAGE(state, Explosion, explosions, MAX_EXPLOSIONS);
+    INIT_ENTITY_STORAGE(state, ExplosionParticle, explosion_particles, MAX_EXPLOSION_PARTICLES);
+    INIT_ENTITY_STORAGE(state, FloatingScore, floating_scores, MAX_FLOATING_SCORES);
+    INIT_ENTITY_STORAGE(state, HitParticle, hit_particles, MAX_HIT_PARTICLES);
+    INIT_ENTITY_STORAGE(state, PlayerBullet, player_bullets, MAX_PLAYER_BULLETS);
+
+    // Every allocation so far has to be listed in the init footprints, or an autosized arena can come up short
+    CF_ASSERT(state->permanent_arena.stats.used <= permanent_init);
+    CF_ASSERT(state->stage_arena.stats.used <= get_stage_init_bytes());
+
+    // Sized by the entity storage
+    init_rollback_session(state, &state->rollback);
 
     // Initialize shared particle sprite (1x1 white pixel)
     CF_Pixel particle_pixel = {
         .colors = {255, 255, 255, 255}
     };
-    g_state->sprites.particle = cf_make_easy_sprite_from_pixels(&particle_pixel, 1, 1);
+    state->sprites.particle = cf_make_easy_sprite_from_pixels(&particle_pixel, 1, 1);
+    bake_explosion_palette(state);
 
-    // Initialize game state (player, entities, coroutines, etc.)
-    reset_game();
+    // Initialize game state (player, entities, spawner, etc.)
+    reset_game(state);
+    if (platform->is_soak_test) { start_soak_test(&state->soak); }
 
-    play_sound(SOUND_REVEAL);
-    play_music(MUSIC_BACKGROUND);
+    // Nothing to wait for without audio
+    state->is_loading = !state->is_headless;
+    play_music(state, MUSIC_BACKGROUND);
+    return state;
 }
 
-EXPORT bool game_update(void) {
-    cf_arena_reset(&g_state->scratch_arena);
-
-    auto canvas_aabb = cf_make_aabb_center_half_extents(cf_v2(0, 0), cf_div_v2_f(g_state->canvas_size, 2.0f));
-
-#ifdef DEBUG
-    // Toggle debug mode
-    if (cf_key_just_pressed(CF_KEY_G)) g_state->debug = !g_state->debug;
-#endif
-
-    update_input(&g_state->player.input);
+// One fixed tick of gameplay. It reads nothing but the state and the players' inputs, so the rollback session can
+// run it again for ticks it already simulated.
+static void simulate_tick(GameState* state) {
+    auto canvas_aabb = sim_make_aabb(cf_v2(0, 0), cf_div_v2_f(state->canvas_size, 2.0f));
 
     // Handle game over state
-    if (g_state->is_game_over) {
-        // Check for restart input (shoot button)
-        if (g_state->player.input.shoot) { reset_game(); }
-        return true;
+    if (state->is_game_over) {
+        // Check for restart input (shoot button), from any player
+        bool is_restarting = false;
+        for (size_t i = 0; i < state->players_count; ++i) { is_restarting |= state->players[i].input.shoot; }
+        if (is_restarting) { reset_game(state); }
+        return;
     }
 
     // Update wave announcement
-    if (g_state->wave.is_announcing) {
-        g_state->wave.announcement_timer += CF_DELTA_TIME;
-        if (g_state->wave.announcement_timer >= WAVE_ANNOUNCEMENT_DURATION) { g_state->wave.is_announcing = false; }
+    if (state->wave.is_announcing) {
+        sim_count_up(&state->wave.announcement_timer);
+        if (state->wave.announcement_timer >= WAVE_ANNOUNCEMENT_DURATION) { state->wave.is_announcing = false; }
     }
 
-    update_player(&g_state->player);
-    update_movement(&g_state->player.position, &g_state->player.velocity);
+    for (size_t i = 0; i < state->players_count; i++) {
+        update_player(state, &state->players[i]);
+        update_movement(&state->players[i].position, &state->players[i].velocity);
+    }
 
     // Update player bullets
-    for (size_t i = 0; i < g_state->player_bullets_count; i++) {
-        update_movement(&g_state->player_bullets[i].position, &g_state->player_bullets[i].velocity);
+    for (size_t i = 0; i < state->player_bullets_count; i++) {
+        update_movement(&state->player_bullets[i].position, &state->player_bullets[i].velocity);
 
         // Mark bullet as destroyed when out of screen bounds
-        if (g_state->player_bullets[i].position.y > g_state->canvas_size.y * 0.5f) {
-            g_state->player_bullets[i].is_alive = false;
+        if (state->player_bullets[i].position.y > state->canvas_size.y * 0.5f) {
+            state->player_bullets[i].is_alive = false;
         }
     }
 
     // Update enemies
-    for (size_t i = 0; i < g_state->enemies_count; i++) {
-        update_movement(&g_state->enemies[i].position, &g_state->enemies[i].velocity);
-        update_enemy(&g_state->enemies[i]);  // TODO: Rename to update_enemy_weapon
+    for (size_t i = 0; i < state->enemies_count; i++) {
+        update_movement(&state->enemies[i].position, &state->enemies[i].velocity);
+        update_enemy(state, &state->enemies[i]);  // TODO: Rename to update_enemy_weapon
 
         // Mark enemy as destroyed when out of screen bounds
-        if (g_state->enemies[i].position.y < canvas_aabb.min.y) { g_state->enemies[i].is_alive = false; }
+        if (state->enemies[i].position.y < -state->canvas_size.y / 2.0f) { state->enemies[i].is_alive = false; }
     }
 
     // Update enemy bullets
-    for (size_t i = 0; i < g_state->enemy_bullets_count; i++) {
-        update_movement(&g_state->enemy_bullets[i].position, &g_state->enemy_bullets[i].velocity);
+    for (size_t i = 0; i < state->enemy_bullets_count; i++) {
+        update_movement(&state->enemy_bullets[i].position, &state->enemy_bullets[i].velocity);
 
         // Mark bullet as destroyed when out of screen bounds
-        auto bullet_aabb = cf_make_aabb_center_half_extents(
-            g_state->enemy_bullets[i].position, g_state->enemy_bullets[i].collider.half_extents
+        auto bullet_aabb = sim_make_aabb(
+            state->enemy_bullets[i].position, state->enemy_bullets[i].collider.half_extents
         );
-        if (!cf_aabb_to_aabb(canvas_aabb, bullet_aabb)) { g_state->enemy_bullets[i].is_alive = false; }
+        if (!sim_aabb_to_aabb(canvas_aabb, bullet_aabb)) { state->enemy_bullets[i].is_alive = false; }
     }
 
-    update_hit_particles();
-    update_explosion_particles();
-    update_star_particles();
-    update_floating_scores();
+    update_hit_particles(state);
+    update_explosion_particles(state);
+    update_star_field(state);
+    update_floating_scores(state);
 
     // TODO: Decide where to move this
     // Clamp player position to canvas bounds
-    g_state->player.position.x =
-        cf_clamp(g_state->player.position.x, -g_state->canvas_size.x / 2.0f, g_state->canvas_size.x / 2.0f);
-    g_state->player.position.y =
-        cf_clamp(g_state->player.position.y, -g_state->canvas_size.y / 2.0f, g_state->canvas_size.y / 2.0f);
-
-    update_background_scroll();
-    update_collision();
-    update_coroutine();
-    screenshake_update(&g_state->screenshake);
-
-    cleanup_enemies();
-    cleanup_enemy_bullets();
-    cleanup_explosions();
-    cleanup_hit_particles();
-    cleanup_explosion_particles();
-    cleanup_player_bullets();
-    cleanup_floating_scores();
+    for (size_t i = 0; i < state->players_count; i++) {
+        auto position = &state->players[i].position;
+        position->x   = cf_clamp(position->x, -state->canvas_size.x / 2.0f, state->canvas_size.x / 2.0f);
+        position->y   = cf_clamp(position->y, -state->canvas_size.y / 2.0f, state->canvas_size.y / 2.0f);
+    }
+
+    update_background_scroll(state);
+    update_collision(state);
+    update_gameplay_events(state);
+    update_spawner(state, &state->spawner);
+    screenshake_update(&state->screenshake);
+
+    cleanup_enemies(state);
+    cleanup_enemy_bullets(state);
+    cleanup_explosions(state);
+    cleanup_hit_particles(state);
+    cleanup_explosion_particles(state);
+    cleanup_player_bullets(state);
+    cleanup_floating_scores(state);
+}
+
+// Headless instances have no keyboard, their players only move when a bot drives them
+static void read_input(GameState* state, Input* input, InputSource source) {
+    if (!state->is_headless) { update_input(input, source); }
+}
+
+EXPORT bool game_update(void* game_state) {
+    GameState* state = game_state;
+    arena_begin_frame(&state->permanent_arena);
+    arena_begin_frame(&state->stage_arena);
+    arena_begin_frame(&state->scratch_arena);
+    arena_reset(&state->scratch_arena);
+
+#ifdef DEBUG
+    // Toggle debug mode
+    if (!state->is_headless && cf_key_just_pressed(CF_KEY_G)) state->debug = !state->debug;
+#endif
+
+    // Start the sounds requested during the previous tick
+    if (!state->is_headless) {
+        allocation_tag(state, ALLOCATION_TAG_AUDIO) {
+            update_voices(state);
+            update_audio(state);
+        }
+    }
+
+    // Hold gameplay until the sound effects are decoded
+    if (state->is_loading) {
+        if (!are_required_assets_ready(state)) { return true; }
+
+        state->is_loading = false;
+        play_sound(state, SOUND_REVEAL);
+
+        // Caches fill during the first waves, not while loading
+        state->platform->allocations->warmup_frames = ALLOCATION_WARMUP_FRAMES;
+    }
+
+    if (state->soak.is_active) {
+        update_soak_test(state, &state->soak, simulate_tick);
+        return true;
+    }
+
+#ifdef DEBUG
+    // Capture the current moment, or jump back to the last capture
+    if (!state->is_headless && cf_key_just_pressed(CF_KEY_F5)) { save_snapshot(state, SNAPSHOT_PATH); }
+    if (!state->is_headless && cf_key_just_pressed(CF_KEY_F9)) { load_snapshot(state, SNAPSHOT_PATH); }
+
+    // The debug pane steps through the recorded ticks instead
+    if (state->rewind.is_paused) { return true; }
+#endif
+
+    if (state->rollback.is_active) {
+        Input local_input  = {0};
+        Input remote_input = {0};
+        read_input(state, &local_input, INPUT_SOURCE_WASD);
+        read_input(state, &remote_input, INPUT_SOURCE_ARROWS);
+        update_rollback_session(state, &state->rollback, local_input, remote_input, simulate_tick);
+        return true;
+    }
+
+    read_input(state, &state->players[0].input, INPUT_SOURCE_ANY);
+    simulate_tick(state);
+
+#ifdef DEBUG
+    // Co-op ticks are not recorded, the rollback session already rewinds them
+    record_rewind_frame(state, &state->rewind);
+#endif
 
     return true;
 }
 
 #if DEBUG
-static void game_render_debug(void) {
-    auto weapon = &g_state->player.weapon;
-    auto pos    = &g_state->player.position;
-    auto vel    = &g_state->player.velocity;
-    auto input  = &g_state->player.input;
+// The second player joins through a loopback peer, both start over
+static void set_coop(GameState* state, bool is_coop) {
+    state->players_count = is_coop ? 2 : 1;
+    reset_game(state);
+    clear_rewind_buffer(&state->rewind);
+
+    if (is_coop) {
+        start_rollback_session(state, &state->rollback);
+    } else {
+        stop_rollback_session(&state->rollback);
+    }
+    if (is_coop && !state->rollback.is_active) { set_coop(state, false); }
+}
+
+static void game_render_debug(GameState* state) {
+    auto weapon = &state->players[0].weapon;
+    auto pos    = &state->players[0].position;
+    auto vel    = &state->players[0].velocity;
+    auto input  = &state->players[0].input;
 
     ImGui_Begin("Debug Menu", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
     {
         if (ImGui_CollapsingHeader("Debug", true)) {
-            ImGui_Checkbox("Draw Bounding Boxes", &g_state->debug_bounding_boxes);
+            ImGui_Checkbox("Draw Bounding Boxes", &state->debug_bounding_boxes);
+            ImGui_SliderInt("Stars Per Layer", &state->star_field.stars_per_layer, 0, STAR_FIELD_MAX_STARS_PER_LAYER);
+
+            bool baked_background = state->background_scroll.mode == BACKGROUND_SCROLL_MODE_BAKED;
+            if (ImGui_Checkbox("Baked Background", &baked_background)) {
+                state->background_scroll.mode =
+                    baked_background ? BACKGROUND_SCROLL_MODE_BAKED : BACKGROUND_SCROLL_MODE_TILED;
+            }
         }
 
         if (ImGui_CollapsingHeader("Player", true)) {
@@ -266,11 +438,11 @@ static void game_render_debug(void) {
         }
 
         if (ImGui_CollapsingHeader("Entity Counts", true)) {
-            ImGui_Text("Enemies: %zu", g_state->enemies_count);
-            ImGui_Text("EnemyBullets: %zu", g_state->enemy_bullets_count);
-            ImGui_Text("Explosions: %zu", g_state->explosions_count);
-            ImGui_Text("HitParticles: %zu", g_state->hit_particles_count);
-            ImGui_Text("PlayerBullets: %zu", g_state->player_bullets_count);
+            ImGui_Text("Enemies: %zu", state->enemies_count);
+            ImGui_Text("EnemyBullets: %zu", state->enemy_bullets_count);
+            ImGui_Text("Explosions: %zu", state->explosions_count);
+            ImGui_Text("HitParticles: %zu", state->hit_particles_count);
+            ImGui_Text("PlayerBullets: %zu", state->player_bullets_count);
         }
 
         if (ImGui_CollapsingHeader("Weapon", true)) {
@@ -278,31 +450,179 @@ static void game_render_debug(void) {
             ImGui_Text("Time Since Last Shot: %.2f", weapon->time_since_shot);
         }
 
-        if (ImGui_CollapsingHeader("Performance", true)) { ImGui_Text("FPS: %.2f", cf_app_get_framerate()); }
+        if (ImGui_CollapsingHeader("Performance", true)) {
+            ImGui_Text("FPS: %.2f", cf_app_get_framerate());
+            ImGui_Text("HUD Redraws: %zu", state->hud.redraw_count);
+            ImGui_Text(
+                "Assets: %.0f%% loaded, required ready in %.2f ms",
+                get_asset_loader_progress(state) * 100.0f,
+                state->asset_loader.required_ready_ms
+            );
+            ImGui_Text(
+                "Voices: %d/%d, %d merged, %d stolen",
+                state->voices.voice_count,
+                VOICE_BUDGET,
+                state->voices.merged,
+                state->voices.stolen
+            );
+            ImGui_Text(
+                "Audio: %zu KiB sound bank, %zu KiB music",
+                state->audio.stats.sound_bank_bytes / 1024,
+                state->audio.stats.music_bytes / 1024
+            );
+
+            bool record_draw_commands = state->gfx.backend == GFX_BACKEND_RECORDING;
+            if (ImGui_Checkbox("Record Draw Commands", &record_draw_commands)) {
+                state->gfx.backend = record_draw_commands ? GFX_BACKEND_RECORDING : GFX_BACKEND_CUTE;
+                state->gfx.forward = true;  // Keep the window rendering while recording
+            }
+            ImGui_Text(
+                "Draw Commands: %zu, %zu state changes, %zu bytes, %zu dropped",
+                state->gfx.last_frame.commands,
+                state->gfx.last_frame.state_changes,
+                state->gfx.last_frame.bytes,
+                state->gfx.last_frame.dropped
+            );
+            ImGui_Text(
+                "Render Queue State Changes: %zu, %zu dropped",
+                state->render_queue.state_changes,
+                state->render_queue.dropped
+            );
+            for (int layer = 0; layer <= Z_MAX; ++layer) {
+                ImGui_Text("Layer %d Draws: %zu", layer, state->render_queue.draws_per_layer[layer]);
+            }
+            ImGui_Text(
+                "Text Cache: %zu runs, %zu hits, %zu misses",
+                state->text_cache.count,
+                state->text_cache.hits,
+                state->text_cache.misses
+            );
+        }
+
+        if (ImGui_CollapsingHeader("Snapshot", true)) {
+            if (ImGui_Button("Save (F5)")) { save_snapshot(state, SNAPSHOT_PATH); }
+            ImGui_SameLine();
+            if (ImGui_Button("Load (F9)")) { load_snapshot(state, SNAPSHOT_PATH); }
+            ImGui_Text(
+                "%s: %zu KiB, saved in %.2f ms, loaded in %.2f ms",
+                SNAPSHOT_PATH,
+                state->snapshot.bytes / CF_KB,
+                state->snapshot.save_ms,
+                state->snapshot.load_ms
+            );
+        }
+
+        if (ImGui_CollapsingHeader("Rewind", true)) {
+            auto rewind = &state->rewind;
+            if (!rewind->is_paused) {
+                if (ImGui_Button("Pause")) { pause_rewind_buffer(rewind); }
+            } else {
+                if (ImGui_Button("Resume")) { resume_from_rewind_frame(rewind); }
+                ImGui_SameLine();
+                if (ImGui_Button("<")) { seek_rewind_frame(state, rewind, rewind->cursor - 1); }
+                ImGui_SameLine();
+                if (ImGui_Button(">")) { seek_rewind_frame(state, rewind, rewind->cursor + 1); }
+
+                int cursor = rewind->cursor;
+                if (ImGui_SliderInt("Tick", &cursor, 0, rewind->count - 1)) {
+                    seek_rewind_frame(state, rewind, cursor);
+                }
+            }
+            ImGui_Text(
+                "%d ticks (%.1f s), %zu KiB stored, %zu KiB as snapshots",
+                rewind->count,
+                rewind->count * CF_DELTA_TIME,
+                rewind->stats.stored_bytes / CF_KB,
+                rewind->stats.raw_bytes / CF_KB
+            );
+            ImGui_Text("Capture: %.3f ms, peak %.3f ms", rewind->stats.capture_ms, rewind->stats.peak_capture_ms);
+        }
+
+        if (ImGui_CollapsingHeader("Co-op", true)) {
+            auto rollback = &state->rollback;
+            bool is_coop  = rollback->is_active;
+            if (ImGui_Checkbox("Loopback Peer (Arrows, Right Ctrl)", &is_coop)) { set_coop(state, is_coop); }
+            ImGui_SliderFloat("Latency (ms)", &rollback->peer.latency_ms, 0.0f, LOOPBACK_MAX_DELAY_MS / 2);
+            ImGui_SliderFloat("Jitter (ms)", &rollback->peer.jitter_ms, 0.0f, LOOPBACK_MAX_DELAY_MS / 2);
+            ImGui_Text(
+                "Tick %lld, %lld confirmed, %d inputs in flight",
+                (long long)rollback->tick,
+                (long long)rollback->confirmed_tick,
+                rollback->peer.packets_count
+            );
+            ImGui_Text(
+                "Rollback: %d ticks in %.2f ms, peak %d ticks in %.2f ms",
+                rollback->stats.resimulated_ticks,
+                rollback->stats.resimulate_ms,
+                rollback->stats.peak_resimulated_ticks,
+                rollback->stats.peak_resimulate_ms
+            );
+            ImGui_Text(
+                "Save: %.3f ms per tick, %d mispredictions, %d frames waiting for the peer",
+                rollback->stats.save_ms,
+                rollback->stats.mispredictions,
+                rollback->stats.stalled_frames
+            );
+        }
+
+        if (ImGui_CollapsingHeader("Memory", true)) {
+            auto allocations = state->platform->allocations;
+            ImGui_Checkbox("Report Frame Allocations", &allocations->guard);
+            ImGui_Text(
+                "Heap: %zu frees last frame, %zu callsites reported, warm-up %d frames",
+                allocations->last_frame.frees,
+                allocations->guard_reports,
+                allocations->warmup_frames
+            );
+            for (int tag = 0; tag < ALLOCATION_TAG_COUNT; ++tag) {
+                ImGui_Text(
+                    "Heap %s: %zu allocs, %zu bytes last frame",
+                    get_allocation_tag_name((AllocationTag)tag),
+                    allocations->last_frame.count[tag],
+                    allocations->last_frame.bytes[tag]
+                );
+            }
+
+            const Arena* const arenas[] = {&state->permanent_arena, &state->stage_arena, &state->scratch_arena};
+            for (size_t i = 0; i < countof(arenas); ++i) {
+                const ArenaStats* stats = &arenas[i]->stats;
+                ImGui_Text(
+                    "%s: %zu/%zu KiB (%zu KiB committed), peak %zu KiB frame / %zu KiB session, %zu allocs (%zu)",
+                    arenas[i]->name,
+                    stats->used / CF_KB,
+                    arenas[i]->capacity / CF_KB,
+                    stats->committed / CF_KB,
+                    stats->frame_peak / CF_KB,
+                    stats->session_peak / CF_KB,
+                    stats->allocation_count,
+                    stats->frame_allocation_count
+                );
+            }
+        }
 
         if (ImGui_CollapsingHeader("Window", true)) {
-            ImGui_Text("Screen: %dx%d", cf_display_width(g_state->display_id), cf_display_height(g_state->display_id));
+            ImGui_Text("Screen: %dx%d", cf_display_width(state->display_id), cf_display_height(state->display_id));
             ImGui_Text("Size: %dx%d", cf_app_get_width(), cf_app_get_height());
             ImGui_Text("Canvas: %dx%d", cf_app_get_canvas_width(), cf_app_get_canvas_height());
-            ImGui_Text("Canvas(logical): %.0fx%.0f", g_state->canvas_size.x, g_state->canvas_size.y);
-            ImGui_Text("Game Scale: %.2f", g_state->scale);
+            ImGui_Text("Canvas(logical): %.0fx%.0f", state->canvas_size.x, state->canvas_size.y);
+            ImGui_Text("Game Scale: %.2f", state->scale);
             ImGui_Text("DPI Scale: %.2f", cf_app_get_dpi_scale());
         }
     }
     ImGui_End();
 
-    if (g_state->debug_bounding_boxes) {
+    if (state->debug_bounding_boxes) {
         // Draw on top of everything
-        cf_draw_layer(Z_MAX) {
-            RENDER_DEBUG_BBOXES(g_state->enemies, g_state->enemies_count, position, collider);
-            RENDER_DEBUG_BBOXES(g_state->player_bullets, g_state->player_bullets_count, position, collider);
-            RENDER_DEBUG_BBOXES(g_state->enemy_bullets, g_state->enemy_bullets_count, position, collider);
-            {
-                auto entity        = &g_state->player;
+        gfx_draw_layer(state, Z_MAX) {
+            RENDER_DEBUG_BBOXES(state, state->enemies, state->enemies_count, position, collider);
+            RENDER_DEBUG_BBOXES(state, state->player_bullets, state->player_bullets_count, position, collider);
+            RENDER_DEBUG_BBOXES(state, state->enemy_bullets, state->enemy_bullets_count, position, collider);
+            for (size_t i = 0; i < state->players_count; ++i) {
+                auto entity        = &state->players[i];
                 auto aabb_collider = cf_make_aabb_center_half_extents(entity->position, entity->collider.half_extents);
 
-                cf_draw() {
-                    cf_draw_color(cf_color_blue()) { cf_draw_quad(aabb_collider, 0, 0); }
+                gfx_draw(state) {
+                    gfx_draw_color(state, cf_color_blue()) { gfx_draw_quad(state, aabb_collider, 0, 0); }
                 }
             }
         }
@@ -310,138 +630,162 @@ static void game_render_debug(void) {
 }
 #endif  // DEBUG
 
-EXPORT void game_render(void) {
+static void render_loading_screen(GameState* state) {
+    const float progress = get_asset_loader_progress(state);
+    const CF_V2 track    = cf_v2(LOADING_BAR_WIDTH * 0.5f, LOADING_BAR_HEIGHT * 0.5f);
+    const CF_V2 fill     = cf_v2(track.x * progress, track.y);
+
+    render_queue_push_quad(state, cf_v2(0, 0), track, cf_make_color_rgb(20, 91, 132), Z_UI);
+    render_queue_push_quad(state, cf_v2(-track.x + fill.x, 0), fill, cf_color_white(), Z_UI);
+    render_queue_flush(state);
+}
+
+static void render_frame(GameState* state) {
+    gfx_begin_frame(state);
+
+    // Redraw the HUD canvas first, it flushes whatever has been queued for drawing
+    allocation_tag(state, ALLOCATION_TAG_TEXT) { update_hud_canvas(state); }
+
 #ifdef DEBUG
-    if (g_state->debug) game_render_debug();
+    // ImGui is not set up when gfx only records
+    if (state->debug && gfx_is_submitting(state)) {
+        allocation_tag(state, ALLOCATION_TAG_DEBUG) { game_render_debug(state); }
+    }
 #endif
 
-    render_background_scroll();
-    render_star_particles();
-
-    // Show wave announcement
-    if (g_state->wave.is_announcing) {
-        char wave_text[32];
-        snprintf(wave_text, sizeof(wave_text), "Wave %d", g_state->wave.current_wave);
-
-        cf_draw() {
-            cf_font("TinyAndChunky") {
-                cf_push_font_size(7);
-                const float text_width  = cf_text_width(wave_text, -1);
-                const float text_height = cf_text_height(wave_text, -1);
-
-                cf_draw_layer(Z_UI) {
-                    // Draw shadow
-                    cf_draw_color(cf_make_color_rgb(20, 91, 132)) {
-                        cf_draw_text(wave_text, cf_v2(-text_width / 2.0f + 2, -text_height / 2.0f - 2), -1);
-                    }
-                    // Draw main text
-                    cf_draw_color(cf_color_white()) {
-                        cf_draw_text(wave_text, cf_v2(-text_width / 2.0f, -text_height / 2.0f), -1);
-                    }
-                }
-            }
-        }
+    if (state->is_loading) {
+        render_loading_screen(state);
+        return;
     }
 
+    render_background_scroll(state);
+    render_star_field(state);
+
     // Show game over screen
-    if (g_state->is_game_over) {
-        cf_draw() {
-            cf_draw_layer(Z_UI) { cf_draw_sprite(get_sprite_ptr(SPRITE_GAME_OVER)); }
-        }
+    if (state->is_game_over) {
+        render_queue_push_sprite(state, get_sprite_ptr(state, SPRITE_GAME_OVER), cf_v2(0, 0), cf_v2(1.0f, 1.0f), Z_UI);
+        render_queue_flush(state);
+        render_hud(state);
 
         return;
     }
 
-    render_player(&g_state->player);
-    RENDER_ENTITY_ARRAY(g_state->enemies, g_state->enemies_count, sprite, position, z_index);
-    RENDER_ENTITY_ARRAY(g_state->enemy_bullets, g_state->enemy_bullets_count, sprite, position, z_index);
-    RENDER_ENTITY_ARRAY(g_state->explosions, g_state->explosions_count, sprite, position, z_index);
-    RENDER_ENTITY_ARRAY(g_state->player_bullets, g_state->player_bullets_count, sprite, position, z_index);
+    for (size_t i = 0; i < state->players_count; ++i) { render_player(state, &state->players[i]); }
+    RENDER_ENTITY_ARRAY(state, state->enemies, state->enemies_count, sprite, position, z_index);
+    RENDER_ENTITY_ARRAY(state, state->enemy_bullets, state->enemy_bullets_count, sprite, position, z_index);
+    RENDER_ENTITY_ARRAY(state, state->explosions, state->explosions_count, sprite, position, z_index);
+    RENDER_ENTITY_ARRAY(state, state->player_bullets, state->player_bullets_count, sprite, position, z_index);
 
     // Custom code for particles draw
-    for (size_t i = 0; i < g_state->hit_particles_count; i++) {
-        cf_draw() {
-            cf_draw_layer(Z_PARTICLES) {
-                cf_draw_translate_v2(g_state->hit_particles[i].position);
-                cf_draw_scale(g_state->hit_particles[i].size, g_state->hit_particles[i].size);
-                cf_draw_sprite(&g_state->hit_particles[i].sprite);
-            }
-        }
+    for (size_t i = 0; i < state->hit_particles_count; i++) {
+        auto particle = &state->hit_particles[i];
+        render_queue_push_sprite(
+            state, &particle->sprite, particle->position, cf_v2(particle->size, particle->size), Z_PARTICLES
+        );
     }
 
-    render_explosion_particles();
-    render_floating_scores();
+    render_explosion_particles(state);
+    render_floating_scores(state);
 
     /**
      * Render UI
      */
-    char score_text[6 + 1];
-
-    cf_draw() {
-        cf_font("TinyAndChunky") {
-            cf_push_font_size(7);
-            snprintf(score_text, 7, "%06d", g_state->score);
-            const float text_width   = cf_text_width(score_text, -1);
-            const float text_height  = cf_text_height(score_text, -1);
-            const float offset_x     = cf_app_get_canvas_width() / 2.0f / g_state->scale - text_width;
-            const float offset_y     = cf_app_get_canvas_height() / 2.0f / g_state->scale + text_height / 2;
-            const int   margin_top   = 4;
-            const int   margin_right = 4;
-
-            cf_draw_color(cf_make_color_rgb(20, 91, 132)) {
-                cf_draw_text(score_text, cf_v2(offset_x + 1 - margin_right, offset_y - 1 - margin_top), -1);
-            }
-            cf_draw_color(cf_color_white()) {
-                cf_draw_text(score_text, cf_v2(offset_x - margin_right, offset_y - margin_top), -1);
-            }
-        }
+    render_hud(state);
 
-        // Render life icons
-        const int        icon_margin_right  = 4;
-        const int        icon_margin_bottom = 4;
-        const CF_Sprite* icon               = get_sprite_ptr(SPRITE_LIFE_ICON);
-        const float      canvas_half_width  = cf_app_get_canvas_width() / 2.0f / g_state->scale;
-        const float      canvas_half_height = cf_app_get_canvas_height() / 2.0f / g_state->scale;
-
-        for (int i = 0; i < g_state->lives; i++) {
-            float x = canvas_half_width - icon_margin_right - (i + 1) * (icon->w) + icon->w / 2.0f;
-            float y = -canvas_half_height + icon_margin_bottom + icon->h / 4.0f;
-            cf_draw() {
-                cf_draw_translate_v2(cf_v2(x, y));
-                cf_draw_sprite(icon);
-            }
-        }
+    allocation_tag(state, ALLOCATION_TAG_GFX) {
+        render_queue_flush(state);
+        gfx_render_to(state, state->canvas, true);
     }
 
-    cf_render_to(g_state->canvas, true);
-
-    cf_draw() {
-        cf_draw_translate_v2(screenshake_get_offset(&g_state->screenshake));
-        cf_draw_rotate(screenshake_get_rotation(&g_state->screenshake));  // TODO: Move param inside the screenshake
-                                                                          // function
-        cf_draw_canvas(
-            g_state->canvas,
+    gfx_draw(state) {
+        gfx_translate(state, screenshake_get_offset(&state->screenshake));
+        gfx_rotate(state, screenshake_get_rotation(&state->screenshake));  // TODO: Move param inside the screenshake
+                                                                      // function
+        gfx_draw_canvas(
+            state,
+            state->canvas,
             cf_v2(0, 0),
-            cf_v2(cf_app_get_canvas_width() / g_state->scale, cf_app_get_canvas_height() / g_state->scale)
+            cf_v2(cf_app_get_canvas_width() / state->scale, cf_app_get_canvas_height() / state->scale)
         );
     }
 }
 
-EXPORT void game_shutdown(void) {
-    Platform* platform = g_state->platform;
-    cf_destroy_arena(&g_state->scratch_arena);
-    cf_destroy_arena(&g_state->stage_arena);
-    cf_destroy_arena(&g_state->permanent_arena);
-    platform->free_memory(g_state);
+EXPORT void game_render(void* game_state) {
+    GameState* state = game_state;
+
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+    render_frame(state);
+    if (state->soak.is_active) { record_soak_render(state, &state->soak, cf_stopwatch_milliseconds(stopwatch)); }
+}
+
+EXPORT void game_shutdown(void* game_state) {
+    GameState* state    = game_state;
+    Platform*  platform = state->platform;
+    shutdown_asset_loader(state);
+
+    if (state->soak.is_active) { report_soak_test(state, &state->soak); }
+
+    const Arena* const arenas[] = {&state->permanent_arena, &state->stage_arena, &state->scratch_arena};
+    for (size_t i = 0; i < countof(arenas); ++i) { log_arena_stats(arenas[i]); }
+#ifdef DEBUG
+    // Recorded peaks for ARENA_AUTOSIZE builds
+    save_arena_profile(arenas, countof(arenas));
+#endif
+
+    destroy_arena(&state->scratch_arena);
+    destroy_arena(&state->stage_arena);
+    destroy_arena(&state->permanent_arena);
+    free_state_header(state);
+    platform->free_memory(state);
 }
 
-EXPORT void* game_state(void) { return g_state; }
+EXPORT void game_unload(void* game_state) {
+    GameState* state = game_state;
+
+    // Workers run load_job() from this library, the next one submits whatever they did not get to
+    pause_asset_loader(state);
+}
+
+EXPORT void* game_hot_reload(void* game_state) {
+    GameState* previous = game_state;
+    GameState* state    = nullptr;
+
+    if (previous->header.magic != GAME_STATE_MAGIC) {
+        // Written before states carried their layout, or with a StateSchema this library cannot read
+        APP_WARN("GameState has no readable layout header, reusing it as is");
+        state = previous;
+        write_state_header(state);
+    } else if (previous->header.layout_version == get_state_schema()->version) {
+        state = previous;
+    } else {
+        // The layout changed, copy field by field into storage laid out by this library
+        Platform* platform = find_state_platform(previous);
+        CF_ASSERT(platform);
+
+        state = migrate_game_state(previous, platform);
+        if (state == nullptr) {
+            APP_WARN("Starting a new run on the new GameState layout");
+            destroy_previous_game_state(previous, platform);
+            return game_init(platform);
+        }
+    }
+
+    set_log_ring(state->platform->log_ring);
+    resume_asset_loader(state);
+
+    // Cached runs point at string literals owned by the previous library
+    init_text_cache(&state->text_cache, !state->is_headless);
+    render_queue_clear_caches(state);
+    invalidate_hud(state);
+
+    // States from before co-op had a single player field that does not migrate
+    if (state->players_count == 0) { reset_game(state); }
 
-EXPORT void game_hot_reload(void* game_state) {
-    // Update global game state pointer
-    g_state = (GameState*)game_state;
+    // States from before the rnd streams migrate without a seed
+    if (state->rnd.seed == 0) { state->rnd = make_rnd_streams((uint64_t)time(nullptr)); }
 
-    // Re-initialize coroutines
-    cleanup_coroutines();
-    init_coroutines();
+    // Recorded ticks were serialized by the previous library
+    clear_rewind_buffer(&state->rewind);
+    if (state->rollback.is_active) { start_rollback_session(state, &state->rollback); }
+    return state;
 }
@@ -2,6 +2,7 @@
 
 #include <cute_defines.h>
 
+#include "../engine/cute_macros.h"
 #include "../engine/platform.h"
 
 #ifdef _WIN32
@@ -10,10 +11,14 @@
     #define EXPORT
 #endif
 
-#define INIT_ENTITY_STORAGE(type, field, max)                                                \
-    g_state->field            = cf_arena_alloc(&g_state->stage_arena, (max) * sizeof(type)); \
-    g_state->field##_count    = 0;                                                           \
-    g_state->field##_capacity = (max)
+#define INIT_ENTITY_STORAGE(state, type, field, max)                                               \
+    (state)->field            = arena_alloc_required(&(state)->stage_arena, (max) * sizeof(type)); \
+    (state)->field##_count    = 0;                                                                 \
+    (state)->field##_capacity = (max)
+
+// Attributes heap allocations made inside the block to a subsystem, see AllocationTracker
+#define allocation_tag(state, tag) \
+    CF_SCOPE((state)->platform->push_allocation_tag(tag), (state)->platform->pop_allocation_tag())
 
 constexpr int PERMANENT_ARENA_SIZE         = CF_MB * 64;
 constexpr int STAGE_ARENA_SIZE             = CF_MB * 64;
@@ -30,16 +35,22 @@ constexpr int MAX_ENEMY_BULLETS            = 128;
 constexpr int MAX_HIT_PARTICLES            = 240;
 constexpr int MAX_EXPLOSION_PARTICLES      = 320;    // More particles for colorful explosions
 constexpr int MAX_EXPLOSIONS               = 32;
-constexpr int MAX_STAR_PARTICLES           = 4 * 4;  // 4 stars per 4 layers
 constexpr int MAX_FLOATING_SCORES          = 16;
 
 constexpr float WAVE_ANNOUNCEMENT_DURATION = 2.0f;
+constexpr float LOADING_BAR_WIDTH          = 80.0f;
+constexpr float LOADING_BAR_HEIGHT         = 4.0f;
 
+typedef struct Arena    Arena;
 typedef struct Platform Platform;
 
-EXPORT void  game_init(Platform* platform);
-EXPORT bool  game_update(void);
-EXPORT void  game_render(void);
-EXPORT void  game_shutdown(void);
-EXPORT void* game_state(void);
-EXPORT void  game_hot_reload(void* game_state);
+// Each returns or takes the GameState instance. Nothing else is shared, so instances can run on separate threads.
+EXPORT void* game_init(Platform* platform);
+EXPORT bool  game_update(void* game_state);
+EXPORT void  game_render(void* game_state);
+EXPORT void  game_shutdown(void* game_state);
+EXPORT void  game_unload(void* game_state);      // Stops work that runs library code, before a reload
+EXPORT void* game_hot_reload(void* game_state);  // Returns the instance to use from now on
+
+// Sized like every stage arena, from the arena profile in ARENA_AUTOSIZE builds
+Arena make_stage_arena(void);
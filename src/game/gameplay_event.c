@@ -0,0 +1,74 @@
+#include "gameplay_event.h"
+
+#include <assert.h>
+#include <cute_c_runtime.h>
+#include <cute_math.h>
+#include <stddef.h>
+
+#include "../engine/game_state.h"
+#include "asset/audio.h"
+#include "explosion.h"
+#include "explosion_particle.h"
+#include "floating_score.h"
+#include "game.h"
+#include "hit_particle.h"
+#include "player.h"
+#include "screenshake.h"
+
+static_assert(
+    MAX_GAMEPLAY_EVENTS >= MAX_PLAYERS * 2 + MAX_ENEMIES + MAX_PLAYER_BULLETS,
+    "A tick can emit a shot per player and enemy, a hit or kill per bullet and a damage per player"
+);
+
+void emit_gameplay_event(GameState* state, GameplayEvent event) {
+    auto events = &state->events;
+    CF_ASSERT(events->count < MAX_GAMEPLAY_EVENTS);
+    if (events->count >= MAX_GAMEPLAY_EVENTS) { return; }
+
+    events->items[events->count++] = event;
+}
+
+// Debris flies back along the bullet's path
+static void spawn_debris(GameState* state, CF_V2 position, CF_V2 bullet_velocity) {
+    spawn_hit_particle_burst(state, 5, position, cf_mul(cf_norm(bullet_velocity), -1.0f));
+}
+
+void update_gameplay_events(GameState* state) {
+    auto events = &state->events;
+
+    // Stacked shake is capped anyway, add the tick's total once
+    float shake = 0.0f;
+
+    for (size_t i = 0; i < events->count; ++i) {
+        const GameplayEvent* event = &events->items[i];
+        switch (event->type) {
+            case GAMEPLAY_EVENT_HIT:
+                spawn_debris(state, event->position, event->data.hit.bullet_velocity);
+                shake += 0.5f;
+                play_sound(state, SOUND_HIT);
+                break;
+            case GAMEPLAY_EVENT_KILL:
+                spawn_explosion(state, make_explosion(state, event->position));
+                spawn_explosion_particle_burst(state, event->position, COLOR_SOURCE_ENEMY(event->data.kill.enemy_type));
+                spawn_floating_score(state, make_floating_score(event->position, event->data.kill.score));
+                spawn_debris(state, event->position, event->data.kill.bullet_velocity);
+                shake += 1.0f;
+                play_sound(state, SOUND_EXPLOSION);
+                break;
+            case GAMEPLAY_EVENT_PLAYER_DAMAGED:
+                spawn_explosion(state, make_explosion(state, event->position));
+                spawn_explosion_particle_burst(state, event->position, COLOR_SOURCE_PLAYER());
+                shake += 4.0f;
+                play_sound(state, SOUND_EXPLOSION);
+                play_sound(state, SOUND_DEATH);
+                if (event->data.player_damaged.is_game_over) { play_sound(state, SOUND_GAME_OVER); }
+                break;
+            case GAMEPLAY_EVENT_SHOT:
+                play_sound(state, SOUND_LASER);
+                break;
+        }
+    }
+
+    if (shake > 0.0f) { screenshake_add(&state->screenshake, shake); }
+    events->count = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cute_math.h>
+#include <stddef.h>
+
+#include "enemy.h"
+
+typedef struct GameState GameState;
+
+constexpr int MAX_GAMEPLAY_EVENTS = 256;  // Room for every shot, hit and death a single tick can produce
+
+typedef enum GameplayEventType {
+    GAMEPLAY_EVENT_HIT,             // A player bullet hit an enemy that survived
+    GAMEPLAY_EVENT_KILL,            // A player bullet destroyed an enemy
+    GAMEPLAY_EVENT_PLAYER_DAMAGED,  // A player lost a life
+    GAMEPLAY_EVENT_SHOT,            // A player or an enemy fired
+} GameplayEventType;
+
+typedef struct GameplayEvent {
+    GameplayEventType type;
+    CF_V2             position;
+    union {
+        struct {
+            CF_V2 bullet_velocity;
+        } hit;
+        struct {
+            CF_V2     bullet_velocity;
+            EnemyType enemy_type;
+            int       score;
+        } kill;
+        struct {
+            bool is_game_over;
+        } player_damaged;
+        struct {
+            bool is_enemy;
+        } shot;
+    } data;
+} GameplayEvent;
+
+/*
+ * Gameplay Events
+ *
+ * Collision, players and enemies only change gameplay state and record what happened here. After collision,
+ * update_gameplay_events() turns the tick's events into explosions, particles, floating scores, screenshake and
+ * sounds, then clears the buffer. Plain data, and always empty between ticks, so snapshots leave it out.
+ */
+typedef struct GameplayEvents {
+    GameplayEvent items[MAX_GAMEPLAY_EVENTS];
+    size_t        count;
+} GameplayEvents;
+
+void emit_gameplay_event(GameState* state, GameplayEvent event);
+void update_gameplay_events(GameState* state);
@@ -0,0 +1,277 @@
+#include "gfx.h"
+
+#include <cute_c_runtime.h>
+#include <cute_draw.h>
+#include <cute_graphics.h>
+#include <cute_math.h>
+#include <cute_sprite.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../engine/arena.h"
+#include "../engine/game_state.h"
+
+typedef struct GfxSpriteCommand {
+    const char* name;
+    int         frame_index;
+    int         w;
+    int         h;
+} GfxSpriteCommand;
+
+typedef struct GfxQuadCommand {
+    CF_Aabb bounds;
+    float   thickness;
+    float   chubbiness;
+} GfxQuadCommand;
+
+typedef struct GfxTextCommand {
+    CF_V2 position;
+    int   length;  // Followed by `length` bytes of text
+} GfxTextCommand;
+
+typedef struct GfxCanvasCommand {
+    uint64_t canvas;
+    CF_V2    position;
+    CF_V2    size;
+} GfxCanvasCommand;
+
+typedef struct GfxRenderToCommand {
+    uint64_t canvas;
+    bool     clear;
+} GfxRenderToCommand;
+
+static bool is_recording(GameState* state) { return state->gfx.backend == GFX_BACKEND_RECORDING; }
+
+static bool is_state_change(GfxCommandType type) {
+    switch (type) {
+        case GFX_COMMAND_PUSH_LAYER:
+        case GFX_COMMAND_POP_LAYER:
+        case GFX_COMMAND_PUSH_COLOR:
+        case GFX_COMMAND_POP_COLOR:
+        case GFX_COMMAND_PUSH_SHADER:
+        case GFX_COMMAND_POP_SHADER:
+        case GFX_COMMAND_PUSH_ANTIALIAS:
+        case GFX_COMMAND_POP_ANTIALIAS:
+        case GFX_COMMAND_PUSH_VERTEX_ATTRIBUTES:
+        case GFX_COMMAND_POP_VERTEX_ATTRIBUTES:
+        case GFX_COMMAND_PUSH_FONT:
+        case GFX_COMMAND_POP_FONT:
+        case GFX_COMMAND_PUSH_FONT_SIZE:
+        case GFX_COMMAND_POP_FONT_SIZE:
+        case GFX_COMMAND_CLEAR_COLOR:
+        case GFX_COMMAND_RENDER_TO:     return true;
+        default:                        return false;
+    }
+}
+
+// Reserves room for a command and returns its payload, or nullptr when the buffer is full
+static uint8_t* record(GameState* state, GfxCommandType type, size_t size) {
+    auto gfx = &state->gfx;
+    CF_ASSERT(size <= UINT16_MAX);
+
+    const size_t total = sizeof(GfxCommandHeader) + size;
+    if (gfx->size + total > gfx->capacity) {
+        gfx->frame.dropped++;
+        return nullptr;
+    }
+
+    const GfxCommandHeader header  = {.type = (uint16_t)type, .size = (uint16_t)size};
+    uint8_t*               command = gfx->buffer + gfx->size;
+    memcpy(command, &header, sizeof(header));
+    gfx->size += total;
+
+    gfx->frame.commands++;
+    gfx->frame.bytes += total;
+    if (is_state_change(type)) { gfx->frame.state_changes++; }
+
+    return command + sizeof(header);
+}
+
+static void record_payload(GameState* state, GfxCommandType type, const void* payload, size_t size) {
+    uint8_t* destination = record(state, type, size);
+    if (destination && size > 0) { memcpy(destination, payload, size); }
+}
+
+void init_gfx(GameState* state, GfxBackend backend) {
+    state->gfx = (Gfx){
+        .backend  = backend,
+        .buffer   = arena_alloc_required(&state->permanent_arena, GFX_RECORD_BUFFER_SIZE),
+        .capacity = GFX_RECORD_BUFFER_SIZE,
+    };
+}
+
+bool gfx_is_submitting(GameState* state) { return state->gfx.backend == GFX_BACKEND_CUTE || state->gfx.forward; }
+
+void gfx_begin_frame(GameState* state) {
+    auto gfx        = &state->gfx;
+    gfx->last_frame = gfx->frame;
+    gfx->frame      = (GfxStats){0};
+    gfx->size       = 0;
+}
+
+void gfx_push(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_push(); }
+}
+
+void gfx_pop(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_pop(); }
+}
+
+void gfx_translate(GameState* state, CF_V2 position) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_TRANSLATE, &position, sizeof(position)); }
+    if (gfx_is_submitting(state)) { cf_draw_translate_v2(position); }
+}
+
+void gfx_scale(GameState* state, CF_V2 scale) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_SCALE, &scale, sizeof(scale)); }
+    if (gfx_is_submitting(state)) { cf_draw_scale(scale.x, scale.y); }
+}
+
+void gfx_rotate(GameState* state, float radians) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_ROTATE, &radians, sizeof(radians)); }
+    if (gfx_is_submitting(state)) { cf_draw_rotate(radians); }
+}
+
+void gfx_push_layer(GameState* state, int layer) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH_LAYER, &layer, sizeof(layer)); }
+    if (gfx_is_submitting(state)) { cf_draw_push_layer(layer); }
+}
+
+void gfx_pop_layer(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_LAYER, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_pop_layer(); }
+}
+
+void gfx_push_color(GameState* state, CF_Color color) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH_COLOR, &color, sizeof(color)); }
+    if (gfx_is_submitting(state)) { cf_draw_push_color(color); }
+}
+
+void gfx_pop_color(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_COLOR, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_pop_color(); }
+}
+
+void gfx_push_shader(GameState* state, CF_Shader shader) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH_SHADER, &shader.id, sizeof(shader.id)); }
+    if (gfx_is_submitting(state)) { cf_draw_push_shader(shader); }
+}
+
+void gfx_pop_shader(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_SHADER, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_pop_shader(); }
+}
+
+void gfx_push_antialias(GameState* state, bool antialias) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH_ANTIALIAS, &antialias, sizeof(antialias)); }
+    if (gfx_is_submitting(state)) { cf_draw_push_antialias(antialias); }
+}
+
+void gfx_pop_antialias(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_ANTIALIAS, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_pop_antialias(); }
+}
+
+void gfx_push_vertex_attributes(GameState* state, float r, float g, float b, float a) {
+    if (is_recording(state)) {
+        const float attributes[4] = {r, g, b, a};
+        record_payload(state, GFX_COMMAND_PUSH_VERTEX_ATTRIBUTES, attributes, sizeof(attributes));
+    }
+    if (gfx_is_submitting(state)) { cf_draw_push_vertex_attributes(r, g, b, a); }
+}
+
+void gfx_pop_vertex_attributes(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_VERTEX_ATTRIBUTES, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_draw_pop_vertex_attributes(); }
+}
+
+void gfx_push_font(GameState* state, const char* font) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH_FONT, &font, sizeof(font)); }
+    if (gfx_is_submitting(state)) { cf_push_font(font); }
+}
+
+void gfx_pop_font(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_FONT, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_pop_font(); }
+}
+
+void gfx_push_font_size(GameState* state, float size) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_PUSH_FONT_SIZE, &size, sizeof(size)); }
+    if (gfx_is_submitting(state)) { cf_push_font_size(size); }
+}
+
+void gfx_pop_font_size(GameState* state) {
+    if (is_recording(state)) { record_payload(state, GFX_COMMAND_POP_FONT_SIZE, nullptr, 0); }
+    if (gfx_is_submitting(state)) { cf_pop_font_size(); }
+}
+
+void gfx_draw_sprite(GameState* state, const CF_Sprite* sprite) {
+    if (is_recording(state)) {
+        const GfxSpriteCommand command = {
+            .name        = sprite->name,
+            .frame_index = sprite->frame_index,
+            .w           = sprite->w,
+            .h           = sprite->h,
+        };
+        record_payload(state, GFX_COMMAND_SPRITE, &command, sizeof(command));
+    }
+    if (gfx_is_submitting(state)) { cf_draw_sprite(sprite); }
+}
+
+void gfx_draw_quad(GameState* state, CF_Aabb bounds, float thickness, float chubbiness) {
+    if (is_recording(state)) {
+        const GfxQuadCommand command = {.bounds = bounds, .thickness = thickness, .chubbiness = chubbiness};
+        record_payload(state, GFX_COMMAND_QUAD, &command, sizeof(command));
+    }
+    if (gfx_is_submitting(state)) { cf_draw_quad(bounds, thickness, chubbiness); }
+}
+
+void gfx_draw_quad_fill(GameState* state, CF_Aabb bounds, float chubbiness) {
+    if (is_recording(state)) {
+        const GfxQuadCommand command = {.bounds = bounds, .chubbiness = chubbiness};
+        record_payload(state, GFX_COMMAND_QUAD_FILL, &command, sizeof(command));
+    }
+    if (gfx_is_submitting(state)) { cf_draw_quad_fill(bounds, chubbiness); }
+}
+
+void gfx_draw_text(GameState* state, const char* text, CF_V2 position, int length) {
+    if (is_recording(state)) {
+        const GfxTextCommand command = {.position = position, .length = length};
+        uint8_t*             payload = record(state, GFX_COMMAND_TEXT, sizeof(command) + (size_t)length);
+        if (payload) {
+            memcpy(payload, &command, sizeof(command));
+            memcpy(payload + sizeof(command), text, (size_t)length);
+        }
+    }
+    if (gfx_is_submitting(state)) { cf_draw_text(text, position, length); }
+}
+
+void gfx_draw_canvas(GameState* state, CF_Canvas canvas, CF_V2 position, CF_V2 size) {
+    if (is_recording(state)) {
+        const GfxCanvasCommand command = {.canvas = canvas.id, .position = position, .size = size};
+        record_payload(state, GFX_COMMAND_CANVAS, &command, sizeof(command));
+    }
+    if (gfx_is_submitting(state)) { cf_draw_canvas(canvas, position, size); }
+}
+
+void gfx_clear_color(GameState* state, float r, float g, float b, float a) {
+    state->gfx.clear_color = (CF_Color){r, g, b, a};
+    if (is_recording(state)) {
+        const CF_Color color = {r, g, b, a};
+        record_payload(state, GFX_COMMAND_CLEAR_COLOR, &color, sizeof(color));
+    }
+    if (gfx_is_submitting(state)) { cf_clear_color(r, g, b, a); }
+}
+
+CF_Color gfx_get_clear_color(GameState* state) { return state->gfx.clear_color; }
+
+void gfx_render_to(GameState* state, CF_Canvas canvas, bool clear) {
+    if (is_recording(state)) {
+        const GfxRenderToCommand command = {.canvas = canvas.id, .clear = clear};
+        record_payload(state, GFX_COMMAND_RENDER_TO, &command, sizeof(command));
+    }
+    if (gfx_is_submitting(state)) { cf_render_to(canvas, clear); }
+}
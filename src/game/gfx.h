@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cute_color.h>
+#include <cute_defines.h>
+#include <cute_graphics.h>
+#include <cute_math.h>
+#include <cute_sprite.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../engine/cute_macros.h"
+
+typedef struct GameState GameState;
+
+constexpr int GFX_RECORD_BUFFER_SIZE = CF_MB * 4;
+
+typedef enum GfxBackend {
+    GFX_BACKEND_CUTE,       // Submits straight to cute_draw
+    GFX_BACKEND_RECORDING,  // Encodes commands into a byte buffer, no GPU required
+} GfxBackend;
+
+typedef enum GfxCommandType {
+    GFX_COMMAND_PUSH,
+    GFX_COMMAND_POP,
+    GFX_COMMAND_TRANSLATE,
+    GFX_COMMAND_SCALE,
+    GFX_COMMAND_ROTATE,
+    GFX_COMMAND_PUSH_LAYER,
+    GFX_COMMAND_POP_LAYER,
+    GFX_COMMAND_PUSH_COLOR,
+    GFX_COMMAND_POP_COLOR,
+    GFX_COMMAND_PUSH_SHADER,
+    GFX_COMMAND_POP_SHADER,
+    GFX_COMMAND_PUSH_ANTIALIAS,
+    GFX_COMMAND_POP_ANTIALIAS,
+    GFX_COMMAND_PUSH_VERTEX_ATTRIBUTES,
+    GFX_COMMAND_POP_VERTEX_ATTRIBUTES,
+    GFX_COMMAND_PUSH_FONT,
+    GFX_COMMAND_POP_FONT,
+    GFX_COMMAND_PUSH_FONT_SIZE,
+    GFX_COMMAND_POP_FONT_SIZE,
+    GFX_COMMAND_SPRITE,
+    GFX_COMMAND_QUAD,
+    GFX_COMMAND_QUAD_FILL,
+    GFX_COMMAND_TEXT,
+    GFX_COMMAND_CANVAS,
+    GFX_COMMAND_CLEAR_COLOR,
+    GFX_COMMAND_RENDER_TO,
+    GFX_COMMAND_COUNT,
+} GfxCommandType;
+
+/*
+ * Gfx Command Header
+ *
+ * Every recorded command is a header followed by `size` bytes of payload
+ */
+typedef struct GfxCommandHeader {
+    uint16_t type;
+    uint16_t size;
+} GfxCommandHeader;
+
+typedef struct GfxStats {
+    size_t commands;
+    size_t state_changes;  // Layer, color, shader, antialias, vertex attribute, font and render target changes
+    size_t bytes;
+    size_t dropped;  // Commands that did not fit in the record buffer
+} GfxStats;
+
+/*
+ * Gfx
+ *
+ * Thin render interface used by the game instead of calling cf_draw_* directly. The backend is an enum rather
+ * than a table of function pointers, so nothing in GameState points into code that a hot reload unloads.
+ */
+typedef struct Gfx {
+    GfxBackend backend;
+    bool       forward;  // Recording backend also submits to cute, to profile it with a window open
+    uint8_t*   buffer;
+    size_t     capacity;
+    size_t     size;
+    GfxStats   frame;        // Stats of the frame being recorded
+    GfxStats   last_frame;   // Stats of the previous game_render()
+    CF_Color   clear_color;  // Last gfx_clear_color(), cute cannot be asked for it
+} Gfx;
+
+void init_gfx(GameState* state, GfxBackend backend);
+void gfx_begin_frame(GameState* state);
+bool gfx_is_submitting(GameState* state);  // False when only recording, nothing reaches cute or the GPU
+
+void gfx_push(GameState* state);
+void gfx_pop(GameState* state);
+void gfx_translate(GameState* state, CF_V2 position);
+void gfx_scale(GameState* state, CF_V2 scale);
+void gfx_rotate(GameState* state, float radians);
+void gfx_push_layer(GameState* state, int layer);
+void gfx_pop_layer(GameState* state);
+void gfx_push_color(GameState* state, CF_Color color);
+void gfx_pop_color(GameState* state);
+void gfx_push_shader(GameState* state, CF_Shader shader);
+void gfx_pop_shader(GameState* state);
+void gfx_push_antialias(GameState* state, bool antialias);
+void gfx_pop_antialias(GameState* state);
+void gfx_push_vertex_attributes(GameState* state, float r, float g, float b, float a);
+void gfx_pop_vertex_attributes(GameState* state);
+void gfx_push_font(GameState* state, const char* font);
+void gfx_pop_font(GameState* state);
+void gfx_push_font_size(GameState* state, float size);
+void gfx_pop_font_size(GameState* state);
+
+void gfx_draw_sprite(GameState* state, const CF_Sprite* sprite);
+void gfx_draw_quad(GameState* state, CF_Aabb bounds, float thickness, float chubbiness);
+void gfx_draw_quad_fill(GameState* state, CF_Aabb bounds, float chubbiness);
+void gfx_draw_text(GameState* state, const char* text, CF_V2 position, int length);
+void gfx_draw_canvas(GameState* state, CF_Canvas canvas, CF_V2 position, CF_V2 size);
+void gfx_clear_color(GameState* state, float r, float g, float b, float a);
+void gfx_render_to(GameState* state, CF_Canvas canvas, bool clear);
+
+CF_Color gfx_get_clear_color(GameState* state);
+
+#define gfx_draw(state)              CF_SCOPE(gfx_push(state), gfx_pop(state))
+#define gfx_draw_color(state, color) CF_SCOPE(gfx_push_color((state), color), gfx_pop_color(state))
+#define gfx_draw_layer(state, layer) CF_SCOPE(gfx_push_layer((state), layer), gfx_pop_layer(state))
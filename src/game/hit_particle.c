@@ -11,68 +11,71 @@
 
 #include "../engine/game_state.h"
 #include "movement.h"
+#include "sim_math.h"
+#include "soak.h"
 
-HitParticle make_hit_particle(CF_V2 position, CF_V2 direction) {
+HitParticle make_hit_particle(GameState* state, CF_V2 position, CF_V2 direction) {
     // Calculate the base angle from the direction vector
-    float base_angle     = CF_ATAN2F(direction.y, direction.x);
-    float spread         = cf_rnd_range_float(&g_state->rnd, -0.5f, 0.5f);  // ±0.5 radians spread
-    float angle          = base_angle + spread;
-    float speed          = cf_rnd_range_float(&g_state->rnd, 0.5f, 2.0f);
+    float base_angle     = sim_atan2(direction.y, direction.x);
+    float spread         = sim_rnd_range(&state->rnd.particles, -0.5f, 0.5f);  // ±0.5 radians spread
+    float angle          = sim_add(base_angle, spread);
+    float speed          = sim_rnd_range(&state->rnd.particles, 0.5f, 2.0f);
 
     HitParticle particle = (HitParticle){
         .is_alive   = true,
         .position   = position,
-        .velocity   = cf_v2(CF_COSF(angle) * speed, CF_SINF(angle) * speed),
-        .lifetime   = cf_rnd_range_float(&g_state->rnd, 0.5f, 0.85f),
+        .velocity   = sim_polar(angle, speed),
+        .lifetime   = sim_rnd_range(&state->rnd.particles, 0.5f, 0.85f),
         .time_alive = 0.0f,
-        .size       = (float)cf_rnd_range_int(&g_state->rnd, 1, 2),
+        .size       = (float)cf_rnd_range_int(&state->rnd.particles, 1, 2),
         // Use the shared particle sprite (no allocation needed)
-        .sprite     = g_state->sprites.particle,
+        .sprite     = state->sprites.particle,
     };
 
     return particle;
 }
 
-void spawn_hit_particle(HitParticle particle) {
-    CF_ASSERT(g_state->hit_particles);
-    CF_ASSERT(g_state->hit_particles_count < g_state->hit_particles_capacity);
+void spawn_hit_particle(GameState* state, HitParticle particle) {
+    CF_ASSERT(state->hit_particles);
+    if (claim_pool_slots(state, SOAK_POOL_HIT_PARTICLES, 1) == 0) { return; }
 
-    g_state->hit_particles[g_state->hit_particles_count++] = particle;
+    state->hit_particles[state->hit_particles_count++] = particle;
 }
 
-void spawn_hit_particles(size_t count, const HitParticle particles[static restrict count]) {
-    CF_ASSERT(g_state->hit_particles_count + count <= g_state->hit_particles_capacity);
-    CF_MEMCPY(&g_state->hit_particles[g_state->hit_particles_count], particles, count * sizeof(*particles));
+void spawn_hit_particles(GameState* state, size_t count, const HitParticle particles[static restrict count]) {
+    // A nearly full pool takes the start of the burst
+    count = claim_pool_slots(state, SOAK_POOL_HIT_PARTICLES, count);
+    CF_MEMCPY(&state->hit_particles[state->hit_particles_count], particles, count * sizeof(*particles));
 
-    g_state->hit_particles_count += count;
+    state->hit_particles_count += count;
 }
 
-void spawn_hit_particle_burst(size_t count, CF_V2 pos, CF_V2 dir) {
+void spawn_hit_particle_burst(GameState* state, size_t count, CF_V2 pos, CF_V2 dir) {
     HitParticle burst[count];
 
-    for (size_t i = 0; i < count; ++i) { burst[i] = make_hit_particle(pos, dir); }
+    for (size_t i = 0; i < count; ++i) { burst[i] = make_hit_particle(state, pos, dir); }
 
-    spawn_hit_particles(count, burst);
+    spawn_hit_particles(state, count, burst);
 }
 
-void cleanup_hit_particles() {
+void cleanup_hit_particles(GameState* state) {
     size_t write_idx = 0;
 
-    for (size_t i = 0; i < g_state->hit_particles_count; i++) {
-        if (g_state->hit_particles[i].is_alive) { g_state->hit_particles[write_idx++] = g_state->hit_particles[i]; }
+    for (size_t i = 0; i < state->hit_particles_count; i++) {
+        if (state->hit_particles[i].is_alive) { state->hit_particles[write_idx++] = state->hit_particles[i]; }
     }
 
-    g_state->hit_particles_count = write_idx;
+    state->hit_particles_count = write_idx;
 }
 
-void update_hit_particles() {
-    for (size_t i = 0; i < g_state->hit_particles_count; ++i) {
-        auto particle = &g_state->hit_particles[i];
+void update_hit_particles(GameState* state) {
+    for (size_t i = 0; i < state->hit_particles_count; ++i) {
+        auto particle = &state->hit_particles[i];
 
         if (!particle->is_alive) { continue; }
 
         // Update particle lifetime
-        particle->time_alive += CF_DELTA_TIME;
+        sim_count_up(&particle->time_alive);
 
         // Destroy particle if lifetime exceeded
         if (particle->time_alive >= particle->lifetime) {
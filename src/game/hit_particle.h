@@ -4,6 +4,8 @@
 #include <cute_sprite.h>
 #include <stddef.h>
 
+typedef struct GameState GameState;
+
 typedef struct HitParticle {
     CF_V2     position;
     CF_V2     velocity;
@@ -14,9 +16,9 @@ typedef struct HitParticle {
     bool      is_alive;
 } HitParticle;
 
-HitParticle make_hit_particle(CF_V2 position, CF_V2 direction);
-void        spawn_hit_particle(HitParticle hit_particle);
-void        spawn_hit_particles(size_t count, const HitParticle particles[static restrict count]);
-void        spawn_hit_particle_burst(size_t count, CF_V2 pos, CF_V2 dir);
-void        cleanup_hit_particles(void);
-void        update_hit_particles(void);
+HitParticle make_hit_particle(GameState* state, CF_V2 position, CF_V2 direction);
+void        spawn_hit_particle(GameState* state, HitParticle hit_particle);
+void        spawn_hit_particles(GameState* state, size_t count, const HitParticle particles[static restrict count]);
+void        spawn_hit_particle_burst(GameState* state, size_t count, CF_V2 pos, CF_V2 dir);
+void        cleanup_hit_particles(GameState* state);
+void        update_hit_particles(GameState* state);
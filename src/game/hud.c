@@ -0,0 +1,109 @@
+#include "hud.h"
+
+#include <cute_app.h>
+#include <cute_color.h>
+#include <cute_graphics.h>
+#include <cute_math.h>
+#include <cute_sprite.h>
+
+#include "../engine/game_state.h"
+#include "asset/sprite.h"
+#include "component.h"
+#include "gfx.h"
+#include "text_cache.h"
+
+static void draw_shadowed_text(GameState* state, const TextRun* run, CF_V2 position, CF_V2 shadow_offset) {
+    gfx_draw_color(state, cf_make_color_rgb(20, 91, 132)) {
+        draw_text_run(state, run, cf_add_v2(position, shadow_offset));
+    }
+    gfx_draw_color(state, cf_color_white()) { draw_text_run(state, run, position); }
+}
+
+static void draw_wave_banner(GameState* state) {
+    const TextRun* run = text_cache_get_int(&state->text_cache, "TinyAndChunky", 7, "Wave %d", state->hud.wave);
+
+    draw_shadowed_text(state, run, cf_v2(-run->width / 2.0f, -run->height / 2.0f), cf_v2(2, -2));
+}
+
+static void draw_score(GameState* state) {
+    const TextRun* run = text_cache_get_int(&state->text_cache, "TinyAndChunky", 7, "%06d", state->hud.score);
+    const float    offset_x     = cf_app_get_canvas_width() / 2.0f / state->scale - run->width;
+    const float    offset_y     = cf_app_get_canvas_height() / 2.0f / state->scale + run->height / 2;
+    const int      margin_top   = 4;
+    const int      margin_right = 4;
+
+    draw_shadowed_text(state, run, cf_v2(offset_x - margin_right, offset_y - margin_top), cf_v2(1, -1));
+}
+
+static void draw_lives(GameState* state) {
+    const int        icon_margin_right  = 4;
+    const int        icon_margin_bottom = 4;
+    const CF_Sprite* icon               = get_sprite_ptr(state, SPRITE_LIFE_ICON);
+    const float      canvas_half_width  = cf_app_get_canvas_width() / 2.0f / state->scale;
+    const float      canvas_half_height = cf_app_get_canvas_height() / 2.0f / state->scale;
+
+    for (int i = 0; i < state->hud.lives; i++) {
+        float x = canvas_half_width - icon_margin_right - (i + 1) * (icon->w) + icon->w / 2.0f;
+        float y = -canvas_half_height + icon_margin_bottom + icon->h / 4.0f;
+        gfx_draw(state) {
+            gfx_translate(state, cf_v2(x, y));
+            gfx_draw_sprite(state, icon);
+        }
+    }
+}
+
+void init_hud(GameState* state, int canvas_w, int canvas_h) {
+    state->hud = (Hud){
+        .canvas   = cf_make_canvas(cf_canvas_defaults(canvas_w, canvas_h)),
+        .is_dirty = true,
+    };
+}
+
+void invalidate_hud(GameState* state) { state->hud.is_dirty = true; }
+
+void update_hud_canvas(GameState* state) {
+    auto hud              = &state->hud;
+    const bool show_stats = !state->is_game_over;
+    const bool show_wave  = state->wave.is_announcing;
+
+    if (!hud->is_dirty && hud->score == state->score && hud->lives == state->lives &&
+        hud->wave == state->wave.current_wave && hud->show_stats == show_stats && hud->show_wave == show_wave) {
+        return;
+    }
+
+    hud->score      = state->score;
+    hud->lives      = state->lives;
+    hud->wave       = state->wave.current_wave;
+    hud->show_stats = show_stats;
+    hud->show_wave  = show_wave;
+    hud->is_dirty   = false;
+    hud->redraw_count++;
+
+    // gfx_render_to() flushes everything queued so far, so this has to run before anything else is drawn this frame
+    gfx_draw(state) {
+        if (show_wave) { draw_wave_banner(state); }
+        if (show_stats) {
+            draw_score(state);
+            draw_lives(state);
+        }
+    }
+
+    // Clear to transparent so the HUD can be layered over the scene, then restore the background clear color
+    const CF_Color clear_color = gfx_get_clear_color(state);
+    gfx_clear_color(state, 0.0f, 0.0f, 0.0f, 0.0f);
+    gfx_render_to(state, hud->canvas, true);
+    gfx_clear_color(state, clear_color.r, clear_color.g, clear_color.b, clear_color.a);
+}
+
+void render_hud(GameState* state) {
+    gfx_draw(state) {
+        gfx_draw_layer(state, Z_UI) {
+            gfx_draw_canvas(
+                state,
+                state->hud.canvas,
+                cf_v2(0, 0),
+                cf_v2(cf_app_get_canvas_width() / state->scale, cf_app_get_canvas_height() / state->scale)
+            );
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cute_graphics.h>
+#include <stddef.h>
+
+typedef struct GameState GameState;
+
+/*
+ * HUD
+ *
+ * Score, lives and the wave banner are rendered into their own canvas, which is only redrawn when one of the values
+ * shown changes. Every other frame the cached canvas is composited with a single draw.
+ */
+typedef struct Hud {
+    CF_Canvas canvas;
+    int       score;
+    int       lives;
+    int       wave;
+    bool      show_stats;  // Score and lives are hidden on the game over screen
+    bool      show_wave;
+    bool      is_dirty;
+    size_t    redraw_count;
+} Hud;
+
+void init_hud(GameState* state, int canvas_w, int canvas_h);
+void invalidate_hud(GameState* state);
+void update_hud_canvas(GameState* state);
+void render_hud(GameState* state);
@@ -2,10 +2,22 @@
 
 #include <cute_input.h>
 
-void update_input(Input* input) {
-    input->up    = cf_key_down(CF_KEY_W) || cf_key_down(CF_KEY_UP);
-    input->down  = cf_key_down(CF_KEY_S) || cf_key_down(CF_KEY_DOWN);
-    input->left  = cf_key_down(CF_KEY_A) || cf_key_down(CF_KEY_LEFT);
-    input->right = cf_key_down(CF_KEY_D) || cf_key_down(CF_KEY_RIGHT);
-    input->shoot = cf_key_down(CF_KEY_SPACE) || cf_mouse_down(CF_MOUSE_BUTTON_LEFT);
+void update_input(Input* input, InputSource source) {
+    const bool wasd   = source != INPUT_SOURCE_ARROWS;
+    const bool arrows = source != INPUT_SOURCE_WASD;
+
+    input->up         = (wasd && cf_key_down(CF_KEY_W)) || (arrows && cf_key_down(CF_KEY_UP));
+    input->down       = (wasd && cf_key_down(CF_KEY_S)) || (arrows && cf_key_down(CF_KEY_DOWN));
+    input->left       = (wasd && cf_key_down(CF_KEY_A)) || (arrows && cf_key_down(CF_KEY_LEFT));
+    input->right      = (wasd && cf_key_down(CF_KEY_D)) || (arrows && cf_key_down(CF_KEY_RIGHT));
+
+    if (source == INPUT_SOURCE_ARROWS) {
+        input->shoot = cf_key_down(CF_KEY_RCTRL);
+    } else {
+        input->shoot = cf_key_down(CF_KEY_SPACE) || (arrows && cf_mouse_down(CF_MOUSE_BUTTON_LEFT));
+    }
+}
+
+bool is_same_input(Input a, Input b) {
+    return a.up == b.up && a.down == b.down && a.left == b.left && a.right == b.right && a.shoot == b.shoot;
 }
@@ -8,4 +8,11 @@ typedef struct Input {
     bool shoot;
 } Input;
 
-void update_input(Input* input);
+typedef enum InputSource {
+    INPUT_SOURCE_ANY,     // Every binding, for a single player
+    INPUT_SOURCE_WASD,    // WASD and Space
+    INPUT_SOURCE_ARROWS,  // Arrows and Right Ctrl, the second player on a shared keyboard
+} InputSource;
+
+void update_input(Input* input, InputSource source);
+bool is_same_input(Input a, Input b);
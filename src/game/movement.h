@@ -2,7 +2,9 @@
 
 #include <cute_math.h>
 
+#include "sim_math.h"
+
 static inline void update_movement(CF_V2* position, const CF_V2* velocity) {
-    position->x += velocity->x;
-    position->y += velocity->y;
+    position->x = sim_add(position->x, velocity->x);
+    position->y = sim_add(position->y, velocity->y);
 }
@@ -1,25 +1,23 @@
 #include "player.h"
 
 #include <cute_c_runtime.h>
-#include <cute_draw.h>
 #include <cute_math.h>
 #include <cute_sprite.h>
 #include <cute_time.h>
 #include <stddef.h>
 
-#include "../engine/cute_macros.h"
 #include "../engine/game_state.h"
 #include "asset/audio.h"
 #include "asset/sprite.h"
 #include "component.h"
-#include "explosion.h"
-#include "explosion_particle.h"
+#include "gameplay_event.h"
 #include "player_bullet.h"
-#include "screenshake.h"
+#include "render_queue.h"
+#include "sim_math.h"
 
 constexpr float WEAPON_DEFAULT_COOLDOWN = 0.15f;  // Time needed to let the player shoot again
 
-Player make_player(float x, float y) {
+Player make_player(GameState* state, float x, float y) {
     Player player                  = {0};
     player.is_alive                = true;
     player.is_invincible           = false;
@@ -29,6 +27,7 @@ Player make_player(float x, float y) {
     // Position
     player.position.x              = x;
     player.position.y              = y;
+    player.spawn_position          = player.position;
 
     // Velocity
     player.velocity.x              = 0.0f;
@@ -41,8 +40,8 @@ Player make_player(float x, float y) {
     player.input.right             = false;
 
     // Sprites
-    player.sprite                  = get_sprite(SPRITE_PLAYER);  // TODO: Should this not store sprites?
-    player.booster_sprite          = get_sprite(SPRITE_BOOSTERS);
+    player.sprite                  = get_sprite(state, SPRITE_PLAYER);  // TODO: Should this not store sprites?
+    player.booster_sprite          = get_sprite(state, SPRITE_BOOSTERS);
     player.booster_sprite.offset.y = -player.sprite.h;
     player.z_index                 = Z_PLAYER_SPRITE;
     cf_sprite_play(&player.sprite, "default");
@@ -58,40 +57,37 @@ Player make_player(float x, float y) {
     return player;
 }
 
-void damage_player(void) {
-    auto player = &g_state->player;
-
+void damage_player(GameState* state, Player* player) {
     // Only damage if player is alive and not invincible
     if (!player->is_alive || player->is_invincible) { return; }
 
     // Decrement lives
-    g_state->lives--;
-
-    // Create explosion at player position
-    spawn_explosion(make_explosion(player->position));
-    spawn_explosion_particle_burst(player->position, COLOR_SOURCE_PLAYER());
-    screenshake_add(&g_state->screenshake, 4.0f);
-    play_sound(SOUND_EXPLOSION);
-    play_sound(SOUND_DEATH);
+    state->lives--;
 
     // Mark player as dead
     player->is_alive      = false;
     player->is_invincible = false;
 
     // Set respawn delay if player has lives remaining
-    if (g_state->lives > 0) {
+    if (state->lives > 0) {
         player->respawn_delay = 2.0f;  // 2 second respawn delay
     } else {
         // Game over
-        g_state->is_game_over = true;
-        play_sound(SOUND_GAME_OVER);
+        state->is_game_over = true;
     }
+
+    // The explosion and sounds follow from the event after collision
+    emit_gameplay_event(state, (GameplayEvent){
+        .type                = GAMEPLAY_EVENT_PLAYER_DAMAGED,
+        .position            = player->position,
+        .data.player_damaged = {.is_game_over = state->is_game_over},
+    });
 }
 
-void update_player(Player* player) {
+void update_player(GameState* state, Player* player) {
     // Handle respawn delay
     if (!player->is_alive && player->respawn_delay > 0.0f) {
-        player->respawn_delay -= CF_DELTA_TIME;
+        sim_count_down(&player->respawn_delay);
 
         if (player->respawn_delay <= 0.0f) {
             // Respawn player
@@ -100,10 +96,9 @@ void update_player(Player* player) {
             player->invincibility_timer = 3.0f;  // 3 seconds of invincibility
 
             // Reset player position
-            player->position.x          = 0.0f;
-            player->position.y          = -g_state->canvas_size.y / 3;
+            player->position            = player->spawn_position;
 
-            play_sound(SOUND_REVEAL);
+            play_sound(state, SOUND_REVEAL);
         }
 
         return;
@@ -111,7 +106,7 @@ void update_player(Player* player) {
 
     // Handle invincibility timer
     if (player->is_invincible && player->invincibility_timer > 0.0f) {
-        player->invincibility_timer -= CF_DELTA_TIME;
+        sim_count_down(&player->invincibility_timer);
         if (player->invincibility_timer <= 0.0f) { player->is_invincible = false; }
     }
 
@@ -126,17 +121,17 @@ void update_player(Player* player) {
 
     // Handle shooting
     if (player->weapon.time_since_shot < player->weapon.cooldown) {
-        player->weapon.time_since_shot += CF_DELTA_TIME;
+        sim_count_up(&player->weapon.time_since_shot);
     } else if (player->input.shoot) {
         player->weapon.time_since_shot = 0.0f;
 
-        spawn_player_bullet(make_player_bullet(player->position, cf_v2(0, 1)));
+        spawn_player_bullet(state, make_player_bullet(state, player->position, cf_v2(0, 1)));
 
-        play_sound(SOUND_LASER);
+        emit_gameplay_event(state, (GameplayEvent){.type = GAMEPLAY_EVENT_SHOT, .position = player->position});
     }
 }
 
-void render_player(Player* player) {
+void render_player(GameState* state, Player* player) {
     if (!player->is_alive) { return; }
 
     if (player->velocity.x > 0) {
@@ -165,12 +160,7 @@ void render_player(Player* player) {
     }
 
     if (should_render) {
-        cf_draw() {
-            cf_draw_layer(player->z_index) {
-                cf_draw_translate_v2(player->position);
-                cf_draw_sprite(&player->sprite);
-                cf_draw_sprite(&player->booster_sprite);
-            }
-        }
+        render_queue_push_sprite(state, &player->sprite, player->position, cf_v2(1.0f, 1.0f), player->z_index);
+        render_queue_push_sprite(state, &player->booster_sprite, player->position, cf_v2(1.0f, 1.0f), player->z_index);
     }
 }
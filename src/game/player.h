@@ -6,6 +6,10 @@
 #include "component.h"
 #include "input.h"
 
+typedef struct GameState GameState;
+
+constexpr int MAX_PLAYERS = 2;  // Co-op
+
 typedef struct Weapon {
     float cooldown;         // Time between shots in seconds
     float time_since_shot;  // Time since last shot in seconds
@@ -14,6 +18,7 @@ typedef struct Weapon {
 typedef struct Player {
     CF_V2     position;
     CF_V2     velocity;
+    CF_V2     spawn_position;  // Where it respawns
     CF_Sprite sprite;
     CF_Sprite booster_sprite;
     Input     input;
@@ -26,7 +31,7 @@ typedef struct Player {
     ZIndex    z_index;  // Rendering order
 } Player;
 
-Player make_player(float x, float y);
-void   damage_player(void);
-void   update_player(Player* player);
-void   render_player(Player* player);
+Player make_player(GameState* state, float x, float y);
+void   damage_player(GameState* state, Player* player);
+void   update_player(GameState* state, Player* player);
+void   render_player(GameState* state, Player* player);
@@ -8,10 +8,11 @@
 #include "../engine/game_state.h"
 #include "asset/sprite.h"
 #include "component.h"
+#include "soak.h"
 
 constexpr float PLAYER_BULLET_DEFAULT_SPEED = 3.0f;
 
-PlayerBullet make_player_bullet(CF_V2 position, CF_V2 direction) {
+PlayerBullet make_player_bullet(GameState* state, CF_V2 position, CF_V2 direction) {
     PlayerBullet bullet = (PlayerBullet){
         .is_alive = true,
         .position = position,
@@ -22,7 +23,7 @@ PlayerBullet make_player_bullet(CF_V2 position, CF_V2 direction) {
     bullet.velocity.y            = PLAYER_BULLET_DEFAULT_SPEED * direction.y;
 
     // Sprite
-    bullet.sprite                = get_sprite(SPRITE_BULLET);
+    bullet.sprite                = get_sprite(state, SPRITE_BULLET);
     bullet.z_index               = Z_SPRITES;
 
     // Collider
@@ -31,16 +32,16 @@ PlayerBullet make_player_bullet(CF_V2 position, CF_V2 direction) {
     return bullet;
 }
 
-void spawn_player_bullet(PlayerBullet player_bullet) {
-    CF_ASSERT(g_state->player_bullets);
-    CF_ASSERT(g_state->player_bullets_count < g_state->player_bullets_capacity);
-    g_state->player_bullets[g_state->player_bullets_count++] = player_bullet;
+void spawn_player_bullet(GameState* state, PlayerBullet player_bullet) {
+    CF_ASSERT(state->player_bullets);
+    if (claim_pool_slots(state, SOAK_POOL_PLAYER_BULLETS, 1) == 0) { return; }
+    state->player_bullets[state->player_bullets_count++] = player_bullet;
 }
 
-void cleanup_player_bullets() {
+void cleanup_player_bullets(GameState* state) {
     int write_idx = 0;
-    for (size_t i = 0; i < g_state->player_bullets_count; i++) {
-        if (g_state->player_bullets[i].is_alive) { g_state->player_bullets[write_idx++] = g_state->player_bullets[i]; }
+    for (size_t i = 0; i < state->player_bullets_count; i++) {
+        if (state->player_bullets[i].is_alive) { state->player_bullets[write_idx++] = state->player_bullets[i]; }
     }
-    g_state->player_bullets_count = write_idx;
+    state->player_bullets_count = write_idx;
 }
@@ -5,6 +5,8 @@
 
 #include "component.h"
 
+typedef struct GameState GameState;
+
 typedef struct PlayerBullet {
     CF_V2     position;
     CF_V2     velocity;
@@ -14,6 +16,6 @@ typedef struct PlayerBullet {
     ZIndex    z_index;  // Rendering order
 } PlayerBullet;
 
-PlayerBullet make_player_bullet(CF_V2 position, CF_V2 direction);
-void         spawn_player_bullet(PlayerBullet player_bullet);
-void         cleanup_player_bullets(void);
+PlayerBullet make_player_bullet(GameState* state, CF_V2 position, CF_V2 direction);
+void         spawn_player_bullet(GameState* state, PlayerBullet player_bullet);
+void         cleanup_player_bullets(GameState* state);
@@ -1,10 +0,0 @@
-#include "blend.shd"
-
-vec4 shader(vec4 color, vec2 pos, vec2 screen_uv, vec4 params)
-{
-    vec3 a = rgb_to_hsv(color.rgb);
-    vec3 b = rgb_to_hsv(params.rgb);
-    vec3 c = hsv_to_rgb(mix(a, b, params.a));
-    // TODO: Fix the sprite.opacity not being applied.
-    return vec4(c, color.a);
-}
@@ -1,3052 +0,0 @@
-#pragma once
-
-/*
-#extension GL_ARB_shading_language_include : require
-
-#line 1 0
-
-layout(location = 0) in vec2 v_pos;
-layout(location = 1) in flat int v_n;
-layout(location = 2) in vec4 v_ab;
-layout(location = 3) in vec4 v_cd;
-layout(location = 4) in vec4 v_ef;
-layout(location = 5) in vec4 v_gh;
-layout(location = 6) in vec2 v_uv;
-layout(location = 7) in vec4 v_col;
-layout(location = 8) in float v_radius;
-layout(location = 9) in float v_stroke;
-layout(location = 10) in float v_aa;
-layout(location = 11) in float v_type;
-layout(location = 12) in float v_alpha;
-layout(location = 13) in float v_fill;
-layout(location = 14) in vec2 v_posH;
-layout(location = 15) in vec4 v_user;
-
-layout(location = 0) out vec4 result;
-
-layout(set = 2, binding = 0) uniform sampler2D u_image;
-
-layout(set = 3, binding = 0) uniform uniform_block {
- vec2 u_texture_size;
- int u_alpha_discard;
-};
-
-#line 1 "blend.shd"
-
-
-
-
-vec3 rgb_to_hsv(vec3 c)
-{
- vec4 K = vec4(0.0, - 1.0 / 3.0, 2.0 / 3.0, - 1.0);
- vec4 p = c.g < c.b ? vec4(c.bg, K.wz) : vec4(c.gb, K.xy);
- vec4 q = c.r < p.x ? vec4(p.xyw, c.r) : vec4(c.r, p.yzx);
- float d = q.x - min(q.w, q.y);
- float e = 1.0e-10;
- return vec3(abs(q.z + (q.w - q.y) / (6.0 * d + e)), d / (q.x + e), q.x);
-}
-
-vec3 hsv_to_rgb(vec3 c)
-{
- vec3 rgb = clamp(abs(mod(c.x * 6.0 + vec3(0.0, 4.0, 2.0), 6.0) - 3.0) - 1.0, 0.0, 1.0);
- rgb = rgb * rgb * (3.0 - 2.0 * rgb);
- return c.z * mix(vec3(1.0), rgb, c.y);
-}
-
-vec3 hue(vec3 base, vec3 tint)
-{
- base = rgb_to_hsv(base);
- tint = rgb_to_hsv(tint);
- return hsv_to_rgb(vec3(tint.r, base.gb));
-}
-
-vec4 hue(vec4 base, vec4 tint)
-{
- return vec4(hue(base.rgb, tint.rgb), base.a);
-}
-
-float overlay(float base, float blend)
-{
- return(base <= 0.5) ? 2 * base * blend : 1 - 2 * (1 - base) * (1 - blend);
-}
-
-vec3 overlay(vec3 base, vec3 blend)
-{
- return vec3(overlay(base.r, blend.r), overlay(base.g, blend.g), overlay(base.b, blend.b));
-}
-
-vec4 overlay(vec4 base, vec4 blend)
-{
- return vec4(overlay(base.rgb, blend.rgb), base.a);
-}
-
-float softlight(float base, float blend)
-{
- if (blend <= 0.5) return base - (1 - 2 * blend) * base * (1 - base);
- else return base + (2.0 * blend - 1) * ( ( (base <= 0.25) ? ( (16.0 * base - 12.0) * base + 4.0) * base : sqrt(base)) - base);
-}
-
-vec3 softlight(vec3 base, vec3 blend)
-{
- return vec3(softlight(base.r, blend.r), softlight(base.g, blend.g), softlight(base.b, blend.b));
-}
-
-vec4 softlight(vec4 base, vec4 blend)
-{
- return vec4(softlight(base.rgb, blend.rgb), base.a);
-}
-#line 29 0
-#line 1 "gamma.shd"
-
-vec4 gamma(vec4 c)
-{
- return vec4(pow(abs(c.rgb), vec3(1.0 / 2.2)), c.a);
-}
-
-vec4 de_gamma(vec4 c)
-{
- return vec4(pow(abs(c.rgb), vec3(2.2)), c.a);
-}
-#line 30 0
-#line 1 "smooth_uv.shd"
-
-vec2 smooth_uv(vec2 uv, vec2 texture_size)
-{
- vec2 pixel = uv * texture_size;
- vec2 seam = floor(pixel + 0.5);
- pixel = seam + clamp( (pixel - seam) / fwidth(pixel), - 0.5, 0.5);
- return pixel / texture_size;
-}
-#line 31 0
-#line 1 "distance.shd"
-
-float safe_div(float a, float b)
-{
- return b == 0.0 ? 0.0 : a / b;
-}
-
-float safe_len(vec2 v)
-{
- float d = dot(v, v);
- return d == 0.0 ? 0.0 : sqrt(d);
-}
-
-vec2 safe_norm(vec2 v, float l)
-{
- return mix(vec2(0), v / l, l == 0.0 ? 0.0 : 1.0);
-}
-
-vec2 skew(vec2 v)
-{
- return vec2(- v.y, v.x);
-}
-
-float det2(vec2 a, vec2 b)
-{
- return a.x * b.y - a.y * b.x;
-}
-
-float sdf_stroke(float d)
-{
- return abs(d) - v_stroke;
-}
-
-float sdf_intersect(float a, float b)
-{
- return max(a, b);
-}
-
-float sdf_union(float a, float b)
-{
- return min(a, b);
-}
-
-float sdf_subtract(float d0, float d1)
-{
- return max(d0, - d1);
-}
-
-float dd(float d)
-{
- return length(vec2(dFdx(d), dFdy(d)));
-}
-
-
-
-vec4 sdf(vec4 a, vec4 b, float d)
-{
- float wire_d = sdf_stroke(d);
- vec4 stroke_aa = mix(b, a, smoothstep(0.0, v_aa, wire_d));
- vec4 stroke_no_aa = wire_d <= 0.0 ? b : a;
-
- vec4 fill_aa = mix(b, a, smoothstep(0.0, v_aa, d));
- vec4 fill_no_aa = clamp(d, - 1.0, 1.0) <= 0.0 ? b : a;
-
- vec4 stroke = mix(stroke_aa, stroke_aa, v_aa > 0.0 ? 1.0 : 0.0);
- vec4 fill = mix(fill_no_aa, fill_aa, v_aa > 0.0 ? 1.0 : 0.0);
-
- result = mix(stroke, fill, v_fill);
- return result;
-}
-
-float distance_aabb(vec2 p, vec2 he)
-{
- vec2 d = abs(p) - he;
- return length(max(d, 0.0)) + min(max(d.x, d.y), 0.0);
-}
-
-float distance_box(vec2 p, vec2 c, vec2 he, vec2 u)
-{
- mat2 m = transpose(mat2(u, skew(u)));
- p = p - c;
- p = m * p;
- return distance_aabb(p, he);
-}
-
-
-float distance_segment(vec2 p, vec2 a, vec2 b)
-{
- vec2 n = b - a;
- vec2 pa = p - a;
- float d = safe_div(dot(pa, n), dot(n, n));
- float h = clamp(d, 0.0, 1.0);
- return safe_len(pa - h * n);
-}
-
-
-float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
-{
- vec2 e0 = b - a;
- vec2 e1 = c - b;
- vec2 e2 = a - c;
-
- vec2 v0 = p - a;
- vec2 v1 = p - b;
- vec2 v2 = p - c;
-
- vec2 pq0 = v0 - e0 * clamp(safe_div(dot(v0, e0), dot(e0, e0)), 0.0, 1.0);
- vec2 pq1 = v1 - e1 * clamp(safe_div(dot(v1, e1), dot(e1, e1)), 0.0, 1.0);
- vec2 pq2 = v2 - e2 * clamp(safe_div(dot(v2, e2), dot(e2, e2)), 0.0, 1.0);
-
- float s = det2(e0, e2);
- vec2 d = min(min(vec2(dot(pq0, pq0), s * det2(v0, e0)),
-                  vec2(dot(pq1, pq1), s * det2(v1, e1))),
-                  vec2(dot(pq2, pq2), s * det2(v2, e2)));
-
- return - sqrt(d.x) * sign(d.y);
-}
-
-
-float distance_polygon(vec2 p, vec2[8] v, int N)
-{
- float d = dot(p - v[0], p - v[0]);
- float s = 1.0;
- for (int i = 0, j = N - 1; i < N; j = i, i ++) {
-  vec2 e = v[j] - v[i];
-  vec2 w = p - v[i];
-  vec2 b = w - e * clamp(dot(w, e) / dot(e, e), 0.0, 1.0);
-  d = min(d, dot(b, b));
-
-  bvec3 cond = bvec3(p.y >= v[i].y,
-                     p.y < v[j].y,
-                     e.x * w.y > e.y * w.x);
-  if (all(cond) || all(not(cond))) {
-   s = - s;
-  }
- }
-
- return s * sqrt(d);
-}
-#line 32 0
-#line 1 "shader_stub.shd"
-
-
-vec4 shader(vec4 color, vec2 pos, vec2 screen_uv, vec4 params)
-{
-    vec3 a = rgb_to_hsv(color.rgb);
-    vec3 b = rgb_to_hsv(params.rgb);
-    vec3 c = hsv_to_rgb(mix(a, b, params.a));
-
-    return vec4(c, color.a);
-}
-#line 33 0
-
-
-vec2 pts[8];
-
-void main()
-{
- bool is_sprite = v_type >= (0.0 / 255.0) && v_type < (0.5 / 255.0);
- bool is_text = v_type > (0.5 / 255.0) && v_type < (1.5 / 255.0);
- bool is_box = v_type > (1.5 / 255.0) && v_type < (2.5 / 255.0);
- bool is_seg = v_type > (2.5 / 255.0) && v_type < (3.5 / 255.0);
- bool is_tri = v_type > (3.5 / 255.0) && v_type < (4.5 / 255.0);
- bool is_tri_sdf = v_type > (4.5 / 255.0) && v_type < (5.5 / 255.0);
- bool is_poly = v_type > (5.5 / 255.0) && v_type < (6.5 / 255.0);
-
-
- vec4 c = vec4(0);
- c = ! (is_sprite && is_text) ? de_gamma(texture(u_image, smooth_uv(v_uv, u_texture_size))) : c;
- c = is_sprite ? gamma(c) : c;
- c = is_text ? v_col * c.a : c;
- c = is_tri ? v_col : c;
-
-
- float d = 0;
- if (is_box) {
-  d = distance_box(v_pos, v_ab.xy, v_ab.zw, v_cd.xy);
- } else if (is_seg) {
-  d = distance_segment(v_pos, v_ab.xy, v_ab.zw);
-  d = min(d, distance_segment(v_pos, v_ab.zw, v_cd.xy));
- } else if (is_tri_sdf) {
-  d = distance_triangle(v_pos, v_ab.xy, v_ab.zw, v_cd.xy);
- } else if (is_poly) {
-  pts[0] = v_ab.xy;
-  pts[1] = v_ab.zw;
-  pts[2] = v_cd.xy;
-  pts[3] = v_cd.zw;
-  pts[4] = v_ef.xy;
-  pts[5] = v_ef.zw;
-  pts[6] = v_gh.xy;
-  pts[7] = v_gh.zw;
-  d = distance_polygon(v_pos, pts, v_n);
- }
- c = (! is_sprite && ! is_text && ! is_tri) ? sdf(c, v_col, d - v_radius) : c;
-
- c *= v_alpha;
- vec2 screen_uv = (v_posH + vec2(1, - 1)) * 0.5 * vec2(1, - 1);
- c = shader(c, v_pos, screen_uv, v_user);
- if (u_alpha_discard != 0 && c.a == 0) discard;
- result = c;
-}
-
-*/
-#ifndef __EMSCRIPTEN__
-static const uint8_t s_recolor_bytecode_draw_content[24448] = {
-	0x03,0x02,0x23,0x07,0x00,0x03,0x01,0x00,0x0B,0x00,0x08,0x00,0x14,0x04,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0B,0x00,0x06,0x00,
-	0x01,0x00,0x00,0x00,0x47,0x4C,0x53,0x4C,0x2E,0x73,0x74,0x64,0x2E,0x34,0x35,0x30,
-	0x00,0x00,0x00,0x00,0x0E,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x0F,0x00,0x16,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6D,0x61,0x69,0x6E,
-	0x00,0x00,0x00,0x00,0x61,0x01,0x00,0x00,0x6D,0x01,0x00,0x00,0x9C,0x01,0x00,0x00,
-	0x9F,0x01,0x00,0x00,0xF3,0x02,0x00,0x00,0x41,0x03,0x00,0x00,0x61,0x03,0x00,0x00,
-	0x72,0x03,0x00,0x00,0x73,0x03,0x00,0x00,0x74,0x03,0x00,0x00,0xBF,0x03,0x00,0x00,
-	0xC8,0x03,0x00,0x00,0xD1,0x03,0x00,0x00,0xE5,0x03,0x00,0x00,0xF1,0x03,0x00,0x00,
-	0xF6,0x03,0x00,0x00,0xFC,0x03,0x00,0x00,0x10,0x00,0x03,0x00,0x04,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xC2,0x01,0x00,0x00,
-	0x04,0x00,0x09,0x00,0x47,0x4C,0x5F,0x41,0x52,0x42,0x5F,0x73,0x68,0x61,0x64,0x69,
-	0x6E,0x67,0x5F,0x6C,0x61,0x6E,0x67,0x75,0x61,0x67,0x65,0x5F,0x69,0x6E,0x63,0x6C,
-	0x75,0x64,0x65,0x00,0x04,0x00,0x0A,0x00,0x47,0x4C,0x5F,0x47,0x4F,0x4F,0x47,0x4C,
-	0x45,0x5F,0x63,0x70,0x70,0x5F,0x73,0x74,0x79,0x6C,0x65,0x5F,0x6C,0x69,0x6E,0x65,
-	0x5F,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x04,0x00,0x00,0x00,0x6D,0x61,0x69,0x6E,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-	0x0B,0x00,0x00,0x00,0x72,0x67,0x62,0x5F,0x74,0x6F,0x5F,0x68,0x73,0x76,0x28,0x76,
-	0x66,0x33,0x3B,0x00,0x05,0x00,0x03,0x00,0x0A,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
-	0x05,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0x68,0x73,0x76,0x5F,0x74,0x6F,0x5F,0x72,
-	0x67,0x62,0x28,0x76,0x66,0x33,0x3B,0x00,0x05,0x00,0x03,0x00,0x0D,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x14,0x00,0x00,0x00,0x67,0x61,0x6D,0x6D,
-	0x61,0x28,0x76,0x66,0x34,0x3B,0x00,0x00,0x05,0x00,0x03,0x00,0x13,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x64,0x65,0x5F,0x67,
-	0x61,0x6D,0x6D,0x61,0x28,0x76,0x66,0x34,0x3B,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x16,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x05,0x00,0x07,0x00,0x1E,0x00,0x00,0x00,
-	0x73,0x6D,0x6F,0x6F,0x74,0x68,0x5F,0x75,0x76,0x28,0x76,0x66,0x32,0x3B,0x76,0x66,
-	0x32,0x3B,0x00,0x00,0x05,0x00,0x03,0x00,0x1C,0x00,0x00,0x00,0x75,0x76,0x00,0x00,
-	0x05,0x00,0x06,0x00,0x1D,0x00,0x00,0x00,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5F,
-	0x73,0x69,0x7A,0x65,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x24,0x00,0x00,0x00,
-	0x73,0x61,0x66,0x65,0x5F,0x64,0x69,0x76,0x28,0x66,0x31,0x3B,0x66,0x31,0x3B,0x00,
-	0x05,0x00,0x03,0x00,0x22,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x23,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x28,0x00,0x00,0x00,
-	0x73,0x61,0x66,0x65,0x5F,0x6C,0x65,0x6E,0x28,0x76,0x66,0x32,0x3B,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x27,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-	0x2C,0x00,0x00,0x00,0x73,0x6B,0x65,0x77,0x28,0x76,0x66,0x32,0x3B,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x2B,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-	0x31,0x00,0x00,0x00,0x64,0x65,0x74,0x32,0x28,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,
-	0x3B,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x2F,0x00,0x00,0x00,0x61,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x30,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-	0x35,0x00,0x00,0x00,0x73,0x64,0x66,0x5F,0x73,0x74,0x72,0x6F,0x6B,0x65,0x28,0x66,
-	0x31,0x3B,0x00,0x00,0x05,0x00,0x03,0x00,0x34,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
-	0x05,0x00,0x06,0x00,0x3B,0x00,0x00,0x00,0x73,0x64,0x66,0x28,0x76,0x66,0x34,0x3B,
-	0x76,0x66,0x34,0x3B,0x66,0x31,0x3B,0x00,0x05,0x00,0x03,0x00,0x38,0x00,0x00,0x00,
-	0x61,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x39,0x00,0x00,0x00,0x62,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x3A,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x05,0x00,0x08,0x00,
-	0x3F,0x00,0x00,0x00,0x64,0x69,0x73,0x74,0x61,0x6E,0x63,0x65,0x5F,0x61,0x61,0x62,
-	0x62,0x28,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x3D,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x3E,0x00,0x00,0x00,
-	0x68,0x65,0x00,0x00,0x05,0x00,0x0A,0x00,0x46,0x00,0x00,0x00,0x64,0x69,0x73,0x74,
-	0x61,0x6E,0x63,0x65,0x5F,0x62,0x6F,0x78,0x28,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,
-	0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x42,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x43,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x44,0x00,0x00,0x00,0x68,0x65,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x45,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x05,0x00,0x0A,0x00,
-	0x4C,0x00,0x00,0x00,0x64,0x69,0x73,0x74,0x61,0x6E,0x63,0x65,0x5F,0x73,0x65,0x67,
-	0x6D,0x65,0x6E,0x74,0x28,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,
-	0x3B,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x49,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x4A,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x4B,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x05,0x00,0x0B,0x00,0x52,0x00,0x00,0x00,
-	0x64,0x69,0x73,0x74,0x61,0x6E,0x63,0x65,0x5F,0x74,0x72,0x69,0x61,0x6E,0x67,0x6C,
-	0x65,0x28,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,
-	0x32,0x3B,0x00,0x00,0x05,0x00,0x03,0x00,0x4E,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x4F,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x50,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x51,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x05,0x00,0x0A,0x00,0x5E,0x00,0x00,0x00,0x64,0x69,0x73,0x74,
-	0x61,0x6E,0x63,0x65,0x5F,0x70,0x6F,0x6C,0x79,0x67,0x6F,0x6E,0x28,0x76,0x66,0x32,
-	0x3B,0x76,0x66,0x32,0x5B,0x38,0x5D,0x3B,0x69,0x31,0x3B,0x00,0x05,0x00,0x03,0x00,
-	0x5B,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x5C,0x00,0x00,0x00,
-	0x76,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x5D,0x00,0x00,0x00,0x4E,0x00,0x00,0x00,
-	0x05,0x00,0x08,0x00,0x65,0x00,0x00,0x00,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x76,
-	0x66,0x34,0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,0x34,0x3B,0x00,
-	0x05,0x00,0x04,0x00,0x61,0x00,0x00,0x00,0x63,0x6F,0x6C,0x6F,0x72,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x62,0x00,0x00,0x00,0x70,0x6F,0x73,0x00,0x05,0x00,0x05,0x00,
-	0x63,0x00,0x00,0x00,0x73,0x63,0x72,0x65,0x65,0x6E,0x5F,0x75,0x76,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x64,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x73,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x67,0x00,0x00,0x00,0x4B,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x6D,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x8D,0x00,0x00,0x00,
-	0x71,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xA9,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0xB3,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0xCF,0x00,0x00,0x00,0x72,0x67,0x62,0x00,0x05,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
-	0x70,0x69,0x78,0x65,0x6C,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x17,0x01,0x00,0x00,
-	0x73,0x65,0x61,0x6D,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x3A,0x01,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x61,0x01,0x00,0x00,0x76,0x5F,0x73,0x74,
-	0x72,0x6F,0x6B,0x65,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x66,0x01,0x00,0x00,
-	0x77,0x69,0x72,0x65,0x5F,0x64,0x00,0x00,0x05,0x00,0x04,0x00,0x67,0x01,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x6A,0x01,0x00,0x00,
-	0x73,0x74,0x72,0x6F,0x6B,0x65,0x5F,0x61,0x61,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x6D,0x01,0x00,0x00,0x76,0x5F,0x61,0x61,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-	0x73,0x01,0x00,0x00,0x73,0x74,0x72,0x6F,0x6B,0x65,0x5F,0x6E,0x6F,0x5F,0x61,0x61,
-	0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x7B,0x01,0x00,0x00,0x66,0x69,0x6C,0x6C,
-	0x5F,0x61,0x61,0x00,0x05,0x00,0x05,0x00,0x83,0x01,0x00,0x00,0x66,0x69,0x6C,0x6C,
-	0x5F,0x6E,0x6F,0x5F,0x61,0x61,0x00,0x00,0x05,0x00,0x04,0x00,0x8B,0x01,0x00,0x00,
-	0x73,0x74,0x72,0x6F,0x6B,0x65,0x00,0x00,0x05,0x00,0x04,0x00,0x93,0x01,0x00,0x00,
-	0x66,0x69,0x6C,0x6C,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9C,0x01,0x00,0x00,
-	0x72,0x65,0x73,0x75,0x6C,0x74,0x00,0x00,0x05,0x00,0x04,0x00,0x9F,0x01,0x00,0x00,
-	0x76,0x5F,0x66,0x69,0x6C,0x6C,0x00,0x00,0x05,0x00,0x03,0x00,0xA6,0x01,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xBA,0x01,0x00,0x00,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xBC,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xCD,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xCF,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0xD4,0x01,0x00,0x00,0x6E,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0xD8,0x01,0x00,0x00,0x70,0x61,0x00,0x00,0x05,0x00,0x03,0x00,0xDC,0x01,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xE3,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xE4,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xE6,0x01,0x00,0x00,0x68,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xEE,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0xF2,0x01,0x00,0x00,0x65,0x30,0x00,0x00,0x05,0x00,0x03,0x00,
-	0xF6,0x01,0x00,0x00,0x65,0x31,0x00,0x00,0x05,0x00,0x03,0x00,0xFA,0x01,0x00,0x00,
-	0x65,0x32,0x00,0x00,0x05,0x00,0x03,0x00,0xFE,0x01,0x00,0x00,0x76,0x30,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x02,0x02,0x00,0x00,0x76,0x31,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x06,0x02,0x00,0x00,0x76,0x32,0x00,0x00,0x05,0x00,0x03,0x00,0x0A,0x02,0x00,0x00,
-	0x70,0x71,0x30,0x00,0x05,0x00,0x04,0x00,0x13,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x14,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x19,0x02,0x00,0x00,0x70,0x71,0x31,0x00,
-	0x05,0x00,0x04,0x00,0x22,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x23,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x28,0x02,0x00,0x00,0x70,0x71,0x32,0x00,0x05,0x00,0x04,0x00,
-	0x31,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x32,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x37,0x02,0x00,0x00,0x73,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x38,0x02,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x3A,0x02,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x3D,0x02,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x42,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x44,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x4D,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x4F,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x59,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x5B,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x6B,0x02,0x00,0x00,0x64,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x76,0x02,0x00,0x00,0x73,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x77,0x02,0x00,0x00,0x69,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x78,0x02,0x00,0x00,
-	0x6A,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x84,0x02,0x00,0x00,0x65,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x8C,0x02,0x00,0x00,0x77,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x92,0x02,0x00,0x00,0x62,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xA6,0x02,0x00,0x00,
-	0x63,0x6F,0x6E,0x64,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xD5,0x02,0x00,0x00,
-	0x61,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xD6,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xDA,0x02,0x00,0x00,0x62,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xDB,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0xDF,0x02,0x00,0x00,0x63,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0xE6,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-	0xF2,0x02,0x00,0x00,0x69,0x73,0x5F,0x73,0x70,0x72,0x69,0x74,0x65,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xF3,0x02,0x00,0x00,0x76,0x5F,0x74,0x79,0x70,0x65,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xFC,0x02,0x00,0x00,0x69,0x73,0x5F,0x74,0x65,0x78,0x74,0x00,
-	0x05,0x00,0x04,0x00,0x05,0x03,0x00,0x00,0x69,0x73,0x5F,0x62,0x6F,0x78,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x0E,0x03,0x00,0x00,0x69,0x73,0x5F,0x73,0x65,0x67,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x17,0x03,0x00,0x00,0x69,0x73,0x5F,0x74,0x72,0x69,0x00,0x00,
-	0x05,0x00,0x05,0x00,0x20,0x03,0x00,0x00,0x69,0x73,0x5F,0x74,0x72,0x69,0x5F,0x73,
-	0x64,0x66,0x00,0x00,0x05,0x00,0x04,0x00,0x29,0x03,0x00,0x00,0x69,0x73,0x5F,0x70,
-	0x6F,0x6C,0x79,0x00,0x05,0x00,0x03,0x00,0x32,0x03,0x00,0x00,0x63,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x3E,0x03,0x00,0x00,0x75,0x5F,0x69,0x6D,0x61,0x67,0x65,0x00,
-	0x05,0x00,0x04,0x00,0x41,0x03,0x00,0x00,0x76,0x5F,0x75,0x76,0x00,0x00,0x00,0x00,
-	0x05,0x00,0x06,0x00,0x42,0x03,0x00,0x00,0x75,0x6E,0x69,0x66,0x6F,0x72,0x6D,0x5F,
-	0x62,0x6C,0x6F,0x63,0x6B,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x42,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x75,0x5F,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5F,0x73,0x69,
-	0x7A,0x65,0x00,0x00,0x06,0x00,0x07,0x00,0x42,0x03,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x75,0x5F,0x61,0x6C,0x70,0x68,0x61,0x5F,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x00,
-	0x05,0x00,0x03,0x00,0x44,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x45,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x47,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x4D,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x56,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x61,0x03,0x00,0x00,0x76,0x5F,0x63,0x6F,0x6C,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x6E,0x03,0x00,0x00,0x64,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x72,0x03,0x00,0x00,
-	0x76,0x5F,0x70,0x6F,0x73,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x73,0x03,0x00,0x00,
-	0x76,0x5F,0x61,0x62,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x74,0x03,0x00,0x00,
-	0x76,0x5F,0x63,0x64,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x75,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x77,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x7A,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x7D,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x85,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x87,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x8A,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x8F,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x91,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x94,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9D,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9F,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xA2,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xA5,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xAE,0x03,0x00,0x00,
-	0x70,0x74,0x73,0x00,0x05,0x00,0x04,0x00,0xBF,0x03,0x00,0x00,0x76,0x5F,0x65,0x66,
-	0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xC8,0x03,0x00,0x00,0x76,0x5F,0x67,0x68,
-	0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xD1,0x03,0x00,0x00,0x76,0x5F,0x6E,0x00,
-	0x05,0x00,0x04,0x00,0xD2,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xD4,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xD6,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x05,0x00,0xE5,0x03,0x00,0x00,0x76,0x5F,0x72,0x61,0x64,0x69,0x75,0x73,
-	0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xE8,0x03,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xEA,0x03,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xEC,0x03,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xF1,0x03,0x00,0x00,0x76,0x5F,0x61,0x6C,
-	0x70,0x68,0x61,0x00,0x05,0x00,0x05,0x00,0xF5,0x03,0x00,0x00,0x73,0x63,0x72,0x65,
-	0x65,0x6E,0x5F,0x75,0x76,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xF6,0x03,0x00,0x00,
-	0x76,0x5F,0x70,0x6F,0x73,0x48,0x00,0x00,0x05,0x00,0x04,0x00,0xFC,0x03,0x00,0x00,
-	0x76,0x5F,0x75,0x73,0x65,0x72,0x00,0x00,0x05,0x00,0x04,0x00,0xFD,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xFF,0x03,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x01,0x04,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x03,0x04,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x61,0x01,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x6D,0x01,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x9C,0x01,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x9F,0x01,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xF3,0x02,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3E,0x03,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3E,0x03,0x00,0x00,
-	0x22,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x41,0x03,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x42,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x42,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x42,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0x44,0x03,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0x44,0x03,0x00,0x00,0x22,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0x61,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0x72,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0x73,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0x74,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0xBF,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
-	0xC8,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
-	0xD1,0x03,0x00,0x00,0x0E,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xD1,0x03,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xE5,0x03,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xF1,0x03,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xF6,0x03,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xFC,0x03,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,
-	0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,
-	0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x09,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x12,0x00,0x00,0x00,
-	0x10,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x1B,0x00,0x00,0x00,
-	0x19,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x21,0x00,0x05,0x00,
-	0x21,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x04,0x00,0x26,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x21,0x00,0x04,0x00,0x2A,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x21,0x00,0x05,0x00,0x2E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x1A,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x33,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x21,0x00,0x06,0x00,0x37,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
-	0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x07,0x00,
-	0x41,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x1A,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x21,0x00,0x06,0x00,0x48,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x15,0x00,0x04,0x00,0x54,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x54,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
-	0x1C,0x00,0x04,0x00,0x56,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
-	0x20,0x00,0x04,0x00,0x57,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x56,0x00,0x00,0x00,
-	0x15,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x20,0x00,0x04,0x00,0x59,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
-	0x21,0x00,0x06,0x00,0x5A,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x57,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x21,0x00,0x07,0x00,0x60,0x00,0x00,0x00,
-	0x10,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-	0x11,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x68,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x69,0x00,0x00,0x00,
-	0xAB,0xAA,0xAA,0xBE,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6A,0x00,0x00,0x00,
-	0xAB,0xAA,0x2A,0x3F,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,
-	0x00,0x00,0x80,0xBF,0x2C,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,
-	0x68,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x6A,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x54,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x54,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x14,0x00,0x02,0x00,0x74,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x54,0x00,0x00,0x00,
-	0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x54,0x00,0x00,0x00,
-	0xAC,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xB4,0x00,0x00,0x00,0xFF,0xE6,0xDB,0x2E,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xBC,0x00,0x00,0x00,0x00,0x00,0xC0,0x40,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xD3,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x2C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
-	0xD5,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0xD3,0x00,0x00,0x00,0xD4,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,0x00,0x00,0x40,0x40,
-	0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,
-	0x2C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
-	0xDE,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xFA,0x00,0x00,0x00,0x2F,0xBA,0xE8,0x3E,0x2C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
-	0xFB,0x00,0x00,0x00,0xFA,0x00,0x00,0x00,0xFA,0x00,0x00,0x00,0xFA,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0xCD,0xCC,0x0C,0x40,
-	0x2C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x08,0x01,0x00,0x00,
-	0x08,0x01,0x00,0x00,0x08,0x01,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x19,0x01,0x00,0x00,0x00,0x00,0x00,0x3F,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x24,0x01,0x00,0x00,0x00,0x00,0x00,0xBF,0x20,0x00,0x04,0x00,0x60,0x01,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x01,0x00,0x00,
-	0x61,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x01,0x00,0x00,
-	0x6D,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x78,0x01,0x00,0x00,
-	0x74,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x9B,0x01,0x00,0x00,
-	0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x9B,0x01,0x00,0x00,
-	0x9C,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x01,0x00,0x00,
-	0x9F,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x04,0x00,0xB8,0x01,0x00,0x00,
-	0x19,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xB9,0x01,0x00,0x00,
-	0x07,0x00,0x00,0x00,0xB8,0x01,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,
-	0x6D,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,
-	0x7A,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0xA4,0x02,0x00,0x00,
-	0x74,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xA5,0x02,0x00,0x00,
-	0x07,0x00,0x00,0x00,0xA4,0x02,0x00,0x00,0x20,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x01,0x00,0x00,
-	0xF3,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xF9,0x02,0x00,0x00,0x81,0x80,0x00,0x3B,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x02,0x03,0x00,0x00,0xC1,0xC0,0xC0,0x3B,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x0B,0x03,0x00,0x00,0xA1,0xA0,0x20,0x3C,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x14,0x03,0x00,0x00,0xE1,0xE0,0x60,0x3C,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x1D,0x03,0x00,0x00,0x91,0x90,0x90,0x3C,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x26,0x03,0x00,0x00,0xB1,0xB0,0xB0,0x3C,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x2F,0x03,0x00,0x00,0xD1,0xD0,0xD0,0x3C,0x2C,0x00,0x07,0x00,0x10,0x00,0x00,0x00,
-	0x33,0x03,0x00,0x00,0x68,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x68,0x00,0x00,0x00,
-	0x68,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0x3B,0x03,0x00,0x00,0x06,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x03,0x00,0x3C,0x03,0x00,0x00,
-	0x3B,0x03,0x00,0x00,0x20,0x00,0x04,0x00,0x3D,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x3C,0x03,0x00,0x00,0x3B,0x00,0x04,0x00,0x3D,0x03,0x00,0x00,0x3E,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x40,0x03,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x19,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x40,0x03,0x00,0x00,0x41,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x1E,0x00,0x04,0x00,0x42,0x03,0x00,0x00,0x19,0x00,0x00,0x00,
-	0x58,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x43,0x03,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x42,0x03,0x00,0x00,0x3B,0x00,0x04,0x00,0x43,0x03,0x00,0x00,0x44,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x48,0x03,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x19,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x60,0x03,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x10,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x03,0x00,0x00,0x61,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x40,0x03,0x00,0x00,0x72,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x03,0x00,0x00,0x73,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x03,0x00,0x00,0x74,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xAD,0x03,0x00,0x00,0x06,0x00,0x00,0x00,
-	0x56,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xAD,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xB1,0x03,0x00,0x00,0x06,0x00,0x00,0x00,
-	0x19,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xB6,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xBA,0x03,0x00,0x00,
-	0x03,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xBE,0x03,0x00,0x00,
-	0x04,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x03,0x00,0x00,0xBF,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xC3,0x03,0x00,0x00,
-	0x05,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xC7,0x03,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x03,0x00,0x00,0xC8,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xCC,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xD0,0x03,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x58,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xD0,0x03,0x00,0x00,0xD1,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x01,0x00,0x00,0xE5,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x01,0x00,0x00,0xF1,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x40,0x03,0x00,0x00,0xF6,0x03,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2C,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,
-	0xDE,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x60,0x03,0x00,0x00,
-	0xFC,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x06,0x04,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,
-	0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x05,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0xF2,0x02,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0xFC,0x02,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0x05,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0x0E,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0x17,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0x20,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF1,0x02,0x00,0x00,0x29,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x32,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x38,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x45,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x47,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x4D,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x53,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x56,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x5D,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0x6E,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x75,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x77,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x7A,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x7D,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x85,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x87,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x8A,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x8F,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x91,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x94,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x9D,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x9F,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0xA2,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0xA5,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0xD2,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x57,0x00,0x00,0x00,0xD4,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x59,0x00,0x00,0x00,0xD6,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0xE1,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0xE8,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0xEA,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0xEC,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0xF5,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0xFD,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x01,0x04,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x03,0x04,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xF4,0x02,0x00,0x00,
-	0xF3,0x02,0x00,0x00,0xBE,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0xF5,0x02,0x00,0x00,
-	0xF4,0x02,0x00,0x00,0x68,0x00,0x00,0x00,0xF7,0x00,0x03,0x00,0xF7,0x02,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0xF5,0x02,0x00,0x00,0xF6,0x02,0x00,0x00,
-	0xF7,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,0xF6,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xF8,0x02,0x00,0x00,0xF3,0x02,0x00,0x00,0xB8,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0xFA,0x02,0x00,0x00,0xF8,0x02,0x00,0x00,0xF9,0x02,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0xF7,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,0xF7,0x02,0x00,0x00,
-	0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,0xFB,0x02,0x00,0x00,0xF5,0x02,0x00,0x00,
-	0x05,0x00,0x00,0x00,0xFA,0x02,0x00,0x00,0xF6,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xF2,0x02,0x00,0x00,0xFB,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xFD,0x02,0x00,0x00,0xF3,0x02,0x00,0x00,0xBA,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0xFE,0x02,0x00,0x00,0xFD,0x02,0x00,0x00,0xF9,0x02,0x00,0x00,0xF7,0x00,0x03,0x00,
-	0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0xFE,0x02,0x00,0x00,
-	0xFF,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0xFF,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,
-	0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x01,0x03,0x00,0x00,
-	0x02,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x00,0x03,0x00,0x00,0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,0x04,0x03,0x00,0x00,
-	0xFE,0x02,0x00,0x00,0xF7,0x02,0x00,0x00,0x03,0x03,0x00,0x00,0xFF,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xFC,0x02,0x00,0x00,0x04,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,0xBA,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x07,0x03,0x00,0x00,0x06,0x03,0x00,0x00,0x02,0x03,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x09,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x07,0x03,0x00,0x00,0x08,0x03,0x00,0x00,0x09,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x08,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0A,0x03,0x00,0x00,
-	0xF3,0x02,0x00,0x00,0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x0C,0x03,0x00,0x00,
-	0x0A,0x03,0x00,0x00,0x0B,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x09,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x09,0x03,0x00,0x00,0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,
-	0x0D,0x03,0x00,0x00,0x07,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,
-	0x08,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x05,0x03,0x00,0x00,0x0D,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0F,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,
-	0xBA,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x0F,0x03,0x00,0x00,
-	0x0B,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,0x12,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFA,0x00,0x04,0x00,0x10,0x03,0x00,0x00,0x11,0x03,0x00,0x00,0x12,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x11,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x13,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0x15,0x03,0x00,0x00,0x13,0x03,0x00,0x00,0x14,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0x12,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x12,0x03,0x00,0x00,0xF5,0x00,0x07,0x00,
-	0x74,0x00,0x00,0x00,0x16,0x03,0x00,0x00,0x10,0x03,0x00,0x00,0x09,0x03,0x00,0x00,
-	0x15,0x03,0x00,0x00,0x11,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x0E,0x03,0x00,0x00,
-	0x16,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x18,0x03,0x00,0x00,
-	0xF3,0x02,0x00,0x00,0xBA,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x19,0x03,0x00,0x00,
-	0x18,0x03,0x00,0x00,0x14,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,0x1B,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x19,0x03,0x00,0x00,0x1A,0x03,0x00,0x00,
-	0x1B,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x1A,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x1C,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,0xB8,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x1E,0x03,0x00,0x00,0x1C,0x03,0x00,0x00,0x1D,0x03,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x1B,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x1B,0x03,0x00,0x00,
-	0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,0x1F,0x03,0x00,0x00,0x19,0x03,0x00,0x00,
-	0x12,0x03,0x00,0x00,0x1E,0x03,0x00,0x00,0x1A,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x17,0x03,0x00,0x00,0x1F,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x21,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,0xBA,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0x22,0x03,0x00,0x00,0x21,0x03,0x00,0x00,0x1D,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,
-	0x24,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x22,0x03,0x00,0x00,
-	0x23,0x03,0x00,0x00,0x24,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x23,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x25,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,
-	0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x27,0x03,0x00,0x00,0x25,0x03,0x00,0x00,
-	0x26,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x24,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x24,0x03,0x00,0x00,0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,0x28,0x03,0x00,0x00,
-	0x22,0x03,0x00,0x00,0x1B,0x03,0x00,0x00,0x27,0x03,0x00,0x00,0x23,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x20,0x03,0x00,0x00,0x28,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x2A,0x03,0x00,0x00,0xF3,0x02,0x00,0x00,0xBA,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x2B,0x03,0x00,0x00,0x2A,0x03,0x00,0x00,0x26,0x03,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x2D,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x2B,0x03,0x00,0x00,0x2C,0x03,0x00,0x00,0x2D,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x2C,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x2E,0x03,0x00,0x00,
-	0xF3,0x02,0x00,0x00,0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x30,0x03,0x00,0x00,
-	0x2E,0x03,0x00,0x00,0x2F,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x2D,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x2D,0x03,0x00,0x00,0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,
-	0x31,0x03,0x00,0x00,0x2B,0x03,0x00,0x00,0x24,0x03,0x00,0x00,0x30,0x03,0x00,0x00,
-	0x2C,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x29,0x03,0x00,0x00,0x31,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x32,0x03,0x00,0x00,0x33,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x74,0x00,0x00,0x00,0x34,0x03,0x00,0x00,0xF2,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x74,0x00,0x00,0x00,0x35,0x03,0x00,0x00,0xFC,0x02,0x00,0x00,0xA7,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x36,0x03,0x00,0x00,0x34,0x03,0x00,0x00,0x35,0x03,0x00,0x00,
-	0xA8,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0x37,0x03,0x00,0x00,0x36,0x03,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x3A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x37,0x03,0x00,0x00,0x39,0x03,0x00,0x00,0x4F,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x39,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x3C,0x03,0x00,0x00,0x3F,0x03,0x00,0x00,
-	0x3E,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x46,0x03,0x00,0x00,
-	0x41,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x45,0x03,0x00,0x00,0x46,0x03,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x48,0x03,0x00,0x00,0x49,0x03,0x00,0x00,0x44,0x03,0x00,0x00,
-	0x6D,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x4A,0x03,0x00,0x00,
-	0x49,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x47,0x03,0x00,0x00,0x4A,0x03,0x00,0x00,
-	0x39,0x00,0x06,0x00,0x19,0x00,0x00,0x00,0x4B,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,
-	0x45,0x03,0x00,0x00,0x47,0x03,0x00,0x00,0x57,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
-	0x4C,0x03,0x00,0x00,0x3F,0x03,0x00,0x00,0x4B,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x4D,0x03,0x00,0x00,0x4C,0x03,0x00,0x00,0x39,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
-	0x4E,0x03,0x00,0x00,0x17,0x00,0x00,0x00,0x4D,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x38,0x03,0x00,0x00,0x4E,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x3A,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x4F,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0x50,0x03,0x00,0x00,0x32,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x38,0x03,0x00,0x00,
-	0x50,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x3A,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x3A,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x51,0x03,0x00,0x00,
-	0x38,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x32,0x03,0x00,0x00,0x51,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0x52,0x03,0x00,0x00,0xF2,0x02,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x52,0x03,0x00,0x00,0x54,0x03,0x00,0x00,0x59,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x54,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x57,0x03,0x00,0x00,
-	0x32,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x56,0x03,0x00,0x00,0x57,0x03,0x00,0x00,
-	0x39,0x00,0x05,0x00,0x10,0x00,0x00,0x00,0x58,0x03,0x00,0x00,0x14,0x00,0x00,0x00,
-	0x56,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x53,0x03,0x00,0x00,0x58,0x03,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x55,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x59,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x5A,0x03,0x00,0x00,0x32,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x53,0x03,0x00,0x00,0x5A,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0x55,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x55,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x5B,0x03,0x00,0x00,0x53,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x32,0x03,0x00,0x00,0x5B,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0x5C,0x03,0x00,0x00,0xFC,0x02,0x00,0x00,0xF7,0x00,0x03,0x00,0x5F,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x5C,0x03,0x00,0x00,0x5E,0x03,0x00,0x00,
-	0x66,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x5E,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x62,0x03,0x00,0x00,0x61,0x03,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x20,0x00,0x00,0x00,0x63,0x03,0x00,0x00,0x32,0x03,0x00,0x00,0xAC,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x64,0x03,0x00,0x00,0x63,0x03,0x00,0x00,
-	0x8E,0x00,0x05,0x00,0x10,0x00,0x00,0x00,0x65,0x03,0x00,0x00,0x62,0x03,0x00,0x00,
-	0x64,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x5D,0x03,0x00,0x00,0x65,0x03,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x5F,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x66,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x67,0x03,0x00,0x00,0x32,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x5D,0x03,0x00,0x00,0x67,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0x5F,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x5F,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x68,0x03,0x00,0x00,0x5D,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x32,0x03,0x00,0x00,0x68,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0x69,0x03,0x00,0x00,0x17,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0x6A,0x03,0x00,0x00,0x61,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0x6B,0x03,0x00,0x00,0x32,0x03,0x00,0x00,0x50,0x00,0x07,0x00,0x78,0x01,0x00,0x00,
-	0x6C,0x03,0x00,0x00,0x69,0x03,0x00,0x00,0x69,0x03,0x00,0x00,0x69,0x03,0x00,0x00,
-	0x69,0x03,0x00,0x00,0xA9,0x00,0x06,0x00,0x10,0x00,0x00,0x00,0x6D,0x03,0x00,0x00,
-	0x6C,0x03,0x00,0x00,0x6A,0x03,0x00,0x00,0x6B,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x32,0x03,0x00,0x00,0x6D,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x6E,0x03,0x00,0x00,
-	0x68,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0x6F,0x03,0x00,0x00,
-	0x05,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,0x71,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFA,0x00,0x04,0x00,0x6F,0x03,0x00,0x00,0x70,0x03,0x00,0x00,0x81,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x70,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x76,0x03,0x00,0x00,0x72,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x75,0x03,0x00,0x00,
-	0x76,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x78,0x03,0x00,0x00,
-	0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x79,0x03,0x00,0x00,
-	0x78,0x03,0x00,0x00,0x78,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x77,0x03,0x00,0x00,0x79,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x7B,0x03,0x00,0x00,0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,
-	0x19,0x00,0x00,0x00,0x7C,0x03,0x00,0x00,0x7B,0x03,0x00,0x00,0x7B,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x7A,0x03,0x00,0x00,
-	0x7C,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x7E,0x03,0x00,0x00,
-	0x74,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x7F,0x03,0x00,0x00,
-	0x7E,0x03,0x00,0x00,0x7E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x7D,0x03,0x00,0x00,0x7F,0x03,0x00,0x00,0x39,0x00,0x08,0x00,
-	0x06,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x46,0x00,0x00,0x00,0x75,0x03,0x00,0x00,
-	0x77,0x03,0x00,0x00,0x7A,0x03,0x00,0x00,0x7D,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x6E,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x71,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x81,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0x82,0x03,0x00,0x00,0x0E,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,0x84,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x82,0x03,0x00,0x00,0x83,0x03,0x00,0x00,
-	0x99,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x83,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x86,0x03,0x00,0x00,0x72,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x85,0x03,0x00,0x00,0x86,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0x88,0x03,0x00,0x00,0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,
-	0x89,0x03,0x00,0x00,0x88,0x03,0x00,0x00,0x88,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x87,0x03,0x00,0x00,0x89,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x8B,0x03,0x00,0x00,0x73,0x03,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x8C,0x03,0x00,0x00,0x8B,0x03,0x00,0x00,
-	0x8B,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x8A,0x03,0x00,0x00,0x8C,0x03,0x00,0x00,0x39,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
-	0x8D,0x03,0x00,0x00,0x4C,0x00,0x00,0x00,0x85,0x03,0x00,0x00,0x87,0x03,0x00,0x00,
-	0x8A,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x6E,0x03,0x00,0x00,0x8D,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x8E,0x03,0x00,0x00,0x6E,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x90,0x03,0x00,0x00,0x72,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x8F,0x03,0x00,0x00,0x90,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x92,0x03,0x00,0x00,0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,
-	0x19,0x00,0x00,0x00,0x93,0x03,0x00,0x00,0x92,0x03,0x00,0x00,0x92,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x91,0x03,0x00,0x00,
-	0x93,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x95,0x03,0x00,0x00,
-	0x74,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x96,0x03,0x00,0x00,
-	0x95,0x03,0x00,0x00,0x95,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x94,0x03,0x00,0x00,0x96,0x03,0x00,0x00,0x39,0x00,0x07,0x00,
-	0x06,0x00,0x00,0x00,0x97,0x03,0x00,0x00,0x4C,0x00,0x00,0x00,0x8F,0x03,0x00,0x00,
-	0x91,0x03,0x00,0x00,0x94,0x03,0x00,0x00,0x0C,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
-	0x98,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x8E,0x03,0x00,0x00,
-	0x97,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x6E,0x03,0x00,0x00,0x98,0x03,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x84,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0x99,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0x9A,0x03,0x00,0x00,0x20,0x03,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x9C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x9A,0x03,0x00,0x00,0x9B,0x03,0x00,0x00,0xA9,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x9B,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x9E,0x03,0x00,0x00,
-	0x72,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x9D,0x03,0x00,0x00,0x9E,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xA0,0x03,0x00,0x00,0x73,0x03,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0xA1,0x03,0x00,0x00,0xA0,0x03,0x00,0x00,
-	0xA0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x9F,0x03,0x00,0x00,0xA1,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0xA3,0x03,0x00,0x00,0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,
-	0xA4,0x03,0x00,0x00,0xA3,0x03,0x00,0x00,0xA3,0x03,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x03,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xA2,0x03,0x00,0x00,0xA4,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xA6,0x03,0x00,0x00,0x74,0x03,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0xA7,0x03,0x00,0x00,0xA6,0x03,0x00,0x00,
-	0xA6,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xA5,0x03,0x00,0x00,0xA7,0x03,0x00,0x00,0x39,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
-	0xA8,0x03,0x00,0x00,0x52,0x00,0x00,0x00,0x9D,0x03,0x00,0x00,0x9F,0x03,0x00,0x00,
-	0xA2,0x03,0x00,0x00,0xA5,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x6E,0x03,0x00,0x00,
-	0xA8,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x9C,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0xA9,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0xAA,0x03,0x00,0x00,
-	0x29,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,0xAC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFA,0x00,0x04,0x00,0xAA,0x03,0x00,0x00,0xAB,0x03,0x00,0x00,0xAC,0x03,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0xAB,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0xAF,0x03,0x00,0x00,0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,
-	0xB0,0x03,0x00,0x00,0xAF,0x03,0x00,0x00,0xAF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0xB1,0x03,0x00,0x00,0xB2,0x03,0x00,0x00,
-	0xAE,0x03,0x00,0x00,0x6D,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0xB2,0x03,0x00,0x00,
-	0xB0,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xB3,0x03,0x00,0x00,
-	0x73,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0xB4,0x03,0x00,0x00,
-	0xB3,0x03,0x00,0x00,0xB3,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0xB1,0x03,0x00,0x00,0xB5,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,
-	0x7A,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0xB5,0x03,0x00,0x00,0xB4,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xB7,0x03,0x00,0x00,0x74,0x03,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0xB7,0x03,0x00,0x00,
-	0xB7,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0xB1,0x03,0x00,0x00,0xB9,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,0xB6,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xB9,0x03,0x00,0x00,0xB8,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0xBB,0x03,0x00,0x00,0x74,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,
-	0x19,0x00,0x00,0x00,0xBC,0x03,0x00,0x00,0xBB,0x03,0x00,0x00,0xBB,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0xB1,0x03,0x00,0x00,
-	0xBD,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,0xBA,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xBD,0x03,0x00,0x00,0xBC,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0xC0,0x03,0x00,0x00,0xBF,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,
-	0xC1,0x03,0x00,0x00,0xC0,0x03,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0xB1,0x03,0x00,0x00,0xC2,0x03,0x00,0x00,
-	0xAE,0x03,0x00,0x00,0xBE,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xC2,0x03,0x00,0x00,
-	0xC1,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xC4,0x03,0x00,0x00,
-	0xBF,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0xC5,0x03,0x00,0x00,
-	0xC4,0x03,0x00,0x00,0xC4,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0xB1,0x03,0x00,0x00,0xC6,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,
-	0xC3,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xC6,0x03,0x00,0x00,0xC5,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xC9,0x03,0x00,0x00,0xC8,0x03,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0xCA,0x03,0x00,0x00,0xC9,0x03,0x00,0x00,
-	0xC9,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0xB1,0x03,0x00,0x00,0xCB,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,0xC7,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xCB,0x03,0x00,0x00,0xCA,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0xCD,0x03,0x00,0x00,0xC8,0x03,0x00,0x00,0x4F,0x00,0x07,0x00,
-	0x19,0x00,0x00,0x00,0xCE,0x03,0x00,0x00,0xCD,0x03,0x00,0x00,0xCD,0x03,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0xB1,0x03,0x00,0x00,
-	0xCF,0x03,0x00,0x00,0xAE,0x03,0x00,0x00,0xCC,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xCF,0x03,0x00,0x00,0xCE,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0xD3,0x03,0x00,0x00,0x72,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xD2,0x03,0x00,0x00,
-	0xD3,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x56,0x00,0x00,0x00,0xD5,0x03,0x00,0x00,
-	0xAE,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xD4,0x03,0x00,0x00,0xD5,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xD7,0x03,0x00,0x00,0xD1,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xD6,0x03,0x00,0x00,0xD7,0x03,0x00,0x00,0x39,0x00,0x07,0x00,
-	0x06,0x00,0x00,0x00,0xD8,0x03,0x00,0x00,0x5E,0x00,0x00,0x00,0xD2,0x03,0x00,0x00,
-	0xD4,0x03,0x00,0x00,0xD6,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x6E,0x03,0x00,0x00,
-	0xD8,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0xAC,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0xAC,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x9C,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x9C,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x84,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x84,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,0x71,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x71,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0xD9,0x03,0x00,0x00,
-	0xF2,0x02,0x00,0x00,0xA8,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0xDA,0x03,0x00,0x00,
-	0xD9,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0xDB,0x03,0x00,0x00,
-	0xFC,0x02,0x00,0x00,0xA8,0x00,0x04,0x00,0x74,0x00,0x00,0x00,0xDC,0x03,0x00,0x00,
-	0xDB,0x03,0x00,0x00,0xA7,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0xDD,0x03,0x00,0x00,
-	0xDA,0x03,0x00,0x00,0xDC,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0xDE,0x03,0x00,0x00,0x17,0x03,0x00,0x00,0xA8,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0xDF,0x03,0x00,0x00,0xDE,0x03,0x00,0x00,0xA7,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0xE0,0x03,0x00,0x00,0xDD,0x03,0x00,0x00,0xDF,0x03,0x00,0x00,0xF7,0x00,0x03,0x00,
-	0xE3,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0xE0,0x03,0x00,0x00,
-	0xE2,0x03,0x00,0x00,0xEE,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0xE2,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xE4,0x03,0x00,0x00,0x6E,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xE6,0x03,0x00,0x00,0xE5,0x03,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xE7,0x03,0x00,0x00,0xE4,0x03,0x00,0x00,
-	0xE6,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xE9,0x03,0x00,0x00,
-	0x32,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xE8,0x03,0x00,0x00,0xE9,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xEB,0x03,0x00,0x00,0x61,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xEA,0x03,0x00,0x00,0xEB,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xEC,0x03,0x00,0x00,0xE7,0x03,0x00,0x00,0x39,0x00,0x07,0x00,0x10,0x00,0x00,0x00,
-	0xED,0x03,0x00,0x00,0x3B,0x00,0x00,0x00,0xE8,0x03,0x00,0x00,0xEA,0x03,0x00,0x00,
-	0xEC,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xE1,0x03,0x00,0x00,0xED,0x03,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0xE3,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0xEE,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xEF,0x03,0x00,0x00,0x32,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xE1,0x03,0x00,0x00,0xEF,0x03,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0xE3,0x03,0x00,0x00,0xF8,0x00,0x02,0x00,0xE3,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0xE1,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x32,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xF2,0x03,0x00,0x00,0xF1,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0xF3,0x03,0x00,0x00,0x32,0x03,0x00,0x00,0x8E,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
-	0xF4,0x03,0x00,0x00,0xF3,0x03,0x00,0x00,0xF2,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x32,0x03,0x00,0x00,0xF4,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0xF7,0x03,0x00,0x00,0xF6,0x03,0x00,0x00,0x81,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0xF9,0x03,0x00,0x00,0xF7,0x03,0x00,0x00,0xF8,0x03,0x00,0x00,0x8E,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xFA,0x03,0x00,0x00,0xF9,0x03,0x00,0x00,0x19,0x01,0x00,0x00,
-	0x85,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xFB,0x03,0x00,0x00,0xFA,0x03,0x00,0x00,
-	0xF8,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0xF5,0x03,0x00,0x00,0xFB,0x03,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x32,0x03,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xFD,0x03,0x00,0x00,0xFE,0x03,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x72,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xFF,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x02,0x04,0x00,0x00,0xF5,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x01,0x04,0x00,0x00,
-	0x02,0x04,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x04,0x04,0x00,0x00,
-	0xFC,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,0x03,0x04,0x00,0x00,0x04,0x04,0x00,0x00,
-	0x39,0x00,0x08,0x00,0x10,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x65,0x00,0x00,0x00,
-	0xFD,0x03,0x00,0x00,0xFF,0x03,0x00,0x00,0x01,0x04,0x00,0x00,0x03,0x04,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x32,0x03,0x00,0x00,0x05,0x04,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x06,0x04,0x00,0x00,0x07,0x04,0x00,0x00,0x44,0x03,0x00,0x00,0x7A,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x07,0x04,0x00,0x00,
-	0xAB,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x08,0x04,0x00,0x00,
-	0x6D,0x02,0x00,0x00,0xF7,0x00,0x03,0x00,0x0B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFA,0x00,0x04,0x00,0x09,0x04,0x00,0x00,0x0A,0x04,0x00,0x00,0x0B,0x04,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x0A,0x04,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0x0C,0x04,0x00,0x00,0x32,0x03,0x00,0x00,0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x0D,0x04,0x00,0x00,0x0C,0x04,0x00,0x00,0xB4,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x0E,0x04,0x00,0x00,0x0D,0x04,0x00,0x00,0x68,0x00,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x0B,0x04,0x00,0x00,0xF8,0x00,0x02,0x00,0x0B,0x04,0x00,0x00,
-	0xF5,0x00,0x07,0x00,0x74,0x00,0x00,0x00,0x0F,0x04,0x00,0x00,0x09,0x04,0x00,0x00,
-	0xE3,0x03,0x00,0x00,0x0E,0x04,0x00,0x00,0x0A,0x04,0x00,0x00,0xF7,0x00,0x03,0x00,
-	0x11,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x0F,0x04,0x00,0x00,
-	0x10,0x04,0x00,0x00,0x11,0x04,0x00,0x00,0xF8,0x00,0x02,0x00,0x10,0x04,0x00,0x00,
-	0xFC,0x00,0x01,0x00,0xF8,0x00,0x02,0x00,0x11,0x04,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x13,0x04,0x00,0x00,0x32,0x03,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x9C,0x01,0x00,0x00,0x13,0x04,0x00,0x00,0xFD,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
-	0x36,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x09,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x0C,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x67,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x6D,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x76,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x8D,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x94,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
-	0xA9,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
-	0xB3,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x67,0x00,0x00,0x00,
-	0x6C,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,
-	0x0A,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x70,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0x72,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0xB8,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x75,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x77,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x79,0x00,0x00,0x00,
-	0x0A,0x00,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,
-	0x79,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x7B,0x00,0x00,0x00,0x67,0x00,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7B,0x00,0x00,0x00,
-	0x7B,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,
-	0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x80,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-	0x10,0x00,0x00,0x00,0x81,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,
-	0x7F,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x76,0x00,0x00,0x00,
-	0x81,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x78,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x82,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x83,0x00,0x00,0x00,
-	0x0A,0x00,0x00,0x00,0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
-	0x83,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x67,0x00,0x00,0x00,
-	0x4F,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x85,0x00,0x00,0x00,
-	0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x87,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x89,0x00,0x00,0x00,
-	0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x8A,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-	0x10,0x00,0x00,0x00,0x8B,0x00,0x00,0x00,0x87,0x00,0x00,0x00,0x88,0x00,0x00,0x00,
-	0x89,0x00,0x00,0x00,0x8A,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x76,0x00,0x00,0x00,
-	0x8B,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x78,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x78,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,
-	0x76,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x6D,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x8F,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,
-	0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x90,0x00,0x00,0x00,
-	0x8F,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x91,0x00,0x00,0x00,
-	0x6D,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x92,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0x93,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0xF7,0x00,0x03,0x00,
-	0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x93,0x00,0x00,0x00,
-	0x95,0x00,0x00,0x00,0x9F,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x95,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x97,0x00,0x00,0x00,0x6D,0x00,0x00,0x00,
-	0x4F,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x97,0x00,0x00,0x00,
-	0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x99,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,
-	0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9A,0x00,0x00,0x00,
-	0x99,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9B,0x00,0x00,0x00,
-	0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x9C,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x9D,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9B,0x00,0x00,0x00,
-	0x9C,0x00,0x00,0x00,0x9D,0x00,0x00,0x00,0x9A,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x94,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x96,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x9F,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xA0,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xA1,0x00,0x00,0x00,0xA0,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0xA2,0x00,0x00,0x00,0x6D,0x00,0x00,0x00,0x4F,0x00,0x08,0x00,
-	0x07,0x00,0x00,0x00,0xA3,0x00,0x00,0x00,0xA2,0x00,0x00,0x00,0xA2,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xA4,0x00,0x00,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xA5,0x00,0x00,0x00,0xA3,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xA6,0x00,0x00,0x00,
-	0xA3,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,
-	0xA7,0x00,0x00,0x00,0xA1,0x00,0x00,0x00,0xA4,0x00,0x00,0x00,0xA5,0x00,0x00,0x00,
-	0xA6,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x94,0x00,0x00,0x00,0xA7,0x00,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x96,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x96,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xA8,0x00,0x00,0x00,0x94,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x8D,0x00,0x00,0x00,0xA8,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x20,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xAB,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xAD,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,
-	0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xAE,0x00,0x00,0x00,
-	0xAD,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xAF,0x00,0x00,0x00,
-	0x8D,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xB0,0x00,0x00,0x00,0xAF,0x00,0x00,0x00,0x0C,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
-	0xB1,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0xAE,0x00,0x00,0x00,
-	0xB0,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xB2,0x00,0x00,0x00,
-	0xAB,0x00,0x00,0x00,0xB1,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xA9,0x00,0x00,0x00,
-	0xB2,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xB3,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xB5,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,
-	0x71,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB6,0x00,0x00,0x00,
-	0xB5,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xB7,0x00,0x00,0x00,
-	0x8D,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xB8,0x00,0x00,0x00,0xB7,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xB9,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xBA,0x00,0x00,0x00,0xB9,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xBB,0x00,0x00,0x00,0xB8,0x00,0x00,0x00,0xBA,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xBD,0x00,0x00,0x00,0xA9,0x00,0x00,0x00,
-	0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xBE,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,
-	0xBD,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xBF,0x00,0x00,0x00,
-	0xB3,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,
-	0xBE,0x00,0x00,0x00,0xBF,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0xC1,0x00,0x00,0x00,0xBB,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xC2,0x00,0x00,0x00,0xB6,0x00,0x00,0x00,0xC1,0x00,0x00,0x00,
-	0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0xC3,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x04,0x00,0x00,0x00,0xC2,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xC4,0x00,0x00,0x00,0xA9,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xC5,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xC6,0x00,0x00,0x00,0xC5,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xC7,0x00,0x00,0x00,0xB3,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0xC6,0x00,0x00,0x00,0xC7,0x00,0x00,0x00,
-	0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xC9,0x00,0x00,0x00,0xC4,0x00,0x00,0x00,
-	0xC8,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xCA,0x00,0x00,0x00,
-	0x8D,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xCB,0x00,0x00,0x00,0xCA,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
-	0xCC,0x00,0x00,0x00,0xC3,0x00,0x00,0x00,0xC9,0x00,0x00,0x00,0xCB,0x00,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0xCC,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x07,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x0F,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0xCF,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xD0,0x00,0x00,0x00,
-	0x0D,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xD1,0x00,0x00,0x00,0xD0,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0xD2,0x00,0x00,0x00,0xD1,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x07,0x00,0x00,0x00,0xD6,0x00,0x00,0x00,0xD2,0x00,0x00,0x00,0xD2,0x00,0x00,0x00,
-	0xD2,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xD7,0x00,0x00,0x00,
-	0xD6,0x00,0x00,0x00,0xD5,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
-	0xD8,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,
-	0x8D,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xD9,0x00,0x00,0x00,0xD7,0x00,0x00,0x00,
-	0xD8,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0xDB,0x00,0x00,0x00,
-	0xDA,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x07,0x00,0x00,0x00,0xDC,0x00,0x00,0x00,0xD9,0x00,0x00,0x00,0xDB,0x00,0x00,0x00,
-	0x0C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0xDD,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x04,0x00,0x00,0x00,0xDC,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
-	0xDF,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xDD,0x00,0x00,0x00,
-	0xDF,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0xE1,0x00,0x00,0x00,
-	0x68,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x07,0x00,0x00,0x00,0xE2,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
-	0xDE,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0xE3,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xE1,0x00,0x00,0x00,
-	0xE2,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xCF,0x00,0x00,0x00,0xE3,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xE4,0x00,0x00,0x00,0xCF,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xE5,0x00,0x00,0x00,0xCF,0x00,0x00,0x00,
-	0x85,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xE6,0x00,0x00,0x00,0xE4,0x00,0x00,0x00,
-	0xE5,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xE7,0x00,0x00,0x00,
-	0xCF,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xE8,0x00,0x00,0x00,
-	0xE7,0x00,0x00,0x00,0xD4,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
-	0xE9,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0xE9,0x00,0x00,0x00,
-	0xE8,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xEB,0x00,0x00,0x00,
-	0xE6,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xCF,0x00,0x00,0x00,
-	0xEB,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xEC,0x00,0x00,0x00,
-	0x0D,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xED,0x00,0x00,0x00,0xEC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0xEF,0x00,0x00,0x00,0xCF,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xF0,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xF1,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x07,0x00,0x00,0x00,0xF2,0x00,0x00,0x00,0xF1,0x00,0x00,0x00,0xF1,0x00,0x00,0x00,
-	0xF1,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0xF3,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0xEF,0x00,0x00,0x00,
-	0xF2,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xF4,0x00,0x00,0x00,
-	0xF3,0x00,0x00,0x00,0xED,0x00,0x00,0x00,0xFE,0x00,0x02,0x00,0xF4,0x00,0x00,0x00,
-	0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x10,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x11,0x00,0x00,0x00,
-	0x13,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x15,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0xF7,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x4F,0x00,0x08,0x00,
-	0x07,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF7,0x00,0x00,0x00,0xF7,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0C,0x00,0x06,0x00,
-	0x07,0x00,0x00,0x00,0xF9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-	0xF8,0x00,0x00,0x00,0x0C,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0xF9,0x00,0x00,0x00,0xFB,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xFD,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
-	0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,
-	0xFD,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,
-	0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x00,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0xFF,0x00,0x00,0x00,
-	0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x02,0x00,
-	0x02,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
-	0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x18,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x05,0x01,0x00,0x00,0x16,0x00,0x00,0x00,
-	0x4F,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x05,0x01,0x00,0x00,
-	0x05,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x0C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x07,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x04,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x0C,0x00,0x07,0x00,0x07,0x00,0x00,0x00,
-	0x0A,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x07,0x01,0x00,0x00,
-	0x09,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x0B,0x01,0x00,0x00,
-	0x16,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x0C,0x01,0x00,0x00,0x0B,0x01,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x0D,0x01,0x00,0x00,0x0A,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x0E,0x01,0x00,0x00,0x0A,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x0F,0x01,0x00,0x00,0x0A,0x01,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x10,0x01,0x00,0x00,
-	0x0D,0x01,0x00,0x00,0x0E,0x01,0x00,0x00,0x0F,0x01,0x00,0x00,0x0C,0x01,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0x10,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x1D,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x1F,0x00,0x00,0x00,
-	0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x13,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
-	0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x17,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x14,0x01,0x00,0x00,0x1C,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x1D,0x00,0x00,0x00,
-	0x85,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0x14,0x01,0x00,0x00,
-	0x15,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x13,0x01,0x00,0x00,0x16,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0x13,0x01,0x00,0x00,
-	0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x1A,0x01,0x00,0x00,0x19,0x01,0x00,0x00,
-	0x19,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x1B,0x01,0x00,0x00,
-	0x18,0x01,0x00,0x00,0x1A,0x01,0x00,0x00,0x0C,0x00,0x06,0x00,0x19,0x00,0x00,0x00,
-	0x1C,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x1B,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x17,0x01,0x00,0x00,0x1C,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x1D,0x01,0x00,0x00,0x17,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x1E,0x01,0x00,0x00,0x13,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x17,0x01,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x20,0x01,0x00,0x00,0x1E,0x01,0x00,0x00,0x1F,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x21,0x01,0x00,0x00,0x13,0x01,0x00,0x00,
-	0xD1,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x21,0x01,0x00,0x00,
-	0x88,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x20,0x01,0x00,0x00,
-	0x22,0x01,0x00,0x00,0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x25,0x01,0x00,0x00,
-	0x24,0x01,0x00,0x00,0x24,0x01,0x00,0x00,0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0x26,0x01,0x00,0x00,0x19,0x01,0x00,0x00,0x19,0x01,0x00,0x00,0x0C,0x00,0x08,0x00,
-	0x19,0x00,0x00,0x00,0x27,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,
-	0x23,0x01,0x00,0x00,0x25,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x81,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x28,0x01,0x00,0x00,0x1D,0x01,0x00,0x00,0x27,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x13,0x01,0x00,0x00,0x28,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x29,0x01,0x00,0x00,0x13,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x2A,0x01,0x00,0x00,0x1D,0x00,0x00,0x00,0x88,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x2B,0x01,0x00,0x00,0x29,0x01,0x00,0x00,0x2A,0x01,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0x2B,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x20,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x20,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x25,0x00,0x00,0x00,
-	0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0x30,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x2E,0x01,0x00,0x00,0x23,0x00,0x00,0x00,
-	0xB4,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x2F,0x01,0x00,0x00,0x2E,0x01,0x00,0x00,
-	0x68,0x00,0x00,0x00,0xF7,0x00,0x03,0x00,0x32,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFA,0x00,0x04,0x00,0x2F,0x01,0x00,0x00,0x31,0x01,0x00,0x00,0x33,0x01,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x31,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x30,0x01,0x00,0x00,
-	0x68,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x32,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x33,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x34,0x01,0x00,0x00,
-	0x22,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x35,0x01,0x00,0x00,
-	0x23,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x36,0x01,0x00,0x00,
-	0x34,0x01,0x00,0x00,0x35,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x30,0x01,0x00,0x00,
-	0x36,0x01,0x00,0x00,0xF9,0x00,0x02,0x00,0x32,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x32,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x37,0x01,0x00,0x00,
-	0x30,0x01,0x00,0x00,0xFE,0x00,0x02,0x00,0x37,0x01,0x00,0x00,0x38,0x00,0x01,0x00,
-	0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x26,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x29,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
-	0x3A,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
-	0x40,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x3B,0x01,0x00,0x00,0x27,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x3C,0x01,0x00,0x00,0x27,0x00,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x3D,0x01,0x00,0x00,0x3B,0x01,0x00,0x00,0x3C,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x3A,0x01,0x00,0x00,0x3D,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x3E,0x01,0x00,0x00,0x3A,0x01,0x00,0x00,0xB4,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0x3F,0x01,0x00,0x00,0x3E,0x01,0x00,0x00,0x68,0x00,0x00,0x00,0xF7,0x00,0x03,0x00,
-	0x42,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x3F,0x01,0x00,0x00,
-	0x41,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,0x41,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x40,0x01,0x00,0x00,0x68,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0x42,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,0x43,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x44,0x01,0x00,0x00,0x3A,0x01,0x00,0x00,0x0C,0x00,0x06,0x00,
-	0x06,0x00,0x00,0x00,0x45,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,
-	0x44,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x40,0x01,0x00,0x00,0x45,0x01,0x00,0x00,
-	0xF9,0x00,0x02,0x00,0x42,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,0x42,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x46,0x01,0x00,0x00,0x40,0x01,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0x46,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x2D,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x49,0x01,0x00,0x00,
-	0x2B,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x4A,0x01,0x00,0x00,0x49,0x01,0x00,0x00,0x7F,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x4B,0x01,0x00,0x00,0x4A,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0x4C,0x01,0x00,0x00,0x2B,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x4D,0x01,0x00,0x00,0x4C,0x01,0x00,0x00,0x50,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x4E,0x01,0x00,0x00,0x4B,0x01,0x00,0x00,0x4D,0x01,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0x4E,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x2F,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x32,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x51,0x01,0x00,0x00,0x2F,0x00,0x00,0x00,
-	0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x52,0x01,0x00,0x00,
-	0x51,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x53,0x01,0x00,0x00,
-	0x30,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x54,0x01,0x00,0x00,0x53,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x55,0x01,0x00,0x00,0x52,0x01,0x00,0x00,0x54,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x20,0x00,0x00,0x00,0x56,0x01,0x00,0x00,0x2F,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x57,0x01,0x00,0x00,0x56,0x01,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x58,0x01,0x00,0x00,0x30,0x00,0x00,0x00,
-	0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x59,0x01,0x00,0x00,
-	0x58,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5A,0x01,0x00,0x00,
-	0x57,0x01,0x00,0x00,0x59,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x5B,0x01,0x00,0x00,0x55,0x01,0x00,0x00,0x5A,0x01,0x00,0x00,0xFE,0x00,0x02,0x00,
-	0x5B,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x20,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x36,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5E,0x01,0x00,0x00,0x34,0x00,0x00,0x00,
-	0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x5F,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x04,0x00,0x00,0x00,0x5E,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x62,0x01,0x00,0x00,0x61,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x63,0x01,0x00,0x00,0x5F,0x01,0x00,0x00,0x62,0x01,0x00,0x00,0xFE,0x00,0x02,0x00,
-	0x63,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
-	0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x11,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x11,0x00,0x00,0x00,
-	0x39,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x20,0x00,0x00,0x00,0x3A,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x3C,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
-	0x66,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
-	0x67,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x6A,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x73,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x7B,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x83,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x8B,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
-	0x93,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x68,0x01,0x00,0x00,0x3A,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x67,0x01,0x00,0x00,
-	0x68,0x01,0x00,0x00,0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x69,0x01,0x00,0x00,
-	0x35,0x00,0x00,0x00,0x67,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x66,0x01,0x00,0x00,
-	0x69,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x6B,0x01,0x00,0x00,
-	0x39,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x6C,0x01,0x00,0x00,
-	0x38,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6E,0x01,0x00,0x00,
-	0x6D,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6F,0x01,0x00,0x00,
-	0x66,0x01,0x00,0x00,0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x70,0x01,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x6E,0x01,0x00,0x00,
-	0x6F,0x01,0x00,0x00,0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x71,0x01,0x00,0x00,
-	0x70,0x01,0x00,0x00,0x70,0x01,0x00,0x00,0x70,0x01,0x00,0x00,0x70,0x01,0x00,0x00,
-	0x0C,0x00,0x08,0x00,0x10,0x00,0x00,0x00,0x72,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x2E,0x00,0x00,0x00,0x6B,0x01,0x00,0x00,0x6C,0x01,0x00,0x00,0x71,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x6A,0x01,0x00,0x00,0x72,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x74,0x01,0x00,0x00,0x66,0x01,0x00,0x00,0xBC,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x75,0x01,0x00,0x00,0x74,0x01,0x00,0x00,0x68,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x76,0x01,0x00,0x00,0x39,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x77,0x01,0x00,0x00,0x38,0x00,0x00,0x00,
-	0x50,0x00,0x07,0x00,0x78,0x01,0x00,0x00,0x79,0x01,0x00,0x00,0x75,0x01,0x00,0x00,
-	0x75,0x01,0x00,0x00,0x75,0x01,0x00,0x00,0x75,0x01,0x00,0x00,0xA9,0x00,0x06,0x00,
-	0x10,0x00,0x00,0x00,0x7A,0x01,0x00,0x00,0x79,0x01,0x00,0x00,0x76,0x01,0x00,0x00,
-	0x77,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x73,0x01,0x00,0x00,0x7A,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x7C,0x01,0x00,0x00,0x39,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x7D,0x01,0x00,0x00,0x38,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7E,0x01,0x00,0x00,0x6D,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7F,0x01,0x00,0x00,0x3A,0x00,0x00,0x00,
-	0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x31,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x7E,0x01,0x00,0x00,0x7F,0x01,0x00,0x00,
-	0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x81,0x01,0x00,0x00,0x80,0x01,0x00,0x00,
-	0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x0C,0x00,0x08,0x00,
-	0x10,0x00,0x00,0x00,0x82,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,
-	0x7C,0x01,0x00,0x00,0x7D,0x01,0x00,0x00,0x81,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x7B,0x01,0x00,0x00,0x82,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x84,0x01,0x00,0x00,0x3A,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
-	0x85,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x84,0x01,0x00,0x00,
-	0x6B,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0xBC,0x00,0x05,0x00,0x74,0x00,0x00,0x00,
-	0x86,0x01,0x00,0x00,0x85,0x01,0x00,0x00,0x68,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x87,0x01,0x00,0x00,0x39,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x88,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-	0x78,0x01,0x00,0x00,0x89,0x01,0x00,0x00,0x86,0x01,0x00,0x00,0x86,0x01,0x00,0x00,
-	0x86,0x01,0x00,0x00,0x86,0x01,0x00,0x00,0xA9,0x00,0x06,0x00,0x10,0x00,0x00,0x00,
-	0x8A,0x01,0x00,0x00,0x89,0x01,0x00,0x00,0x87,0x01,0x00,0x00,0x88,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x83,0x01,0x00,0x00,0x8A,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x8C,0x01,0x00,0x00,0x6A,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0x8D,0x01,0x00,0x00,0x6A,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x8E,0x01,0x00,0x00,0x6D,0x01,0x00,0x00,0xBA,0x00,0x05,0x00,
-	0x74,0x00,0x00,0x00,0x8F,0x01,0x00,0x00,0x8E,0x01,0x00,0x00,0x68,0x00,0x00,0x00,
-	0xA9,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x90,0x01,0x00,0x00,0x8F,0x01,0x00,0x00,
-	0xDE,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,
-	0x91,0x01,0x00,0x00,0x90,0x01,0x00,0x00,0x90,0x01,0x00,0x00,0x90,0x01,0x00,0x00,
-	0x90,0x01,0x00,0x00,0x0C,0x00,0x08,0x00,0x10,0x00,0x00,0x00,0x92,0x01,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0x8C,0x01,0x00,0x00,0x8D,0x01,0x00,0x00,
-	0x91,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x8B,0x01,0x00,0x00,0x92,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x94,0x01,0x00,0x00,0x83,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x95,0x01,0x00,0x00,0x7B,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x96,0x01,0x00,0x00,0x6D,0x01,0x00,0x00,
-	0xBA,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x97,0x01,0x00,0x00,0x96,0x01,0x00,0x00,
-	0x68,0x00,0x00,0x00,0xA9,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x98,0x01,0x00,0x00,
-	0x97,0x01,0x00,0x00,0xDE,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-	0x10,0x00,0x00,0x00,0x99,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0x98,0x01,0x00,0x00,
-	0x98,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0x0C,0x00,0x08,0x00,0x10,0x00,0x00,0x00,
-	0x9A,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0x94,0x01,0x00,0x00,
-	0x95,0x01,0x00,0x00,0x99,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x93,0x01,0x00,0x00,
-	0x9A,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x9D,0x01,0x00,0x00,
-	0x8B,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x9E,0x01,0x00,0x00,
-	0x93,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xA0,0x01,0x00,0x00,
-	0x9F,0x01,0x00,0x00,0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0xA1,0x01,0x00,0x00,
-	0xA0,0x01,0x00,0x00,0xA0,0x01,0x00,0x00,0xA0,0x01,0x00,0x00,0xA0,0x01,0x00,0x00,
-	0x0C,0x00,0x08,0x00,0x10,0x00,0x00,0x00,0xA2,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x2E,0x00,0x00,0x00,0x9D,0x01,0x00,0x00,0x9E,0x01,0x00,0x00,0xA1,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x9C,0x01,0x00,0x00,0xA2,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x10,0x00,0x00,0x00,0xA3,0x01,0x00,0x00,0x9C,0x01,0x00,0x00,0xFE,0x00,0x02,0x00,
-	0xA3,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x3D,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,
-	0x3E,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x40,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xA6,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xA7,0x01,0x00,0x00,0x3D,0x00,0x00,0x00,0x0C,0x00,0x06,0x00,
-	0x19,0x00,0x00,0x00,0xA8,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-	0xA7,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xA9,0x01,0x00,0x00,
-	0x3E,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xAA,0x01,0x00,0x00,
-	0xA8,0x01,0x00,0x00,0xA9,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0xA6,0x01,0x00,0x00,
-	0xAA,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xAB,0x01,0x00,0x00,
-	0xA6,0x01,0x00,0x00,0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xAC,0x01,0x00,0x00,
-	0x68,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x0C,0x00,0x07,0x00,0x19,0x00,0x00,0x00,
-	0xAD,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xAB,0x01,0x00,0x00,
-	0xAC,0x01,0x00,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0xAE,0x01,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0xAD,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x20,0x00,0x00,0x00,0xAF,0x01,0x00,0x00,0xA6,0x01,0x00,0x00,0x8E,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB0,0x01,0x00,0x00,0xAF,0x01,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xB1,0x01,0x00,0x00,0xA6,0x01,0x00,0x00,
-	0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB2,0x01,0x00,0x00,
-	0xB1,0x01,0x00,0x00,0x0C,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xB3,0x01,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xB0,0x01,0x00,0x00,0xB2,0x01,0x00,0x00,
-	0x0C,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xB4,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x25,0x00,0x00,0x00,0xB3,0x01,0x00,0x00,0x68,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xB5,0x01,0x00,0x00,0xAE,0x01,0x00,0x00,0xB4,0x01,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0xB5,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,
-	0x44,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x47,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xB9,0x01,0x00,0x00,
-	0xBA,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,
-	0xBC,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,
-	0xCD,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,
-	0xCF,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0xBB,0x01,0x00,0x00,0x45,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0xBD,0x01,0x00,0x00,0x45,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xBC,0x01,0x00,0x00,
-	0xBD,0x01,0x00,0x00,0x39,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xBE,0x01,0x00,0x00,
-	0x2C,0x00,0x00,0x00,0xBC,0x01,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0xBF,0x01,0x00,0x00,0xBB,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xBB,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xC1,0x01,0x00,0x00,0xBE,0x01,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xC2,0x01,0x00,0x00,
-	0xBE,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0xC3,0x01,0x00,0x00,0xBF,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0x50,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xC4,0x01,0x00,0x00,0xC1,0x01,0x00,0x00,0xC2,0x01,0x00,0x00,
-	0x50,0x00,0x05,0x00,0xB8,0x01,0x00,0x00,0xC5,0x01,0x00,0x00,0xC3,0x01,0x00,0x00,
-	0xC4,0x01,0x00,0x00,0x54,0x00,0x04,0x00,0xB8,0x01,0x00,0x00,0xC6,0x01,0x00,0x00,
-	0xC5,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0xBA,0x01,0x00,0x00,0xC6,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x42,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xC8,0x01,0x00,0x00,0x43,0x00,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xC9,0x01,0x00,0x00,0xC7,0x01,0x00,0x00,
-	0xC8,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x42,0x00,0x00,0x00,0xC9,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0xB8,0x01,0x00,0x00,0xCA,0x01,0x00,0x00,0xBA,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xCB,0x01,0x00,0x00,0x42,0x00,0x00,0x00,
-	0x91,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xCC,0x01,0x00,0x00,0xCA,0x01,0x00,0x00,
-	0xCB,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x42,0x00,0x00,0x00,0xCC,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x42,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xCD,0x01,0x00,0x00,0xCE,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xD0,0x01,0x00,0x00,0x44,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xCF,0x01,0x00,0x00,0xD0,0x01,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
-	0xD1,0x01,0x00,0x00,0x3F,0x00,0x00,0x00,0xCD,0x01,0x00,0x00,0xCF,0x01,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0xD1,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x4A,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,
-	0x4B,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x4D,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xD4,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xD8,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0xDC,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0xE3,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0xE4,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0xE6,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xEE,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xD5,0x01,0x00,0x00,0x4B,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xD6,0x01,0x00,0x00,0x4A,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xD7,0x01,0x00,0x00,0xD5,0x01,0x00,0x00,0xD6,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xD4,0x01,0x00,0x00,0xD7,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xD9,0x01,0x00,0x00,0x49,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xDA,0x01,0x00,0x00,0x4A,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xDB,0x01,0x00,0x00,0xD9,0x01,0x00,0x00,0xDA,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xD8,0x01,0x00,0x00,0xDB,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xDD,0x01,0x00,0x00,0xD8,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xDE,0x01,0x00,0x00,0xD4,0x01,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xDF,0x01,0x00,0x00,0xDD,0x01,0x00,0x00,0xDE,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0xD4,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0xE1,0x01,0x00,0x00,0xD4,0x01,0x00,0x00,
-	0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xE2,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,
-	0xE1,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0xE3,0x01,0x00,0x00,0xDF,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xE4,0x01,0x00,0x00,0xE2,0x01,0x00,0x00,0x39,0x00,0x06,0x00,
-	0x06,0x00,0x00,0x00,0xE5,0x01,0x00,0x00,0x24,0x00,0x00,0x00,0xE3,0x01,0x00,0x00,
-	0xE4,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0xDC,0x01,0x00,0x00,0xE5,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xE7,0x01,0x00,0x00,0xDC,0x01,0x00,0x00,
-	0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0xE8,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x2B,0x00,0x00,0x00,0xE7,0x01,0x00,0x00,0x68,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xE6,0x01,0x00,0x00,0xE8,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xE9,0x01,0x00,0x00,0xD8,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xEA,0x01,0x00,0x00,0xE6,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xEB,0x01,0x00,0x00,0xD4,0x01,0x00,0x00,0x8E,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xEC,0x01,0x00,0x00,0xEB,0x01,0x00,0x00,0xEA,0x01,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0xED,0x01,0x00,0x00,0xE9,0x01,0x00,0x00,
-	0xEC,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0xEE,0x01,0x00,0x00,0xED,0x01,0x00,0x00,
-	0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x28,0x00,0x00,0x00,
-	0xEE,0x01,0x00,0x00,0xFE,0x00,0x02,0x00,0xEF,0x01,0x00,0x00,0x38,0x00,0x01,0x00,
-	0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x4E,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x4F,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,
-	0x51,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x53,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xF2,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xF6,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xFA,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x0A,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x19,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x28,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x31,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x32,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x37,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x38,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x3A,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x3D,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x42,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x44,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x4D,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x4F,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x59,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x5B,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xF3,0x01,0x00,0x00,0x50,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xF4,0x01,0x00,0x00,0x4F,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xF5,0x01,0x00,0x00,0xF3,0x01,0x00,0x00,0xF4,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xF2,0x01,0x00,0x00,0xF5,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xF7,0x01,0x00,0x00,0x51,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x50,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xF9,0x01,0x00,0x00,0xF7,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xF6,0x01,0x00,0x00,0xF9,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xFB,0x01,0x00,0x00,0x4F,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x51,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0xFD,0x01,0x00,0x00,0xFB,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xFA,0x01,0x00,0x00,0xFD,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x4E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x4F,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x01,0x02,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xFE,0x01,0x00,0x00,0x01,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x4E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x50,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x03,0x02,0x00,0x00,0x04,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x02,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x4E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x51,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x07,0x02,0x00,0x00,0x08,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x06,0x02,0x00,0x00,0x09,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x0B,0x02,0x00,0x00,0xFE,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x0C,0x02,0x00,0x00,0xF2,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x0D,0x02,0x00,0x00,0xFE,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x0E,0x02,0x00,0x00,0xF2,0x01,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x0F,0x02,0x00,0x00,0x0D,0x02,0x00,0x00,0x0E,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0xF2,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x11,0x02,0x00,0x00,0xF2,0x01,0x00,0x00,
-	0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x12,0x02,0x00,0x00,0x10,0x02,0x00,0x00,
-	0x11,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x13,0x02,0x00,0x00,0x0F,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x14,0x02,0x00,0x00,0x12,0x02,0x00,0x00,0x39,0x00,0x06,0x00,
-	0x06,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x13,0x02,0x00,0x00,
-	0x14,0x02,0x00,0x00,0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x16,0x02,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x68,0x00,0x00,0x00,
-	0xDE,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x17,0x02,0x00,0x00,
-	0x0C,0x02,0x00,0x00,0x16,0x02,0x00,0x00,0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0x18,0x02,0x00,0x00,0x0B,0x02,0x00,0x00,0x17,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x0A,0x02,0x00,0x00,0x18,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x1A,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x1B,0x02,0x00,0x00,0xF6,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x1C,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x1D,0x02,0x00,0x00,0xF6,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x1E,0x02,0x00,0x00,0x1C,0x02,0x00,0x00,0x1D,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x1F,0x02,0x00,0x00,0xF6,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0xF6,0x01,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x21,0x02,0x00,0x00,0x1F,0x02,0x00,0x00,0x20,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x22,0x02,0x00,0x00,0x1E,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x23,0x02,0x00,0x00,0x21,0x02,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
-	0x24,0x02,0x00,0x00,0x24,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x23,0x02,0x00,0x00,
-	0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x25,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x2B,0x00,0x00,0x00,0x24,0x02,0x00,0x00,0x68,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
-	0x8E,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x26,0x02,0x00,0x00,0x1B,0x02,0x00,0x00,
-	0x25,0x02,0x00,0x00,0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x27,0x02,0x00,0x00,
-	0x1A,0x02,0x00,0x00,0x26,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x19,0x02,0x00,0x00,
-	0x27,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x29,0x02,0x00,0x00,
-	0x06,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x2A,0x02,0x00,0x00,
-	0xFA,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x2B,0x02,0x00,0x00,
-	0x06,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x2C,0x02,0x00,0x00,
-	0xFA,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x2D,0x02,0x00,0x00,
-	0x2B,0x02,0x00,0x00,0x2C,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x2E,0x02,0x00,0x00,0xFA,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x2F,0x02,0x00,0x00,0xFA,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x30,0x02,0x00,0x00,0x2E,0x02,0x00,0x00,0x2F,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x31,0x02,0x00,0x00,0x2D,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x32,0x02,0x00,0x00,
-	0x30,0x02,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x33,0x02,0x00,0x00,
-	0x24,0x00,0x00,0x00,0x31,0x02,0x00,0x00,0x32,0x02,0x00,0x00,0x0C,0x00,0x08,0x00,
-	0x06,0x00,0x00,0x00,0x34,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,
-	0x33,0x02,0x00,0x00,0x68,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x35,0x02,0x00,0x00,0x2A,0x02,0x00,0x00,0x34,0x02,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x36,0x02,0x00,0x00,0x29,0x02,0x00,0x00,
-	0x35,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x28,0x02,0x00,0x00,0x36,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x39,0x02,0x00,0x00,0xF2,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x38,0x02,0x00,0x00,0x39,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x3B,0x02,0x00,0x00,0xFA,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x3A,0x02,0x00,0x00,0x3B,0x02,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
-	0x3C,0x02,0x00,0x00,0x31,0x00,0x00,0x00,0x38,0x02,0x00,0x00,0x3A,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x37,0x02,0x00,0x00,0x3C,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x3E,0x02,0x00,0x00,0x0A,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x3F,0x02,0x00,0x00,0x0A,0x02,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x40,0x02,0x00,0x00,0x3E,0x02,0x00,0x00,0x3F,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x41,0x02,0x00,0x00,0x37,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x43,0x02,0x00,0x00,0xFE,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x42,0x02,0x00,0x00,0x43,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x45,0x02,0x00,0x00,0xF2,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x44,0x02,0x00,0x00,0x45,0x02,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
-	0x46,0x02,0x00,0x00,0x31,0x00,0x00,0x00,0x42,0x02,0x00,0x00,0x44,0x02,0x00,0x00,
-	0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x47,0x02,0x00,0x00,0x41,0x02,0x00,0x00,
-	0x46,0x02,0x00,0x00,0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x48,0x02,0x00,0x00,
-	0x40,0x02,0x00,0x00,0x47,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x49,0x02,0x00,0x00,0x19,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x4A,0x02,0x00,0x00,0x19,0x02,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x4B,0x02,0x00,0x00,0x49,0x02,0x00,0x00,0x4A,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x4C,0x02,0x00,0x00,0x37,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x4E,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x4D,0x02,0x00,0x00,0x4E,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x50,0x02,0x00,0x00,0xF6,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x4F,0x02,0x00,0x00,
-	0x50,0x02,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x51,0x02,0x00,0x00,
-	0x31,0x00,0x00,0x00,0x4D,0x02,0x00,0x00,0x4F,0x02,0x00,0x00,0x85,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x52,0x02,0x00,0x00,0x4C,0x02,0x00,0x00,0x51,0x02,0x00,0x00,
-	0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x53,0x02,0x00,0x00,0x4B,0x02,0x00,0x00,
-	0x52,0x02,0x00,0x00,0x0C,0x00,0x07,0x00,0x19,0x00,0x00,0x00,0x54,0x02,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x48,0x02,0x00,0x00,0x53,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x55,0x02,0x00,0x00,0x28,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x56,0x02,0x00,0x00,0x28,0x02,0x00,0x00,
-	0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x57,0x02,0x00,0x00,0x55,0x02,0x00,0x00,
-	0x56,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x58,0x02,0x00,0x00,
-	0x37,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x5A,0x02,0x00,0x00,
-	0x06,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x59,0x02,0x00,0x00,0x5A,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x5C,0x02,0x00,0x00,0xFA,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x5B,0x02,0x00,0x00,0x5C,0x02,0x00,0x00,0x39,0x00,0x06,0x00,
-	0x06,0x00,0x00,0x00,0x5D,0x02,0x00,0x00,0x31,0x00,0x00,0x00,0x59,0x02,0x00,0x00,
-	0x5B,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5E,0x02,0x00,0x00,
-	0x58,0x02,0x00,0x00,0x5D,0x02,0x00,0x00,0x50,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0x5F,0x02,0x00,0x00,0x57,0x02,0x00,0x00,0x5E,0x02,0x00,0x00,0x0C,0x00,0x07,0x00,
-	0x19,0x00,0x00,0x00,0x60,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
-	0x54,0x02,0x00,0x00,0x5F,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x3D,0x02,0x00,0x00,
-	0x60,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x61,0x02,0x00,0x00,
-	0x3D,0x02,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x62,0x02,0x00,0x00,0x61,0x02,0x00,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
-	0x63,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x62,0x02,0x00,0x00,
-	0x7F,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x64,0x02,0x00,0x00,0x63,0x02,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0x65,0x02,0x00,0x00,0x3D,0x02,0x00,0x00,
-	0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x66,0x02,0x00,0x00,
-	0x65,0x02,0x00,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x67,0x02,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x66,0x02,0x00,0x00,0x85,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x68,0x02,0x00,0x00,0x64,0x02,0x00,0x00,0x67,0x02,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0x68,0x02,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,0x5B,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x57,0x00,0x00,0x00,0x5C,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x59,0x00,0x00,0x00,
-	0x5D,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x5F,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x6B,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x00,0x00,0x00,0x76,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x59,0x00,0x00,0x00,0x77,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x59,0x00,0x00,0x00,0x78,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x84,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x8C,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x1A,0x00,0x00,0x00,0x92,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0xA5,0x02,0x00,0x00,0xA6,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x6C,0x02,0x00,0x00,0x5B,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x1A,0x00,0x00,0x00,0x6E,0x02,0x00,0x00,0x5C,0x00,0x00,0x00,0x6D,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x6F,0x02,0x00,0x00,0x6E,0x02,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x70,0x02,0x00,0x00,0x6C,0x02,0x00,0x00,
-	0x6F,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x71,0x02,0x00,0x00,
-	0x5B,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1A,0x00,0x00,0x00,0x72,0x02,0x00,0x00,
-	0x5C,0x00,0x00,0x00,0x6D,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x73,0x02,0x00,0x00,0x72,0x02,0x00,0x00,0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0x74,0x02,0x00,0x00,0x71,0x02,0x00,0x00,0x73,0x02,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x75,0x02,0x00,0x00,0x70,0x02,0x00,0x00,0x74,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x6B,0x02,0x00,0x00,0x75,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x76,0x02,0x00,0x00,0xDE,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x77,0x02,0x00,0x00,
-	0x6D,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x79,0x02,0x00,0x00,
-	0x5D,0x00,0x00,0x00,0x82,0x00,0x05,0x00,0x58,0x00,0x00,0x00,0x7B,0x02,0x00,0x00,
-	0x79,0x02,0x00,0x00,0x7A,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x78,0x02,0x00,0x00,
-	0x7B,0x02,0x00,0x00,0xF9,0x00,0x02,0x00,0x7C,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x7C,0x02,0x00,0x00,0xF6,0x00,0x04,0x00,0x7E,0x02,0x00,0x00,0x7F,0x02,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x80,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x80,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x81,0x02,0x00,0x00,
-	0x77,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x82,0x02,0x00,0x00,
-	0x5D,0x00,0x00,0x00,0xB1,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0x83,0x02,0x00,0x00,
-	0x81,0x02,0x00,0x00,0x82,0x02,0x00,0x00,0xFA,0x00,0x04,0x00,0x83,0x02,0x00,0x00,
-	0x7D,0x02,0x00,0x00,0x7E,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,0x7D,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x85,0x02,0x00,0x00,0x78,0x02,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x1A,0x00,0x00,0x00,0x86,0x02,0x00,0x00,0x5C,0x00,0x00,0x00,
-	0x85,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x87,0x02,0x00,0x00,
-	0x86,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0x88,0x02,0x00,0x00,
-	0x77,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x1A,0x00,0x00,0x00,0x89,0x02,0x00,0x00,
-	0x5C,0x00,0x00,0x00,0x88,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x8A,0x02,0x00,0x00,0x89,0x02,0x00,0x00,0x83,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0x8B,0x02,0x00,0x00,0x87,0x02,0x00,0x00,0x8A,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x84,0x02,0x00,0x00,0x8B,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
-	0x8D,0x02,0x00,0x00,0x5B,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,
-	0x8E,0x02,0x00,0x00,0x77,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x1A,0x00,0x00,0x00,
-	0x8F,0x02,0x00,0x00,0x5C,0x00,0x00,0x00,0x8E,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x90,0x02,0x00,0x00,0x8F,0x02,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x91,0x02,0x00,0x00,0x8D,0x02,0x00,0x00,0x90,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x8C,0x02,0x00,0x00,0x91,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x93,0x02,0x00,0x00,0x8C,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x94,0x02,0x00,0x00,0x84,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x95,0x02,0x00,0x00,0x8C,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0x96,0x02,0x00,0x00,0x84,0x02,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x97,0x02,0x00,0x00,0x95,0x02,0x00,0x00,0x96,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x98,0x02,0x00,0x00,0x84,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x99,0x02,0x00,0x00,0x84,0x02,0x00,0x00,
-	0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9A,0x02,0x00,0x00,0x98,0x02,0x00,0x00,
-	0x99,0x02,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9B,0x02,0x00,0x00,
-	0x97,0x02,0x00,0x00,0x9A,0x02,0x00,0x00,0x0C,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
-	0x9C,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x9B,0x02,0x00,0x00,
-	0x68,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
-	0x9D,0x02,0x00,0x00,0x94,0x02,0x00,0x00,0x9C,0x02,0x00,0x00,0x83,0x00,0x05,0x00,
-	0x19,0x00,0x00,0x00,0x9E,0x02,0x00,0x00,0x93,0x02,0x00,0x00,0x9D,0x02,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x92,0x02,0x00,0x00,0x9E,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x9F,0x02,0x00,0x00,0x6B,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xA0,0x02,0x00,0x00,0x92,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x19,0x00,0x00,0x00,0xA1,0x02,0x00,0x00,0x92,0x02,0x00,0x00,0x94,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xA2,0x02,0x00,0x00,0xA0,0x02,0x00,0x00,0xA1,0x02,0x00,0x00,
-	0x0C,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xA3,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x25,0x00,0x00,0x00,0x9F,0x02,0x00,0x00,0xA2,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x6B,0x02,0x00,0x00,0xA3,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xA7,0x02,0x00,0x00,0x5B,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xA8,0x02,0x00,0x00,0xA7,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x58,0x00,0x00,0x00,0xA9,0x02,0x00,0x00,0x77,0x02,0x00,0x00,0x41,0x00,0x06,0x00,
-	0x20,0x00,0x00,0x00,0xAA,0x02,0x00,0x00,0x5C,0x00,0x00,0x00,0xA9,0x02,0x00,0x00,
-	0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xAB,0x02,0x00,0x00,
-	0xAA,0x02,0x00,0x00,0xBE,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0xAC,0x02,0x00,0x00,
-	0xA8,0x02,0x00,0x00,0xAB,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xAD,0x02,0x00,0x00,0x5B,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xAE,0x02,0x00,0x00,0xAD,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x58,0x00,0x00,0x00,0xAF,0x02,0x00,0x00,0x78,0x02,0x00,0x00,0x41,0x00,0x06,0x00,
-	0x20,0x00,0x00,0x00,0xB0,0x02,0x00,0x00,0x5C,0x00,0x00,0x00,0xAF,0x02,0x00,0x00,
-	0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB1,0x02,0x00,0x00,
-	0xB0,0x02,0x00,0x00,0xB8,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0xB2,0x02,0x00,0x00,
-	0xAE,0x02,0x00,0x00,0xB1,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xB3,0x02,0x00,0x00,0x84,0x02,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xB4,0x02,0x00,0x00,0xB3,0x02,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x20,0x00,0x00,0x00,0xB5,0x02,0x00,0x00,0x8C,0x02,0x00,0x00,0x6E,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB6,0x02,0x00,0x00,0xB5,0x02,0x00,0x00,
-	0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xB7,0x02,0x00,0x00,0xB4,0x02,0x00,0x00,
-	0xB6,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xB8,0x02,0x00,0x00,
-	0x84,0x02,0x00,0x00,0x6E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xB9,0x02,0x00,0x00,0xB8,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xBA,0x02,0x00,0x00,0x8C,0x02,0x00,0x00,0x8E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xBB,0x02,0x00,0x00,0xBA,0x02,0x00,0x00,0x85,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xBC,0x02,0x00,0x00,0xB9,0x02,0x00,0x00,0xBB,0x02,0x00,0x00,
-	0xBA,0x00,0x05,0x00,0x74,0x00,0x00,0x00,0xBD,0x02,0x00,0x00,0xB7,0x02,0x00,0x00,
-	0xBC,0x02,0x00,0x00,0x50,0x00,0x06,0x00,0xA4,0x02,0x00,0x00,0xBE,0x02,0x00,0x00,
-	0xAC,0x02,0x00,0x00,0xB2,0x02,0x00,0x00,0xBD,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xA6,0x02,0x00,0x00,0xBE,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0xA4,0x02,0x00,0x00,
-	0xBF,0x02,0x00,0x00,0xA6,0x02,0x00,0x00,0x9B,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0xC0,0x02,0x00,0x00,0xBF,0x02,0x00,0x00,0xA8,0x00,0x04,0x00,0x74,0x00,0x00,0x00,
-	0xC1,0x02,0x00,0x00,0xC0,0x02,0x00,0x00,0xF7,0x00,0x03,0x00,0xC3,0x02,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0xC1,0x02,0x00,0x00,0xC2,0x02,0x00,0x00,
-	0xC3,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,0xC2,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0xA4,0x02,0x00,0x00,0xC4,0x02,0x00,0x00,0xA6,0x02,0x00,0x00,0xA8,0x00,0x04,0x00,
-	0xA4,0x02,0x00,0x00,0xC5,0x02,0x00,0x00,0xC4,0x02,0x00,0x00,0x9B,0x00,0x04,0x00,
-	0x74,0x00,0x00,0x00,0xC6,0x02,0x00,0x00,0xC5,0x02,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0xC3,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,0xC3,0x02,0x00,0x00,0xF5,0x00,0x07,0x00,
-	0x74,0x00,0x00,0x00,0xC7,0x02,0x00,0x00,0xC0,0x02,0x00,0x00,0x7D,0x02,0x00,0x00,
-	0xC6,0x02,0x00,0x00,0xC2,0x02,0x00,0x00,0xF7,0x00,0x03,0x00,0xC9,0x02,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0xC7,0x02,0x00,0x00,0xC8,0x02,0x00,0x00,
-	0xC9,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,0xC8,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xCA,0x02,0x00,0x00,0x76,0x02,0x00,0x00,0x7F,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xCB,0x02,0x00,0x00,0xCA,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x76,0x02,0x00,0x00,0xCB,0x02,0x00,0x00,0xF9,0x00,0x02,0x00,0xC9,0x02,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0xC9,0x02,0x00,0x00,0xF9,0x00,0x02,0x00,0x7F,0x02,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x7F,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,
-	0xCC,0x02,0x00,0x00,0x77,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x78,0x02,0x00,0x00,
-	0xCC,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x58,0x00,0x00,0x00,0xCD,0x02,0x00,0x00,
-	0x77,0x02,0x00,0x00,0x80,0x00,0x05,0x00,0x58,0x00,0x00,0x00,0xCE,0x02,0x00,0x00,
-	0xCD,0x02,0x00,0x00,0x7A,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0x77,0x02,0x00,0x00,
-	0xCE,0x02,0x00,0x00,0xF9,0x00,0x02,0x00,0x7C,0x02,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x7E,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xCF,0x02,0x00,0x00,
-	0x76,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xD0,0x02,0x00,0x00,
-	0x6B,0x02,0x00,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0xD1,0x02,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xD0,0x02,0x00,0x00,0x85,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xD2,0x02,0x00,0x00,0xCF,0x02,0x00,0x00,0xD1,0x02,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0xD2,0x02,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-	0x10,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x11,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x1A,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x1A,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x11,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x66,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xD5,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xD6,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xDA,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xDB,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xDF,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xE6,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0xD7,0x02,0x00,0x00,0x61,0x00,0x00,0x00,0x4F,0x00,0x08,0x00,0x07,0x00,0x00,0x00,
-	0xD8,0x02,0x00,0x00,0xD7,0x02,0x00,0x00,0xD7,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xD6,0x02,0x00,0x00,
-	0xD8,0x02,0x00,0x00,0x39,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xD9,0x02,0x00,0x00,
-	0x0B,0x00,0x00,0x00,0xD6,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0xD5,0x02,0x00,0x00,
-	0xD9,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0xDC,0x02,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x4F,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0xDD,0x02,0x00,0x00,
-	0xDC,0x02,0x00,0x00,0xDC,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xDB,0x02,0x00,0x00,0xDD,0x02,0x00,0x00,
-	0x39,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xDE,0x02,0x00,0x00,0x0B,0x00,0x00,0x00,
-	0xDB,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,0xDA,0x02,0x00,0x00,0xDE,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xE0,0x02,0x00,0x00,0xD5,0x02,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xE1,0x02,0x00,0x00,0xDA,0x02,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,0xE2,0x02,0x00,0x00,0x64,0x00,0x00,0x00,
-	0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xE3,0x02,0x00,0x00,
-	0xE2,0x02,0x00,0x00,0x50,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0xE4,0x02,0x00,0x00,
-	0xE3,0x02,0x00,0x00,0xE3,0x02,0x00,0x00,0xE3,0x02,0x00,0x00,0x0C,0x00,0x08,0x00,
-	0x07,0x00,0x00,0x00,0xE5,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,
-	0xE0,0x02,0x00,0x00,0xE1,0x02,0x00,0x00,0xE4,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xE6,0x02,0x00,0x00,0xE5,0x02,0x00,0x00,0x39,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-	0xE7,0x02,0x00,0x00,0x0E,0x00,0x00,0x00,0xE6,0x02,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xDF,0x02,0x00,0x00,0xE7,0x02,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0xE8,0x02,0x00,0x00,0xDF,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x20,0x00,0x00,0x00,
-	0xE9,0x02,0x00,0x00,0x61,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xEA,0x02,0x00,0x00,0xE9,0x02,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xEB,0x02,0x00,0x00,0xE8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xEC,0x02,0x00,0x00,0xE8,0x02,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xED,0x02,0x00,0x00,
-	0xE8,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x10,0x00,0x00,0x00,
-	0xEE,0x02,0x00,0x00,0xEB,0x02,0x00,0x00,0xEC,0x02,0x00,0x00,0xED,0x02,0x00,0x00,
-	0xEA,0x02,0x00,0x00,0xFE,0x00,0x02,0x00,0xEE,0x02,0x00,0x00,0x38,0x00,0x01,0x00,
-};
-#endif
-static const char s_recolor_bytecode_draw_glsl300_src[11515] =
-"#version 300 es\n"
-"precision mediump float;\n"
-"precision highp int;\n"
-"\n"
-"layout(std140) uniform uniform_block\n"
-"{\n"
-"    highp vec2 u_texture_size;\n"
-"    int u_alpha_discard;\n"
-"} _836;\n"
-"\n"
-"uniform highp sampler2D u_image;\n"
-"\n"
-"in highp float v_stroke;\n"
-"in highp float v_aa;\n"
-"layout(location = 0) out highp vec4 result;\n"
-"in highp float v_fill;\n"
-"in highp float v_type;\n"
-"in highp vec2 v_uv;\n"
-"in highp vec4 v_col;\n"
-"in highp vec2 v_pos;\n"
-"in highp vec4 v_ab;\n"
-"in highp vec4 v_cd;\n"
-"in highp vec4 v_ef;\n"
-"in highp vec4 v_gh;\n"
-"flat in int v_n;\n"
-"in highp float v_radius;\n"
-"in highp float v_alpha;\n"
-"in highp vec2 v_posH;\n"
-"in highp vec4 v_user;\n"
-"highp vec2 pts[8];\n"
-"\n"
-"highp vec2 smooth_uv(highp vec2 uv, highp vec2 texture_size)\n"
-"{\n"
-"    highp vec2 pixel = uv * texture_size;\n"
-"    highp vec2 seam = floor(pixel + vec2(0.5));\n"
-"    pixel = seam + clamp((pixel - seam) / fwidth(pixel), vec2(-0.5), vec2(0.5));\n"
-"    return pixel / texture_size;\n"
-"}\n"
-"\n"
-"highp vec4 de_gamma(highp vec4 c)\n"
-"{\n"
-"    return vec4(pow(abs(c.xyz), vec3(2.2000000476837158203125)), c.w);\n"
-"}\n"
-"\n"
-"highp vec4 gamma(highp vec4 c)\n"
-"{\n"
-"    return vec4(pow(abs(c.xyz), vec3(0.4545454680919647216796875)), c.w);\n"
-"}\n"
-"\n"
-"highp vec2 skew(highp vec2 v)\n"
-"{\n"
-"    return vec2(-v.y, v.x);\n"
-"}\n"
-"\n"
-"highp float distance_aabb(highp vec2 p, highp vec2 he)\n"
-"{\n"
-"    highp vec2 d = abs(p) - he;\n"
-"    return length(max(d, vec2(0.0))) + min(max(d.x, d.y), 0.0);\n"
-"}\n"
-"\n"
-"highp float distance_box(inout highp vec2 p, highp vec2 c, highp vec2 he, highp vec2 u)\n"
-"{\n"
-"    highp vec2 param = u;\n"
-"    highp mat2 m = transpose(mat2(vec2(u), vec2(skew(param))));\n"
-"    p -= c;\n"
-"    p = m * p;\n"
-"    highp vec2 param_1 = p;\n"
-"    highp vec2 param_2 = he;\n"
-"    return distance_aabb(param_1, param_2);\n"
-"}\n"
-"\n"
-"highp float safe_div(highp float a, highp float b)\n"
-"{\n"
-"    highp float _304;\n"
-"    if (b == 0.0)\n"
-"    {\n"
-"        _304 = 0.0;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _304 = a / b;\n"
-"    }\n"
-"    return _304;\n"
-"}\n"
-"\n"
-"highp float safe_len(highp vec2 v)\n"
-"{\n"
-"    highp float d = dot(v, v);\n"
-"    highp float _320;\n"
-"    if (d == 0.0)\n"
-"    {\n"
-"        _320 = 0.0;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _320 = sqrt(d);\n"
-"    }\n"
-"    return _320;\n"
-"}\n"
-"\n"
-"highp float distance_segment(highp vec2 p, highp vec2 a, highp vec2 b)\n"
-"{\n"
-"    highp vec2 n = b - a;\n"
-"    highp vec2 pa = p - a;\n"
-"    highp float param = dot(pa, n);\n"
-"    highp float param_1 = dot(n, n);\n"
-"    highp float d = safe_div(param, param_1);\n"
-"    highp float h = clamp(d, 0.0, 1.0);\n"
-"    highp vec2 param_2 = pa - (n * h);\n"
-"    return safe_len(param_2);\n"
-"}\n"
-"\n"
-"highp float det2(highp vec2 a, highp vec2 b)\n"
-"{\n"
-"    return (a.x * b.y) - (a.y * b.x);\n"
-"}\n"
-"\n"
-"highp float distance_triangle(highp vec2 p, highp vec2 a, highp vec2 b, highp vec2 c)\n"
-"{\n"
-"    highp vec2 e0 = b - a;\n"
-"    highp vec2 e1 = c - b;\n"
-"    highp vec2 e2 = a - c;\n"
-"    highp vec2 v0 = p - a;\n"
-"    highp vec2 v1 = p - b;\n"
-"    highp vec2 v2 = p - c;\n"
-"    highp float param = dot(v0, e0);\n"
-"    highp float param_1 = dot(e0, e0);\n"
-"    highp vec2 pq0 = v0 - (e0 * clamp(safe_div(param, param_1), 0.0, 1.0));\n"
-"    highp float param_2 = dot(v1, e1);\n"
-"    highp float param_3 = dot(e1, e1);\n"
-"    highp vec2 pq1 = v1 - (e1 * clamp(safe_div(param_2, param_3), 0.0, 1.0));\n"
-"    highp float param_4 = dot(v2, e2);\n"
-"    highp float param_5 = dot(e2, e2);\n"
-"    highp vec2 pq2 = v2 - (e2 * clamp(safe_div(param_4, param_5), 0.0, 1.0));\n"
-"    highp vec2 param_6 = e0;\n"
-"    highp vec2 param_7 = e2;\n"
-"    highp float s = det2(param_6, param_7);\n"
-"    highp vec2 param_8 = v0;\n"
-"    highp vec2 param_9 = e0;\n"
-"    highp vec2 param_10 = v1;\n"
-"    highp vec2 param_11 = e1;\n"
-"    highp vec2 param_12 = v2;\n"
-"    highp vec2 param_13 = e2;\n"
-"    highp vec2 d = min(min(vec2(dot(pq0, pq0), s * det2(param_8, param_9)), vec2(dot(pq1, pq1), s * det2(param_10, param_11))), vec2(dot(pq2, pq2), s * det2(param_12, param_13)));\n"
-"    return (-sqrt(d.x)) * sign(d.y);\n"
-"}\n"
-"\n"
-"highp float distance_polygon(highp vec2 p, highp vec2 v[8], int N)\n"
-"{\n"
-"    highp float d = dot(p - v[0], p - v[0]);\n"
-"    highp float s = 1.0;\n"
-"    int _635 = N - 1;\n"
-"    for (int i = 0, j = _635; i < N; j = i, i++)\n"
-"    {\n"
-"        highp vec2 e = v[j] - v[i];\n"
-"        highp vec2 w = p - v[i];\n"
-"        highp vec2 b = w - (e * clamp(dot(w, e) / dot(e, e), 0.0, 1.0));\n"
-"        d = min(d, dot(b, b));\n"
-"        bvec3 cond = bvec3(p.y >= v[i].y, p.y < v[j].y, (e.x * w.y) > (e.y * w.x));\n"
-"        bool _704 = all(cond);\n"
-"        bool _711;\n"
-"        if (!_704)\n"
-"        {\n"
-"            _711 = all(not(cond));\n"
-"        }\n"
-"        else\n"
-"        {\n"
-"            _711 = _704;\n"
-"        }\n"
-"        if (_711)\n"
-"        {\n"
-"            s = -s;\n"
-"        }\n"
-"    }\n"
-"    return s * sqrt(d);\n"
-"}\n"
-"\n"
-"highp float sdf_stroke(highp float d)\n"
-"{\n"
-"    return abs(d) - v_stroke;\n"
-"}\n"
-"\n"
-"highp vec4 sdf(highp vec4 a, highp vec4 b, highp float d)\n"
-"{\n"
-"    highp float param = d;\n"
-"    highp float wire_d = sdf_stroke(param);\n"
-"    highp vec4 stroke_aa = mix(b, a, vec4(smoothstep(0.0, v_aa, wire_d)));\n"
-"    bvec4 _377 = bvec4(wire_d <= 0.0);\n"
-"    highp vec4 stroke_no_aa = vec4(_377.x ? b.x : a.x, _377.y ? b.y : a.y, _377.z ? b.z : a.z, _377.w ? b.w : a.w);\n"
-"    highp vec4 fill_aa = mix(b, a, vec4(smoothstep(0.0, v_aa, d)));\n"
-"    bvec4 _393 = bvec4(clamp(d, -1.0, 1.0) <= 0.0);\n"
-"    highp vec4 fill_no_aa = vec4(_393.x ? b.x : a.x, _393.y ? b.y : a.y, _393.z ? b.z : a.z, _393.w ? b.w : a.w);\n"
-"    highp vec4 stroke = mix(stroke_aa, stroke_aa, vec4(float(v_aa > 0.0)));\n"
-"    highp vec4 fill = mix(fill_no_aa, fill_aa, vec4(float(v_aa > 0.0)));\n"
-"    result = mix(stroke, fill, vec4(v_fill));\n"
-"    return result;\n"
-"}\n"
-"\n"
-"highp vec3 rgb_to_hsv(highp vec3 c)\n"
-"{\n"
-"    highp vec4 K = vec4(0.0, -0.3333333432674407958984375, 0.666666686534881591796875, -1.0);\n"
-"    highp vec4 _118;\n"
-"    if (c.y < c.z)\n"
-"    {\n"
-"        _118 = vec4(c.zy, K.wz);\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _118 = vec4(c.yz, K.xy);\n"
-"    }\n"
-"    highp vec4 p = _118;\n"
-"    highp vec4 _148;\n"
-"    if (c.x < p.x)\n"
-"    {\n"
-"        _148 = vec4(p.xyw, c.x);\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _148 = vec4(c.x, p.yzx);\n"
-"    }\n"
-"    highp vec4 q = _148;\n"
-"    highp float d = q.x - min(q.w, q.y);\n"
-"    highp float e = 1.0000000133514319600180897396058e-10;\n"
-"    return vec3(abs(q.z + ((q.w - q.y) / ((6.0 * d) + e))), d / (q.x + e), q.x);\n"
-"}\n"
-"\n"
-"highp vec3 hsv_to_rgb(highp vec3 c)\n"
-"{\n"
-"    highp vec3 rgb = clamp(abs(mod(vec3(c.x * 6.0) + vec3(0.0, 4.0, 2.0), vec3(6.0)) - vec3(3.0)) - vec3(1.0), vec3(0.0), vec3(1.0));\n"
-"    rgb = (rgb * rgb) * (vec3(3.0) - (rgb * 2.0));\n"
-"    return mix(vec3(1.0), rgb, vec3(c.y)) * c.z;\n"
-"}\n"
-"\n"
-"highp vec4 shader(highp vec4 color, highp vec2 pos, highp vec2 screen_uv, highp vec4 params)\n"
-"{\n"
-"    highp vec3 param = color.xyz;\n"
-"    highp vec3 a = rgb_to_hsv(param);\n"
-"    highp vec3 param_1 = params.xyz;\n"
-"    highp vec3 b = rgb_to_hsv(param_1);\n"
-"    highp vec3 param_2 = mix(a, b, vec3(params.w));\n"
-"    highp vec3 c = hsv_to_rgb(param_2);\n"
-"    return vec4(c, color.w);\n"
-"}\n"
-"\n"
-"void main()\n"
-"{\n"
-"    bool _757 = v_type >= 0.0;\n"
-"    bool _763;\n"
-"    if (_757)\n"
-"    {\n"
-"        _763 = v_type < 0.00196078442968428134918212890625;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _763 = _757;\n"
-"    }\n"
-"    bool is_sprite = _763;\n"
-"    bool _766 = v_type > 0.00196078442968428134918212890625;\n"
-"    bool _772;\n"
-"    if (_766)\n"
-"    {\n"
-"        _772 = v_type < 0.0058823530562222003936767578125;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _772 = _766;\n"
-"    }\n"
-"    bool is_text = _772;\n"
-"    bool _775 = v_type > 0.0058823530562222003936767578125;\n"
-"    bool _781;\n"
-"    if (_775)\n"
-"    {\n"
-"        _781 = v_type < 0.009803921915590763092041015625;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _781 = _775;\n"
-"    }\n"
-"    bool is_box = _781;\n"
-"    bool _784 = v_type > 0.009803921915590763092041015625;\n"
-"    bool _790;\n"
-"    if (_784)\n"
-"    {\n"
-"        _790 = v_type < 0.013725490309298038482666015625;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _790 = _784;\n"
-"    }\n"
-"    bool is_seg = _790;\n"
-"    bool _793 = v_type > 0.013725490309298038482666015625;\n"
-"    bool _799;\n"
-"    if (_793)\n"
-"    {\n"
-"        _799 = v_type < 0.01764705963432788848876953125;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _799 = _793;\n"
-"    }\n"
-"    bool is_tri = _799;\n"
-"    bool _802 = v_type > 0.01764705963432788848876953125;\n"
-"    bool _808;\n"
-"    if (_802)\n"
-"    {\n"
-"        _808 = v_type < 0.02156862802803516387939453125;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _808 = _802;\n"
-"    }\n"
-"    bool is_tri_sdf = _808;\n"
-"    bool _811 = v_type > 0.02156862802803516387939453125;\n"
-"    bool _817;\n"
-"    if (_811)\n"
-"    {\n"
-"        _817 = v_type < 0.02549019642174243927001953125;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _817 = _811;\n"
-"    }\n"
-"    bool is_poly = _817;\n"
-"    highp vec4 c = vec4(0.0);\n"
-"    highp vec4 _824;\n"
-"    if (!(is_sprite && is_text))\n"
-"    {\n"
-"        highp vec2 param = v_uv;\n"
-"        highp vec2 param_1 = _836.u_texture_size;\n"
-"        highp vec4 param_2 = texture(u_image, smooth_uv(param, param_1));\n"
-"        _824 = de_gamma(param_2);\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _824 = c;\n"
-"    }\n"
-"    c = _824;\n"
-"    highp vec4 _851;\n"
-"    if (is_sprite)\n"
-"    {\n"
-"        highp vec4 param_3 = c;\n"
-"        _851 = gamma(param_3);\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _851 = c;\n"
-"    }\n"
-"    c = _851;\n"
-"    highp vec4 _861;\n"
-"    if (is_text)\n"
-"    {\n"
-"        _861 = v_col * c.w;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _861 = c;\n"
-"    }\n"
-"    c = _861;\n"
-"    bvec4 _876 = bvec4(is_tri);\n"
-"    c = vec4(_876.x ? v_col.x : c.x, _876.y ? v_col.y : c.y, _876.z ? v_col.z : c.z, _876.w ? v_col.w : c.w);\n"
-"    highp float d = 0.0;\n"
-"    if (is_box)\n"
-"    {\n"
-"        highp vec2 param_4 = v_pos;\n"
-"        highp vec2 param_5 = v_ab.xy;\n"
-"        highp vec2 param_6 = v_ab.zw;\n"
-"        highp vec2 param_7 = v_cd.xy;\n"
-"        highp float _896 = distance_box(param_4, param_5, param_6, param_7);\n"
-"        d = _896;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        if (is_seg)\n"
-"        {\n"
-"            highp vec2 param_8 = v_pos;\n"
-"            highp vec2 param_9 = v_ab.xy;\n"
-"            highp vec2 param_10 = v_ab.zw;\n"
-"            d = distance_segment(param_8, param_9, param_10);\n"
-"            highp vec2 param_11 = v_pos;\n"
-"            highp vec2 param_12 = v_ab.zw;\n"
-"            highp vec2 param_13 = v_cd.xy;\n"
-"            d = min(d, distance_segment(param_11, param_12, param_13));\n"
-"        }\n"
-"        else\n"
-"        {\n"
-"            if (is_tri_sdf)\n"
-"            {\n"
-"                highp vec2 param_14 = v_pos;\n"
-"                highp vec2 param_15 = v_ab.xy;\n"
-"                highp vec2 param_16 = v_ab.zw;\n"
-"                highp vec2 param_17 = v_cd.xy;\n"
-"                d = distance_triangle(param_14, param_15, param_16, param_17);\n"
-"            }\n"
-"            else\n"
-"            {\n"
-"                if (is_poly)\n"
-"                {\n"
-"                    pts[0] = v_ab.xy;\n"
-"                    pts[1] = v_ab.zw;\n"
-"                    pts[2] = v_cd.xy;\n"
-"                    pts[3] = v_cd.zw;\n"
-"                    pts[4] = v_ef.xy;\n"
-"                    pts[5] = v_ef.zw;\n"
-"                    pts[6] = v_gh.xy;\n"
-"                    pts[7] = v_gh.zw;\n"
-"                    highp vec2 param_18 = v_pos;\n"
-"                    highp vec2 param_19[8] = pts;\n"
-"                    int param_20 = v_n;\n"
-"                    d = distance_polygon(param_18, param_19, param_20);\n"
-"                }\n"
-"            }\n"
-"        }\n"
-"    }\n"
-"    highp vec4 _993;\n"
-"    if (((!is_sprite) && (!is_text)) && (!is_tri))\n"
-"    {\n"
-"        highp vec4 param_21 = c;\n"
-"        highp vec4 param_22 = v_col;\n"
-"        highp float param_23 = d - v_radius;\n"
-"        highp vec4 _1005 = sdf(param_21, param_22, param_23);\n"
-"        _993 = _1005;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _993 = c;\n"
-"    }\n"
-"    c = _993;\n"
-"    c *= v_alpha;\n"
-"    highp vec2 screen_uv = ((v_posH + vec2(1.0, -1.0)) * 0.5) * vec2(1.0, -1.0);\n"
-"    highp vec4 param_24 = c;\n"
-"    highp vec2 param_25 = v_pos;\n"
-"    highp vec2 param_26 = screen_uv;\n"
-"    highp vec4 param_27 = v_user;\n"
-"    c = shader(param_24, param_25, param_26, param_27);\n"
-"    bool _1033 = _836.u_alpha_discard != 0;\n"
-"    bool _1039;\n"
-"    if (_1033)\n"
-"    {\n"
-"        _1039 = c.w == 0.0;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _1039 = _1033;\n"
-"    }\n"
-"    if (_1039)\n"
-"    {\n"
-"        discard;\n"
-"    }\n"
-"    result = c;\n"
-"}\n"
-"\n"
-"";
-static const char* s_recolor_bytecode_draw_image_names[1] = {
-    "u_image",
-};
-static CF_ShaderUniformInfo s_recolor_bytecode_draw_uniforms[1] = {
-	{
-		.block_name = "uniform_block",
-		.block_index = 0,
-		.block_size = 16,
-		.num_members = 2,
-	},
-};
-static CF_ShaderUniformMemberInfo s_recolor_bytecode_draw_uniform_members[2] = {
-	{
-		.name = "u_texture_size",
-		.type = CF_SHADER_INFO_TYPE_FLOAT2,
-		.offset = 0,
-		.array_length = 1,
-	},
-	{
-		.name = "u_alpha_discard",
-		.type = CF_SHADER_INFO_TYPE_SINT,
-		.offset = 8,
-		.array_length = 1,
-	},
-};
-#define s_recolor_bytecode_draw_inputs NULL
-/*
-#extension GL_ARB_shading_language_include : require
-
-#line 1 0
-
-layout(location = 0) in vec2 v_uv;
-layout(location = 1) in vec2 v_pos;
-layout(location = 2) in vec2 v_posH;
-layout(location = 3) in vec4 v_params;
-
-layout(location = 0) out vec4 result;
-
-layout(set = 2, binding = 0) uniform sampler2D u_image;
-
-layout(set = 3, binding = 0) uniform uniform_block {
- vec2 u_texture_size;
- int u_alpha_discard;
-};
-
-#line 1 "smooth_uv.shd"
-
-vec2 smooth_uv(vec2 uv, vec2 texture_size)
-{
- vec2 pixel = uv * texture_size;
- vec2 seam = floor(pixel + 0.5);
- pixel = seam + clamp( (pixel - seam) / fwidth(pixel), - 0.5, 0.5);
- return pixel / texture_size;
-}
-#line 17 0
-#line 1 "shader_stub.shd"
-#line 1 "blend.shd"
-
-
-
-
-vec3 rgb_to_hsv(vec3 c)
-{
- vec4 K = vec4(0.0, - 1.0 / 3.0, 2.0 / 3.0, - 1.0);
- vec4 p = c.g < c.b ? vec4(c.bg, K.wz) : vec4(c.gb, K.xy);
- vec4 q = c.r < p.x ? vec4(p.xyw, c.r) : vec4(c.r, p.yzx);
- float d = q.x - min(q.w, q.y);
- float e = 1.0e-10;
- return vec3(abs(q.z + (q.w - q.y) / (6.0 * d + e)), d / (q.x + e), q.x);
-}
-
-vec3 hsv_to_rgb(vec3 c)
-{
- vec3 rgb = clamp(abs(mod(c.x * 6.0 + vec3(0.0, 4.0, 2.0), 6.0) - 3.0) - 1.0, 0.0, 1.0);
- rgb = rgb * rgb * (3.0 - 2.0 * rgb);
- return c.z * mix(vec3(1.0), rgb, c.y);
-}
-
-vec3 hue(vec3 base, vec3 tint)
-{
- base = rgb_to_hsv(base);
- tint = rgb_to_hsv(tint);
- return hsv_to_rgb(vec3(tint.r, base.gb));
-}
-
-vec4 hue(vec4 base, vec4 tint)
-{
- return vec4(hue(base.rgb, tint.rgb), base.a);
-}
-
-float overlay(float base, float blend)
-{
- return(base <= 0.5) ? 2 * base * blend : 1 - 2 * (1 - base) * (1 - blend);
-}
-
-vec3 overlay(vec3 base, vec3 blend)
-{
- return vec3(overlay(base.r, blend.r), overlay(base.g, blend.g), overlay(base.b, blend.b));
-}
-
-vec4 overlay(vec4 base, vec4 blend)
-{
- return vec4(overlay(base.rgb, blend.rgb), base.a);
-}
-
-float softlight(float base, float blend)
-{
- if (blend <= 0.5) return base - (1 - 2 * blend) * base * (1 - base);
- else return base + (2.0 * blend - 1) * ( ( (base <= 0.25) ? ( (16.0 * base - 12.0) * base + 4.0) * base : sqrt(base)) - base);
-}
-
-vec3 softlight(vec3 base, vec3 blend)
-{
- return vec3(softlight(base.r, blend.r), softlight(base.g, blend.g), softlight(base.b, blend.b));
-}
-
-vec4 softlight(vec4 base, vec4 blend)
-{
- return vec4(softlight(base.rgb, blend.rgb), base.a);
-}
-#line 2 "shader_stub.shd"
-
-vec4 shader(vec4 color, vec2 pos, vec2 screen_uv, vec4 params)
-{
-    vec3 a = rgb_to_hsv(color.rgb);
-    vec3 b = rgb_to_hsv(params.rgb);
-    vec3 c = hsv_to_rgb(mix(a, b, params.a));
-
-    return vec4(c, color.a);
-}
-#line 18 0
-
-void main() {
- vec4 color = texture(u_image, smooth_uv(v_uv, u_texture_size));
- vec2 screen_uv = (v_posH + vec2(1, - 1)) * 0.5 * vec2(1, - 1);
- vec4 c = shader(color, v_pos, screen_uv, v_params);
- if (u_alpha_discard != 0 && c.a == 0) discard;
- result = c;
-}
-
-*/
-#ifndef __EMSCRIPTEN__
-static const uint8_t s_recolor_bytecode_blit_content[6828] = {
-	0x03,0x02,0x23,0x07,0x00,0x03,0x01,0x00,0x0B,0x00,0x08,0x00,0x23,0x01,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0B,0x00,0x06,0x00,
-	0x01,0x00,0x00,0x00,0x47,0x4C,0x53,0x4C,0x2E,0x73,0x74,0x64,0x2E,0x34,0x35,0x30,
-	0x00,0x00,0x00,0x00,0x0E,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x0F,0x00,0x0A,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6D,0x61,0x69,0x6E,
-	0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x06,0x01,0x00,0x00,
-	0x08,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x10,0x00,0x03,0x00,0x04,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xC2,0x01,0x00,0x00,
-	0x04,0x00,0x09,0x00,0x47,0x4C,0x5F,0x41,0x52,0x42,0x5F,0x73,0x68,0x61,0x64,0x69,
-	0x6E,0x67,0x5F,0x6C,0x61,0x6E,0x67,0x75,0x61,0x67,0x65,0x5F,0x69,0x6E,0x63,0x6C,
-	0x75,0x64,0x65,0x00,0x04,0x00,0x0A,0x00,0x47,0x4C,0x5F,0x47,0x4F,0x4F,0x47,0x4C,
-	0x45,0x5F,0x63,0x70,0x70,0x5F,0x73,0x74,0x79,0x6C,0x65,0x5F,0x6C,0x69,0x6E,0x65,
-	0x5F,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x04,0x00,0x00,0x00,0x6D,0x61,0x69,0x6E,0x00,0x00,0x00,0x00,0x05,0x00,0x07,0x00,
-	0x0C,0x00,0x00,0x00,0x73,0x6D,0x6F,0x6F,0x74,0x68,0x5F,0x75,0x76,0x28,0x76,0x66,
-	0x32,0x3B,0x76,0x66,0x32,0x3B,0x00,0x00,0x05,0x00,0x03,0x00,0x0A,0x00,0x00,0x00,
-	0x75,0x76,0x00,0x00,0x05,0x00,0x06,0x00,0x0B,0x00,0x00,0x00,0x74,0x65,0x78,0x74,
-	0x75,0x72,0x65,0x5F,0x73,0x69,0x7A,0x65,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-	0x12,0x00,0x00,0x00,0x72,0x67,0x62,0x5F,0x74,0x6F,0x5F,0x68,0x73,0x76,0x28,0x76,
-	0x66,0x33,0x3B,0x00,0x05,0x00,0x03,0x00,0x11,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
-	0x05,0x00,0x06,0x00,0x15,0x00,0x00,0x00,0x68,0x73,0x76,0x5F,0x74,0x6F,0x5F,0x72,
-	0x67,0x62,0x28,0x76,0x66,0x33,0x3B,0x00,0x05,0x00,0x03,0x00,0x14,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x05,0x00,0x08,0x00,0x1E,0x00,0x00,0x00,0x73,0x68,0x61,0x64,
-	0x65,0x72,0x28,0x76,0x66,0x34,0x3B,0x76,0x66,0x32,0x3B,0x76,0x66,0x32,0x3B,0x76,
-	0x66,0x34,0x3B,0x00,0x05,0x00,0x04,0x00,0x1A,0x00,0x00,0x00,0x63,0x6F,0x6C,0x6F,
-	0x72,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x1B,0x00,0x00,0x00,0x70,0x6F,0x73,0x00,
-	0x05,0x00,0x05,0x00,0x1C,0x00,0x00,0x00,0x73,0x63,0x72,0x65,0x65,0x6E,0x5F,0x75,
-	0x76,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x1D,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x73,0x00,0x00,0x05,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0x70,0x69,0x78,0x65,
-	0x6C,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x24,0x00,0x00,0x00,0x73,0x65,0x61,0x6D,
-	0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x3B,0x00,0x00,0x00,0x4B,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x41,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-	0x63,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x7F,0x00,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x89,0x00,0x00,0x00,0x65,0x00,0x00,0x00,
-	0x05,0x00,0x03,0x00,0xA5,0x00,0x00,0x00,0x72,0x67,0x62,0x00,0x05,0x00,0x03,0x00,
-	0xCD,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xCE,0x00,0x00,0x00,
-	0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xD2,0x00,0x00,0x00,
-	0x62,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xD3,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
-	0x6D,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0xD7,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xDE,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xE9,0x00,0x00,0x00,0x63,0x6F,0x6C,0x6F,0x72,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xED,0x00,0x00,0x00,0x75,0x5F,0x69,0x6D,0x61,0x67,0x65,0x00,
-	0x05,0x00,0x04,0x00,0xF0,0x00,0x00,0x00,0x76,0x5F,0x75,0x76,0x00,0x00,0x00,0x00,
-	0x05,0x00,0x06,0x00,0xF2,0x00,0x00,0x00,0x75,0x6E,0x69,0x66,0x6F,0x72,0x6D,0x5F,
-	0x62,0x6C,0x6F,0x63,0x6B,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0xF2,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x75,0x5F,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5F,0x73,0x69,
-	0x7A,0x65,0x00,0x00,0x06,0x00,0x07,0x00,0xF2,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x75,0x5F,0x61,0x6C,0x70,0x68,0x61,0x5F,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x00,
-	0x05,0x00,0x03,0x00,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0xF6,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0xF8,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-	0xFE,0x00,0x00,0x00,0x73,0x63,0x72,0x65,0x65,0x6E,0x5F,0x75,0x76,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0xFF,0x00,0x00,0x00,0x76,0x5F,0x70,0x6F,0x73,0x48,0x00,0x00,
-	0x05,0x00,0x03,0x00,0x05,0x01,0x00,0x00,0x63,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-	0x06,0x01,0x00,0x00,0x76,0x5F,0x70,0x6F,0x73,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-	0x08,0x01,0x00,0x00,0x76,0x5F,0x70,0x61,0x72,0x61,0x6D,0x73,0x00,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x09,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x0B,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x0D,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x0F,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6D,0x00,0x00,0x00,
-	0x05,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x72,0x65,0x73,0x75,0x6C,0x74,0x00,0x00,
-	0x47,0x00,0x04,0x00,0xED,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x47,0x00,0x04,0x00,0xED,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x47,0x00,0x04,0x00,0xF0,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x47,0x00,0x03,0x00,0xF2,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
-	0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x48,0x00,0x05,0x00,0xF2,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
-	0x08,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xF4,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xF4,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
-	0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xFF,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x06,0x01,0x00,0x00,0x1E,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x08,0x01,0x00,0x00,0x1E,0x00,0x00,0x00,
-	0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x1E,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x21,0x00,0x03,0x00,
-	0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-	0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
-	0x0E,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x21,0x00,0x07,0x00,0x19,0x00,0x00,0x00,
-	0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
-	0x18,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x3F,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xBF,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3D,0x00,0x00,0x00,
-	0xAB,0xAA,0xAA,0xBE,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,
-	0xAB,0xAA,0x2A,0x3F,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-	0x00,0x00,0x80,0xBF,0x2C,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
-	0x3C,0x00,0x00,0x00,0x3D,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-	0x15,0x00,0x04,0x00,0x42,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x42,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x20,0x00,0x04,0x00,0x44,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x42,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x14,0x00,0x02,0x00,0x4A,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x42,0x00,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x42,0x00,0x00,0x00,
-	0x82,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x8A,0x00,0x00,0x00,0xFF,0xE6,0xDB,0x2E,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x92,0x00,0x00,0x00,0x00,0x00,0xC0,0x40,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xA9,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x2C,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,
-	0xAB,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xA9,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,
-	0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0x00,0x00,0x40,0x40,
-	0x2B,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,
-	0x2C,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0xC4,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,
-	0xB4,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0xEA,0x00,0x00,0x00,
-	0x06,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x03,0x00,
-	0xEB,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xEC,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEB,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xEC,0x00,0x00,0x00,
-	0xED,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xEF,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xEF,0x00,0x00,0x00,
-	0xF0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0xF1,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1E,0x00,0x04,0x00,0xF2,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0xF1,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xF3,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0xF2,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xF3,0x00,0x00,0x00,
-	0xF4,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,0xF1,0x00,0x00,0x00,
-	0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xF9,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0xEF,0x00,0x00,0x00,
-	0xFF,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2C,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-	0x01,0x01,0x00,0x00,0xB4,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0xEF,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-	0x07,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x07,0x01,0x00,0x00,0x08,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x04,0x00,
-	0xF1,0x00,0x00,0x00,0x12,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-	0x13,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0xF1,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-	0x20,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x20,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x36,0x00,0x05,0x00,
-	0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
-	0xE9,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xF6,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xF8,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0xFE,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
-	0x05,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
-	0x09,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0x0B,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0x0D,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
-	0x0F,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0xEB,0x00,0x00,0x00,
-	0xEE,0x00,0x00,0x00,0xED,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0xF7,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xF6,0x00,0x00,0x00,
-	0xF7,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0xF9,0x00,0x00,0x00,0xFA,0x00,0x00,0x00,
-	0xF4,0x00,0x00,0x00,0xF5,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0xFB,0x00,0x00,0x00,0xFA,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xF8,0x00,0x00,0x00,
-	0xFB,0x00,0x00,0x00,0x39,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,
-	0x0C,0x00,0x00,0x00,0xF6,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x57,0x00,0x05,0x00,
-	0x17,0x00,0x00,0x00,0xFD,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xE9,0x00,0x00,0x00,0xFD,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x07,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0xFF,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-	0x07,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x00,
-	0x8E,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x03,0x01,0x00,0x00,0x02,0x01,0x00,0x00,
-	0x26,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x04,0x01,0x00,0x00,
-	0x03,0x01,0x00,0x00,0x01,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0xFE,0x00,0x00,0x00,
-	0x04,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x0A,0x01,0x00,0x00,
-	0xE9,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x09,0x01,0x00,0x00,0x0A,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x0C,0x01,0x00,0x00,0x06,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x0B,0x01,0x00,0x00,0x0C,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x07,0x00,0x00,0x00,0x0E,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x0D,0x01,0x00,0x00,0x0E,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-	0x10,0x01,0x00,0x00,0x08,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x0F,0x01,0x00,0x00,
-	0x10,0x01,0x00,0x00,0x39,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x11,0x01,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x0B,0x01,0x00,0x00,0x0D,0x01,0x00,0x00,
-	0x0F,0x01,0x00,0x00,0x3E,0x00,0x03,0x00,0x05,0x01,0x00,0x00,0x11,0x01,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x13,0x01,0x00,0x00,0x14,0x01,0x00,0x00,0xF4,0x00,0x00,0x00,
-	0x12,0x01,0x00,0x00,0x3D,0x00,0x04,0x00,0xF1,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
-	0x14,0x01,0x00,0x00,0xAB,0x00,0x05,0x00,0x4A,0x00,0x00,0x00,0x16,0x01,0x00,0x00,
-	0x15,0x01,0x00,0x00,0xF5,0x00,0x00,0x00,0xF7,0x00,0x03,0x00,0x18,0x01,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,0x16,0x01,0x00,0x00,0x17,0x01,0x00,0x00,
-	0x18,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,0x17,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0x19,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x82,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x1A,0x01,0x00,0x00,0x19,0x01,0x00,0x00,
-	0xB4,0x00,0x05,0x00,0x4A,0x00,0x00,0x00,0x1B,0x01,0x00,0x00,0x1A,0x01,0x00,0x00,
-	0x3C,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x18,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x18,0x01,0x00,0x00,0xF5,0x00,0x07,0x00,0x4A,0x00,0x00,0x00,0x1C,0x01,0x00,0x00,
-	0x16,0x01,0x00,0x00,0x05,0x00,0x00,0x00,0x1B,0x01,0x00,0x00,0x17,0x01,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x1E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x1C,0x01,0x00,0x00,0x1D,0x01,0x00,0x00,0x1E,0x01,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x1D,0x01,0x00,0x00,0xFC,0x00,0x01,0x00,0xF8,0x00,0x02,0x00,0x1E,0x01,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x05,0x01,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x21,0x01,0x00,0x00,0x22,0x01,0x00,0x00,0xFD,0x00,0x01,0x00,
-	0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x08,0x00,0x00,0x00,
-	0x0A,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x0D,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
-	0x24,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0x22,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-	0x23,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x20,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0x25,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x50,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-	0x27,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-	0x07,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
-	0x0C,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x08,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x24,0x00,0x00,0x00,
-	0x29,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x2A,0x00,0x00,0x00,
-	0x24,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,
-	0x24,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x2D,0x00,0x00,0x00,
-	0x2B,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0x2E,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xD1,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-	0x2F,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-	0x30,0x00,0x00,0x00,0x2D,0x00,0x00,0x00,0x2F,0x00,0x00,0x00,0x50,0x00,0x05,0x00,
-	0x07,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
-	0x50,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
-	0x26,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x32,0x00,0x00,0x00,
-	0x33,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
-	0x2A,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x20,0x00,0x00,0x00,
-	0x35,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x37,0x00,0x00,0x00,
-	0x0B,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x38,0x00,0x00,0x00,
-	0x36,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0xFE,0x00,0x02,0x00,0x38,0x00,0x00,0x00,
-	0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x0F,0x00,0x00,0x00,
-	0x11,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x13,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x18,0x00,0x00,0x00,0x3B,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x18,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x18,0x00,0x00,0x00,0x4C,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x18,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x18,0x00,0x00,0x00,0x6A,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x44,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,
-	0x44,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x3B,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0x45,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x47,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
-	0xB8,0x00,0x05,0x00,0x4A,0x00,0x00,0x00,0x4B,0x00,0x00,0x00,0x46,0x00,0x00,0x00,
-	0x49,0x00,0x00,0x00,0xF7,0x00,0x03,0x00,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFA,0x00,0x04,0x00,0x4B,0x00,0x00,0x00,0x4D,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x4D,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,
-	0x4F,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x4F,0x00,0x07,0x00,0x07,0x00,0x00,0x00,
-	0x50,0x00,0x00,0x00,0x4F,0x00,0x00,0x00,0x4F,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
-	0x3B,0x00,0x00,0x00,0x4F,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
-	0x51,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x54,0x00,0x00,0x00,
-	0x50,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x55,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x50,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x53,0x00,0x00,0x00,
-	0x54,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x4C,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x4E,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x58,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,
-	0x59,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x4F,0x00,0x07,0x00,0x07,0x00,0x00,0x00,
-	0x5A,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x5B,0x00,0x00,0x00,
-	0x3B,0x00,0x00,0x00,0x4F,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x5C,0x00,0x00,0x00,
-	0x5B,0x00,0x00,0x00,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5D,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,
-	0x5A,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x5F,0x00,0x00,0x00,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x5C,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x50,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x5D,0x00,0x00,0x00,
-	0x5E,0x00,0x00,0x00,0x5F,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x4C,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x4E,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x4E,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-	0x62,0x00,0x00,0x00,0x4C,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x41,0x00,0x00,0x00,
-	0x62,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,0x65,0x00,0x00,0x00,
-	0x11,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x66,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0x67,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x67,0x00,0x00,0x00,0xB8,0x00,0x05,0x00,
-	0x4A,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x68,0x00,0x00,0x00,
-	0xF7,0x00,0x03,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x04,0x00,
-	0x69,0x00,0x00,0x00,0x6B,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x6B,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x6D,0x00,0x00,0x00,
-	0x41,0x00,0x00,0x00,0x4F,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,
-	0x6D,0x00,0x00,0x00,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x03,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,
-	0x11,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x70,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x71,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x6E,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x74,0x00,0x00,0x00,
-	0x71,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0x6A,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,
-	0x6C,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x75,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x76,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x41,0x00,0x00,0x00,
-	0x4F,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
-	0x78,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,0x79,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7B,0x00,0x00,0x00,
-	0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x7C,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-	0x17,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,
-	0x7B,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x6A,0x00,0x00,0x00,
-	0x7D,0x00,0x00,0x00,0xF9,0x00,0x02,0x00,0x6C,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x6C,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,
-	0x6A,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x63,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,
-	0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
-	0x64,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x81,0x00,0x00,0x00,
-	0x80,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,0x83,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x84,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0x85,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x0C,0x00,0x07,0x00,
-	0x06,0x00,0x00,0x00,0x87,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
-	0x84,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x88,0x00,0x00,0x00,0x81,0x00,0x00,0x00,0x87,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0x7F,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0x89,0x00,0x00,0x00,
-	0x8A,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,0x8B,0x00,0x00,0x00,
-	0x63,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x8C,0x00,0x00,0x00,0x8B,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0x8D,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0x8F,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x8F,0x00,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,
-	0x90,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x93,0x00,0x00,0x00,
-	0x7F,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x94,0x00,0x00,0x00,
-	0x92,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0x95,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0x96,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x95,0x00,0x00,0x00,0x88,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0x97,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x96,0x00,0x00,0x00,
-	0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,
-	0x97,0x00,0x00,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x99,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0x9A,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0x9B,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9C,0x00,0x00,0x00,0x9B,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9D,0x00,0x00,0x00,0x89,0x00,0x00,0x00,
-	0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9C,0x00,0x00,0x00,
-	0x9D,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9F,0x00,0x00,0x00,
-	0x9A,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0xA0,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xA1,0x00,0x00,0x00,0xA0,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x0E,0x00,0x00,0x00,0xA2,0x00,0x00,0x00,0x99,0x00,0x00,0x00,0x9F,0x00,0x00,0x00,
-	0xA1,0x00,0x00,0x00,0xFE,0x00,0x02,0x00,0xA2,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
-	0x36,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x10,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x0F,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
-	0xF8,0x00,0x02,0x00,0x16,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,
-	0xA5,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0xA6,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xA7,0x00,0x00,0x00,0xA6,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xA8,0x00,0x00,0x00,0xA7,0x00,0x00,0x00,0x92,0x00,0x00,0x00,
-	0x50,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,0xA8,0x00,0x00,0x00,
-	0xA8,0x00,0x00,0x00,0xA8,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,
-	0xAD,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,0xAB,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x0E,0x00,0x00,0x00,0xAE,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x92,0x00,0x00,0x00,
-	0x92,0x00,0x00,0x00,0x8D,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xAF,0x00,0x00,0x00,
-	0xAD,0x00,0x00,0x00,0xAE,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,
-	0xB1,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,
-	0x83,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xB2,0x00,0x00,0x00,0xAF,0x00,0x00,0x00,
-	0xB1,0x00,0x00,0x00,0x0C,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0xB3,0x00,0x00,0x00,
-	0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xB2,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x0E,0x00,0x00,0x00,0xB5,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,
-	0xB4,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xB6,0x00,0x00,0x00,
-	0xB3,0x00,0x00,0x00,0xB5,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,
-	0xB7,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,
-	0x50,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0xB8,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,
-	0xB4,0x00,0x00,0x00,0xB4,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,
-	0xB9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2B,0x00,0x00,0x00,0xB6,0x00,0x00,0x00,
-	0xB7,0x00,0x00,0x00,0xB8,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xA5,0x00,0x00,0x00,
-	0xB9,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,0xBA,0x00,0x00,0x00,
-	0xA5,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,0xBB,0x00,0x00,0x00,
-	0xA5,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,
-	0xBA,0x00,0x00,0x00,0xBB,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,
-	0xBD,0x00,0x00,0x00,0xA5,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,
-	0xBE,0x00,0x00,0x00,0xBD,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
-	0x0E,0x00,0x00,0x00,0xBF,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,0xB0,0x00,0x00,0x00,
-	0xB0,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,
-	0xBF,0x00,0x00,0x00,0xBE,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,
-	0xC1,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,
-	0xA5,0x00,0x00,0x00,0xC1,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,
-	0xC2,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x06,0x00,0x00,0x00,0xC3,0x00,0x00,0x00,0xC2,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x0E,0x00,0x00,0x00,0xC5,0x00,0x00,0x00,0xA5,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0xC6,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xC7,0x00,0x00,0x00,0xC6,0x00,0x00,0x00,
-	0x50,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0xC7,0x00,0x00,0x00,
-	0xC7,0x00,0x00,0x00,0xC7,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,
-	0xC9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0xC4,0x00,0x00,0x00,
-	0xC5,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0x8E,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,
-	0xCA,0x00,0x00,0x00,0xC9,0x00,0x00,0x00,0xC3,0x00,0x00,0x00,0xFE,0x00,0x02,0x00,
-	0xCA,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-	0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-	0x18,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x08,0x00,0x00,0x00,
-	0x1B,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,
-	0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x1D,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,
-	0x1F,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,0xCD,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,0xCE,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,0xD2,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,0xD3,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,0xD7,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3B,0x00,0x04,0x00,0x0F,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
-	0x07,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xCF,0x00,0x00,0x00,
-	0x1A,0x00,0x00,0x00,0x4F,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,0xD0,0x00,0x00,0x00,
-	0xCF,0x00,0x00,0x00,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xCE,0x00,0x00,0x00,0xD0,0x00,0x00,0x00,
-	0x39,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xD1,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
-	0xCE,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xCD,0x00,0x00,0x00,0xD1,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xD4,0x00,0x00,0x00,0x1D,0x00,0x00,0x00,
-	0x4F,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,0xD5,0x00,0x00,0x00,0xD4,0x00,0x00,0x00,
-	0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xD3,0x00,0x00,0x00,0xD5,0x00,0x00,0x00,0x39,0x00,0x05,0x00,
-	0x0E,0x00,0x00,0x00,0xD6,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xD3,0x00,0x00,0x00,
-	0x3E,0x00,0x03,0x00,0xD2,0x00,0x00,0x00,0xD6,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x0E,0x00,0x00,0x00,0xD8,0x00,0x00,0x00,0xCD,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,
-	0x0E,0x00,0x00,0x00,0xD9,0x00,0x00,0x00,0xD2,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-	0x44,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,0x1D,0x00,0x00,0x00,0x82,0x00,0x00,0x00,
-	0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xDB,0x00,0x00,0x00,0xDA,0x00,0x00,0x00,
-	0x50,0x00,0x06,0x00,0x0E,0x00,0x00,0x00,0xDC,0x00,0x00,0x00,0xDB,0x00,0x00,0x00,
-	0xDB,0x00,0x00,0x00,0xDB,0x00,0x00,0x00,0x0C,0x00,0x08,0x00,0x0E,0x00,0x00,0x00,
-	0xDD,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2E,0x00,0x00,0x00,0xD8,0x00,0x00,0x00,
-	0xD9,0x00,0x00,0x00,0xDC,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xDE,0x00,0x00,0x00,
-	0xDD,0x00,0x00,0x00,0x39,0x00,0x05,0x00,0x0E,0x00,0x00,0x00,0xDF,0x00,0x00,0x00,
-	0x15,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,0x3E,0x00,0x03,0x00,0xD7,0x00,0x00,0x00,
-	0xDF,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x0E,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,
-	0xD7,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x44,0x00,0x00,0x00,0xE1,0x00,0x00,0x00,
-	0x1A,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x3D,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-	0xE2,0x00,0x00,0x00,0xE1,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-	0xE3,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-	0x06,0x00,0x00,0x00,0xE4,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xE5,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,
-	0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xE6,0x00,0x00,0x00,
-	0xE3,0x00,0x00,0x00,0xE4,0x00,0x00,0x00,0xE5,0x00,0x00,0x00,0xE2,0x00,0x00,0x00,
-	0xFE,0x00,0x02,0x00,0xE6,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
-};
-#endif
-static const char s_recolor_bytecode_blit_glsl300_src[2538] =
-"#version 300 es\n"
-"precision mediump float;\n"
-"precision highp int;\n"
-"\n"
-"layout(std140) uniform uniform_block\n"
-"{\n"
-"    highp vec2 u_texture_size;\n"
-"    int u_alpha_discard;\n"
-"} _244;\n"
-"\n"
-"uniform highp sampler2D u_image;\n"
-"\n"
-"in highp vec2 v_uv;\n"
-"in highp vec2 v_posH;\n"
-"in highp vec2 v_pos;\n"
-"in highp vec4 v_params;\n"
-"layout(location = 0) out highp vec4 result;\n"
-"\n"
-"highp vec2 smooth_uv(highp vec2 uv, highp vec2 texture_size)\n"
-"{\n"
-"    highp vec2 pixel = uv * texture_size;\n"
-"    highp vec2 seam = floor(pixel + vec2(0.5));\n"
-"    pixel = seam + clamp((pixel - seam) / fwidth(pixel), vec2(-0.5), vec2(0.5));\n"
-"    return pixel / texture_size;\n"
-"}\n"
-"\n"
-"highp vec3 rgb_to_hsv(highp vec3 c)\n"
-"{\n"
-"    highp vec4 K = vec4(0.0, -0.3333333432674407958984375, 0.666666686534881591796875, -1.0);\n"
-"    highp vec4 _76;\n"
-"    if (c.y < c.z)\n"
-"    {\n"
-"        _76 = vec4(c.zy, K.wz);\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _76 = vec4(c.yz, K.xy);\n"
-"    }\n"
-"    highp vec4 p = _76;\n"
-"    highp vec4 _106;\n"
-"    if (c.x < p.x)\n"
-"    {\n"
-"        _106 = vec4(p.xyw, c.x);\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _106 = vec4(c.x, p.yzx);\n"
-"    }\n"
-"    highp vec4 q = _106;\n"
-"    highp float d = q.x - min(q.w, q.y);\n"
-"    highp float e = 1.0000000133514319600180897396058e-10;\n"
-"    return vec3(abs(q.z + ((q.w - q.y) / ((6.0 * d) + e))), d / (q.x + e), q.x);\n"
-"}\n"
-"\n"
-"highp vec3 hsv_to_rgb(highp vec3 c)\n"
-"{\n"
-"    highp vec3 rgb = clamp(abs(mod(vec3(c.x * 6.0) + vec3(0.0, 4.0, 2.0), vec3(6.0)) - vec3(3.0)) - vec3(1.0), vec3(0.0), vec3(1.0));\n"
-"    rgb = (rgb * rgb) * (vec3(3.0) - (rgb * 2.0));\n"
-"    return mix(vec3(1.0), rgb, vec3(c.y)) * c.z;\n"
-"}\n"
-"\n"
-"highp vec4 shader(highp vec4 color, highp vec2 pos, highp vec2 screen_uv, highp vec4 params)\n"
-"{\n"
-"    highp vec3 param = color.xyz;\n"
-"    highp vec3 a = rgb_to_hsv(param);\n"
-"    highp vec3 param_1 = params.xyz;\n"
-"    highp vec3 b = rgb_to_hsv(param_1);\n"
-"    highp vec3 param_2 = mix(a, b, vec3(params.w));\n"
-"    highp vec3 c = hsv_to_rgb(param_2);\n"
-"    return vec4(c, color.w);\n"
-"}\n"
-"\n"
-"void main()\n"
-"{\n"
-"    highp vec2 param = v_uv;\n"
-"    highp vec2 param_1 = _244.u_texture_size;\n"
-"    highp vec4 color = texture(u_image, smooth_uv(param, param_1));\n"
-"    highp vec2 screen_uv = ((v_posH + vec2(1.0, -1.0)) * 0.5) * vec2(1.0, -1.0);\n"
-"    highp vec4 param_2 = color;\n"
-"    highp vec2 param_3 = v_pos;\n"
-"    highp vec2 param_4 = screen_uv;\n"
-"    highp vec4 param_5 = v_params;\n"
-"    highp vec4 c = shader(param_2, param_3, param_4, param_5);\n"
-"    bool _278 = _244.u_alpha_discard != 0;\n"
-"    bool _284;\n"
-"    if (_278)\n"
-"    {\n"
-"        _284 = c.w == 0.0;\n"
-"    }\n"
-"    else\n"
-"    {\n"
-"        _284 = _278;\n"
-"    }\n"
-"    if (_284)\n"
-"    {\n"
-"        discard;\n"
-"    }\n"
-"    result = c;\n"
-"}\n"
-"\n"
-"";
-static const char* s_recolor_bytecode_blit_image_names[1] = {
-    "u_image",
-};
-static CF_ShaderUniformInfo s_recolor_bytecode_blit_uniforms[1] = {
-	{
-		.block_name = "uniform_block",
-		.block_index = 0,
-		.block_size = 16,
-		.num_members = 2,
-	},
-};
-static CF_ShaderUniformMemberInfo s_recolor_bytecode_blit_uniform_members[2] = {
-	{
-		.name = "u_texture_size",
-		.type = CF_SHADER_INFO_TYPE_FLOAT2,
-		.offset = 0,
-		.array_length = 1,
-	},
-	{
-		.name = "u_alpha_discard",
-		.type = CF_SHADER_INFO_TYPE_SINT,
-		.offset = 8,
-		.array_length = 1,
-	},
-};
-#define s_recolor_bytecode_blit_inputs NULL
-static const CF_DrawShaderBytecode s_recolor_bytecode = {
-	.draw_shader = {
-#ifndef __EMSCRIPTEN__
-		.content = s_recolor_bytecode_draw_content,
-		.size = 24448,
-#endif
-		.glsl300_src = s_recolor_bytecode_draw_glsl300_src,
-		.glsl300_src_size = 11514,
-		.shader_info = {
-			.num_samplers = 1,
-			.num_storage_textures = 0,
-			.num_storage_buffers = 0,
-			.num_images = 1,
-			.image_names = s_recolor_bytecode_draw_image_names,
-			.num_uniforms = 1,
-			.uniforms = s_recolor_bytecode_draw_uniforms,
-			.num_uniform_members = 2,
-			.uniform_members = s_recolor_bytecode_draw_uniform_members,
-			.num_inputs = 0,
-			.inputs = s_recolor_bytecode_draw_inputs,
-		},
-	},
-	.blit_shader = {
-#ifndef __EMSCRIPTEN__
-		.content = s_recolor_bytecode_blit_content,
-		.size = 6828,
-#endif
-		.glsl300_src = s_recolor_bytecode_blit_glsl300_src,
-		.glsl300_src_size = 2537,
-		.shader_info = {
-			.num_samplers = 1,
-			.num_storage_textures = 0,
-			.num_storage_buffers = 0,
-			.num_images = 1,
-			.image_names = s_recolor_bytecode_blit_image_names,
-			.num_uniforms = 1,
-			.uniforms = s_recolor_bytecode_blit_uniforms,
-			.num_uniform_members = 2,
-			.uniform_members = s_recolor_bytecode_blit_uniform_members,
-			.num_inputs = 0,
-			.inputs = s_recolor_bytecode_blit_inputs,
-		},
-	},
-};
@@ -0,0 +1,225 @@
+#include "render_queue.h"
+
+#include <cute_c_runtime.h>
+#include <cute_math.h>
+#include <cute_sprite.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../engine/arena.h"
+#include "../engine/game_state.h"
+#include "asset/sprite.h"
+#include "component.h"
+#include "gfx.h"
+
+constexpr int      RADIX_BITS       = 8;
+constexpr int      RADIX_BUCKETS    = 1 << RADIX_BITS;
+constexpr int      RADIX_PASSES     = 64 / RADIX_BITS;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME        = 16777619u;
+
+static uint32_t find_texture_key(GameState* state, const char* name) {
+    for (uint32_t i = 0; i < SPRITE_COUNT; ++i) {
+        if (name == state->sprite_assets[i].name) { return 1 + i; }
+    }
+
+    // Not loaded through the asset table, hash the path itself
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (const char* c = name; c && *c; ++c) { hash = (hash ^ (uint8_t)*c) * FNV_PRIME; }
+    return hash | 0x80000000u;
+}
+
+// Copies of a loaded sprite share its interned name and easy sprites are numbered as they are made. Keys come from
+// the asset index or that number rather than the name's address, so the draw order is the same on every run.
+static uint32_t texture_key(GameState* state, const CF_Sprite* sprite) {
+    if (sprite == nullptr) { return 0; }
+    if (sprite->easy_sprite_id != 0) { return SPRITE_COUNT + 1 + (uint32_t)sprite->easy_sprite_id; }
+
+    // Open addressing on the name's address, the first push of a name pays for the lookup
+    auto           cache = &state->render_queue.textures;
+    const uint32_t mask  = RENDER_TEXTURE_CACHE_SLOTS - 1;
+    uint32_t       slot  = (uint32_t)(((uintptr_t)sprite->name >> 4) * FNV_PRIME) & mask;
+    for (int probe = 0; probe < RENDER_TEXTURE_CACHE_SLOTS; ++probe, slot = (slot + 1) & mask) {
+        if (cache->names[slot] == sprite->name) { return cache->keys[slot]; }
+        if (cache->names[slot] == nullptr) {
+            cache->names[slot] = sprite->name;
+            cache->keys[slot]  = find_texture_key(state, sprite->name);
+            return cache->keys[slot];
+        }
+    }
+    return find_texture_key(state, sprite->name);
+}
+
+// Shaders past the table share the last index, they still draw correctly but split into more runs
+static uint32_t shader_key(GameState* state, CF_Shader shader) {
+    if (shader.id == 0) { return 0; }
+
+    auto table = &state->render_queue.shaders;
+    for (int i = 0; i < table->count; ++i) {
+        if (table->ids[i] == shader.id) { return 1 + (uint32_t)i; }
+    }
+    if (table->count < RENDER_QUEUE_MAX_SHADERS - 1) { table->ids[table->count++] = shader.id; }
+    return (uint32_t)table->count;
+}
+
+static uint64_t make_key(ZIndex z_index, uint32_t shader, uint32_t texture) {
+    return ((uint64_t)z_index << 56) | ((uint64_t)shader << 48) | ((uint64_t)texture << 16);
+}
+
+static void push_item(GameState* state, RenderItem item, uint64_t key) {
+    auto queue = &state->render_queue;
+    if (queue->count >= queue->capacity) {
+        queue->dropped++;
+        return;
+    }
+
+    const uint32_t index  = (uint32_t)queue->count++;
+    queue->items[index]   = item;
+    queue->entries[index] = (RenderSortEntry){.key = key, .index = index};
+}
+
+// LSD radix sort; stable, so items with equal keys keep their submission order
+static void sort_entries(RenderQueue* queue) {
+    RenderSortEntry* source      = queue->entries;
+    RenderSortEntry* destination = queue->sort_scratch;
+    const size_t     count       = queue->count;
+
+    for (int pass = 0; pass < RADIX_PASSES; ++pass) {
+        const int shift                  = pass * RADIX_BITS;
+        size_t    offsets[RADIX_BUCKETS] = {0};
+
+        for (size_t i = 0; i < count; ++i) { offsets[(source[i].key >> shift) & (RADIX_BUCKETS - 1)]++; }
+
+        // Skip passes where every key has the same digit, e.g. the unused low bits
+        if (offsets[(source[0].key >> shift) & (RADIX_BUCKETS - 1)] == count) { continue; }
+
+        size_t total = 0;
+        for (int bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+            const size_t bucket_count = offsets[bucket];
+            offsets[bucket]           = total;
+            total += bucket_count;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            destination[offsets[(source[i].key >> shift) & (RADIX_BUCKETS - 1)]++] = source[i];
+        }
+
+        RenderSortEntry* swap = source;
+        source                = destination;
+        destination           = swap;
+    }
+
+    if (source != queue->entries) {
+        queue->sort_scratch = queue->entries;
+        queue->entries      = source;
+    }
+}
+
+void init_render_queue(GameState* state, size_t capacity) {
+    state->render_queue = (RenderQueue){
+        .items        = arena_alloc_required(&state->permanent_arena, capacity * sizeof(RenderItem)),
+        .entries      = arena_alloc_required(&state->permanent_arena, capacity * sizeof(RenderSortEntry)),
+        .sort_scratch = arena_alloc_required(&state->permanent_arena, capacity * sizeof(RenderSortEntry)),
+        .capacity     = capacity,
+    };
+}
+
+void render_queue_push_sprite(GameState* state, const CF_Sprite* sprite, CF_V2 position, CF_V2 scale, ZIndex z_index) {
+    render_queue_push_shaded_sprite(state, sprite, position, scale, z_index, (CF_Shader){0});
+}
+
+void render_queue_push_shaded_sprite(
+    GameState* state, const CF_Sprite* sprite, CF_V2 position, CF_V2 scale, ZIndex z_index, CF_Shader shader
+) {
+    push_item(
+        state,
+        (RenderItem){.sprite = sprite, .position = position, .scale = scale, .shader = shader},
+        make_key(z_index, shader_key(state, shader), texture_key(state, sprite))
+    );
+}
+
+void render_queue_push_quad(GameState* state, CF_V2 position, CF_V2 half_extents, CF_Color color, ZIndex z_index) {
+    push_item(
+        state,
+        (RenderItem){.position = position, .scale = half_extents, .color = color},
+        make_key(z_index, 0, texture_key(state, nullptr))
+    );
+}
+
+void render_queue_flush(GameState* state) {
+    auto queue = &state->render_queue;
+
+    CF_MEMSET(queue->draws_per_layer, 0, sizeof(queue->draws_per_layer));
+    queue->state_changes = 0;
+
+    if (queue->count == 0) { return; }
+
+    sort_entries(queue);
+
+    int      layer        = -1;
+    bool     color_pushed = false;
+    CF_Color color        = {0};
+    uint64_t shader_id    = 0;  // Cute's default, nothing pushed
+
+    // Queued quads are pixel-sized shapes, keep their edges crisp
+    gfx_push_antialias(state, false);
+
+    for (size_t i = 0; i < queue->count; ++i) {
+        const RenderSortEntry entry      = queue->entries[i];
+        const RenderItem*     item       = &queue->items[entry.index];
+        const int             item_layer = (int)(entry.key >> 56);
+
+        if (item_layer != layer) {
+            if (layer >= 0) { gfx_pop_layer(state); }
+            gfx_push_layer(state, item_layer);
+            layer = item_layer;
+            queue->state_changes++;
+        }
+
+        if (item->shader.id != shader_id) {
+            if (shader_id != 0) { gfx_pop_shader(state); }
+            if (item->shader.id != 0) { gfx_push_shader(state, item->shader); }
+            shader_id = item->shader.id;
+            queue->state_changes++;
+        }
+
+        if (item->sprite) {
+            if (color_pushed) {
+                gfx_pop_color(state);
+                color_pushed = false;
+            }
+
+            gfx_push(state);
+            gfx_translate(state, item->position);
+            gfx_scale(state, cf_v2(item->scale.x, item->scale.y));
+            gfx_draw_sprite(state, item->sprite);
+            gfx_pop(state);
+        } else {
+            const bool same_color = color_pushed && color.r == item->color.r && color.g == item->color.g &&
+                                    color.b == item->color.b && color.a == item->color.a;
+            if (!same_color) {
+                if (color_pushed) { gfx_pop_color(state); }
+                gfx_push_color(state, item->color);
+                color        = item->color;
+                color_pushed = true;
+                queue->state_changes++;
+            }
+
+            gfx_draw_quad_fill(state, cf_make_aabb_center_half_extents(item->position, item->scale), 0.0f);
+        }
+
+        queue->draws_per_layer[item_layer]++;
+    }
+
+    if (color_pushed) { gfx_pop_color(state); }
+    if (shader_id != 0) { gfx_pop_shader(state); }
+    if (layer >= 0) { gfx_pop_layer(state); }
+    gfx_pop_antialias(state);
+
+    queue->count = 0;
+}
+
+void render_queue_clear_caches(GameState* state) {
+    state->render_queue.textures = (RenderTextureCache){0};
+    state->render_queue.shaders  = (RenderShaderTable){0};
+}
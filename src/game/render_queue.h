@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cute_color.h>
+#include <cute_graphics.h>
+#include <cute_math.h>
+#include <cute_sprite.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "component.h"
+
+typedef struct GameState GameState;
+
+constexpr int RENDER_QUEUE_CAPACITY      = 8192;
+constexpr int RENDER_QUEUE_MAX_SHADERS   = 256;  // Index 0 is cute's default shader, sort keys hold 8 bits
+constexpr int RENDER_TEXTURE_CACHE_SLOTS = 64;   // Power of two, well above the sprite names in use
+
+/*
+ * Render Item
+ *
+ * A single packed draw: a sprite, or a filled quad when `sprite` is nullptr
+ */
+typedef struct RenderItem {
+    const CF_Sprite* sprite;
+    CF_V2            position;
+    CF_V2            scale;  // Sprite scale, or half extents for filled quads
+    CF_Color         color;   // Fill color for quads
+    CF_Shader        shader;  // Zero id for cute's default shader
+} RenderItem;
+
+typedef struct RenderSortEntry {
+    uint64_t key;    // ZIndex | shader | texture, most significant first
+    uint32_t index;  // Into RenderQueue.items
+} RenderSortEntry;
+
+// Sort key texture bits by interned sprite name, so each name is matched against the asset table once
+typedef struct RenderTextureCache {
+    const char* names[RENDER_TEXTURE_CACHE_SLOTS];  // nullptr marks a free slot
+    uint32_t    keys[RENDER_TEXTURE_CACHE_SLOTS];
+} RenderTextureCache;
+
+// Shaders in the order they were first pushed, their index goes in the sort key instead of the 64-bit id
+typedef struct RenderShaderTable {
+    uint64_t ids[RENDER_QUEUE_MAX_SHADERS];
+    int      count;
+} RenderShaderTable;
+
+/*
+ * Render Queue
+ *
+ * Systems append draw items during game_render(), the queue radix sorts them by (ZIndex, shader, texture) and
+ * submits them in order, so layer, shader and color pushes happen once per run instead of once per item. Items
+ * pushed past the capacity are dropped and counted.
+ */
+typedef struct RenderQueue {
+    RenderItem*        items;
+    RenderSortEntry*   entries;
+    RenderSortEntry*   sort_scratch;
+    size_t             count;
+    size_t             capacity;
+    size_t             dropped;  // Since init
+    RenderTextureCache textures;
+    RenderShaderTable  shaders;
+
+    // Stats of the last flush
+    size_t draws_per_layer[Z_MAX + 1];
+    size_t state_changes;
+} RenderQueue;
+
+void init_render_queue(GameState* state, size_t capacity);
+void render_queue_push_sprite(GameState* state, const CF_Sprite* sprite, CF_V2 position, CF_V2 scale, ZIndex z_index);
+void render_queue_push_shaded_sprite(
+    GameState* state, const CF_Sprite* sprite, CF_V2 position, CF_V2 scale, ZIndex z_index, CF_Shader shader
+);
+void render_queue_push_quad(GameState* state, CF_V2 position, CF_V2 half_extents, CF_Color color, ZIndex z_index);
+void render_queue_flush(GameState* state);
+void render_queue_clear_caches(GameState* state);  // Sprite names and shaders may not outlive a library reload
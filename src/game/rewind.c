@@ -0,0 +1,263 @@
+#define LOG_CATEGORY LOG_CATEGORY_STATE
+
+#include "rewind.h"
+
+#include <cute_c_runtime.h>
+#include <cute_time.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../engine/arena.h"
+#include "../engine/game_state.h"
+#include "../engine/log.h"
+#include "snapshot.h"
+
+// Runs are counted in words, most of the state is 4-byte floats and ints. Every stored frame is a whole number of
+// words, so frames in the buffer stay word aligned.
+constexpr size_t REWIND_WORD_SIZE = sizeof(uint32_t);
+
+static size_t get_word_count(size_t size) { return (size + REWIND_WORD_SIZE - 1) / REWIND_WORD_SIZE; }
+
+static uint32_t xor_word(const uint32_t* frame, const uint32_t* keyframe, size_t keyframe_words, size_t i) {
+    // Words past the end of the keyframe are XORed against zeros
+    return i < keyframe_words ? frame[i] ^ keyframe[i] : frame[i];
+}
+
+// The XOR of frame against its keyframe as runs of a header word (zero words in the low half, literal words in the
+// high half) followed by the literal words. Returns 0 when the runs would not fit.
+static size_t encode_zero_runs(
+    const uint32_t* frame,
+    size_t          words,
+    const uint32_t* keyframe,
+    size_t          keyframe_words,
+    uint32_t*       runs,
+    size_t          capacity
+) {
+    size_t in  = 0;
+    size_t out = 0;
+
+    while (in < words) {
+        size_t zeros = 0;
+        while (in < words && zeros < UINT16_MAX && xor_word(frame, keyframe, keyframe_words, in) == 0) {
+            in++;
+            zeros++;
+        }
+
+        // A lone zero word costs as much as the header that would skip it
+        const size_t literal_start = in;
+        while (in < words && in - literal_start < UINT16_MAX && out + 2 + in - literal_start <= capacity) {
+            const uint32_t literal = xor_word(frame, keyframe, keyframe_words, in);
+            if (literal == 0 && (in + 1 == words || xor_word(frame, keyframe, keyframe_words, in + 1) == 0)) { break; }
+            runs[out + 1 + in - literal_start] = literal;
+            in++;
+        }
+
+        const size_t literals = in - literal_start;
+        if (out + 1 + literals >= capacity) { return 0; }
+
+        runs[out] = (uint32_t)zeros | (uint32_t)literals << 16;
+        out += 1 + literals;
+    }
+
+    return out;
+}
+
+static bool apply_zero_runs(uint32_t* frame, size_t words, const uint32_t* runs, size_t runs_words) {
+    size_t in = 0;
+    size_t at = 0;
+
+    while (in < runs_words) {
+        const size_t zeros    = runs[in] & UINT16_MAX;
+        const size_t literals = runs[in] >> 16;
+        in++;
+        at += zeros;
+        if (at + literals > words || in + literals > runs_words) { return false; }
+
+        for (size_t i = 0; i < literals; ++i) { frame[at + i] ^= runs[in + i]; }
+        at += literals;
+        in += literals;
+    }
+
+    return true;
+}
+
+static RewindFrame* get_frame(RewindBuffer* rewind, int index) {
+    return &rewind->frames[(rewind->first + index) % REWIND_MAX_FRAMES];
+}
+
+static void evict_oldest_frame(RewindBuffer* rewind) {
+    const RewindFrame* frame     = get_frame(rewind, 0);
+    rewind->stats.stored_bytes  -= frame->size;
+    rewind->stats.raw_bytes     -= frame->raw_size;
+    rewind->first                = (rewind->first + 1) % REWIND_MAX_FRAMES;
+    rewind->count--;
+    if (rewind->cursor > 0) { rewind->cursor--; }
+}
+
+static void evict_newest_frame(RewindBuffer* rewind) {
+    const RewindFrame* frame     = get_frame(rewind, rewind->count - 1);
+    rewind->stats.stored_bytes  -= frame->size;
+    rewind->stats.raw_bytes     -= frame->raw_size;
+    rewind->count--;
+}
+
+static bool overlaps(const RewindFrame* frame, size_t offset, size_t size) {
+    return frame->offset < offset + size && offset < frame->offset + frame->size;
+}
+
+// Evicts whatever is stored where the next frame goes. Frames are stored in ring order, so those are the oldest.
+static bool reserve_frame(RewindBuffer* rewind, size_t size, size_t* offset) {
+    if (size > rewind->capacity) { return false; }
+    if (rewind->count == REWIND_MAX_FRAMES) { evict_oldest_frame(rewind); }
+
+    size_t start = rewind->write_offset;
+    if (start + size > rewind->capacity) {
+        // The tail is too short, drop the frames still stored there and continue from the front
+        while (rewind->count > 0 && get_frame(rewind, 0)->offset >= start) { evict_oldest_frame(rewind); }
+        start = 0;
+    }
+    while (rewind->count > 0 && overlaps(get_frame(rewind, 0), start, size)) { evict_oldest_frame(rewind); }
+
+    // Deltas cannot be decoded without their keyframe
+    while (rewind->count > 0 && get_frame(rewind, 0)->key_distance > 0) { evict_oldest_frame(rewind); }
+
+    *offset = start;
+    return true;
+}
+
+void init_rewind_buffer(GameState* state, RewindBuffer* rewind) {
+    *rewind = (RewindBuffer){
+        .data     = arena_alloc(&state->permanent_arena, REWIND_BUFFER_SIZE),
+        .frames   = arena_alloc(&state->permanent_arena, REWIND_MAX_FRAMES * sizeof(RewindFrame)),
+        .capacity = REWIND_BUFFER_SIZE,
+    };
+
+    if (rewind->data == nullptr || rewind->frames == nullptr) {
+        APP_WARN("Rewind is disabled, the permanent arena has no room for %d bytes", REWIND_BUFFER_SIZE);
+        *rewind = (RewindBuffer){0};
+    }
+}
+
+void clear_rewind_buffer(RewindBuffer* rewind) {
+    rewind->first              = 0;
+    rewind->count              = 0;
+    rewind->cursor             = 0;
+    rewind->write_offset       = 0;
+    rewind->is_paused          = false;
+    rewind->stats.stored_bytes = 0;
+    rewind->stats.raw_bytes    = 0;
+}
+
+void record_rewind_frame(GameState* state, RewindBuffer* rewind) {
+    if (rewind->data == nullptr || rewind->is_paused) { return; }
+
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+
+    // Keyframes are stored zero padded to whole words, deltas are whole words already
+    const size_t raw_size        = measure_snapshot(state);
+    const size_t words           = get_word_count(raw_size);
+    uint32_t*    raw             = arena_alloc(&state->scratch_arena, words * REWIND_WORD_SIZE);
+    uint32_t*    runs            = arena_alloc(&state->scratch_arena, words * REWIND_WORD_SIZE);
+    if (words == 0 || raw == nullptr || runs == nullptr) { return; }
+    raw[words - 1] = 0;
+    write_snapshot(state, (uint8_t*)raw, raw_size);
+
+    // A delta against the newest keyframe, unless the interval is up or the delta would not be any smaller
+    uint32_t key_distance = rewind->count > 0 ? get_frame(rewind, rewind->count - 1)->key_distance + 1 : 0;
+    if (key_distance >= REWIND_KEYFRAME_INTERVAL) { key_distance = 0; }
+
+    const uint32_t* stored      = raw;
+    size_t          stored_size = words * REWIND_WORD_SIZE;
+    if (key_distance > 0) {
+        const RewindFrame* keyframe   = get_frame(rewind, rewind->count - (int)key_distance);
+        const uint32_t*    key_data   = (const uint32_t*)(rewind->data + keyframe->offset);
+        const size_t       key_words  = get_word_count(keyframe->raw_size);
+        const size_t       runs_words = encode_zero_runs(raw, words, key_data, key_words, runs, words);
+        if (runs_words > 0) {
+            stored      = runs;
+            stored_size = runs_words * REWIND_WORD_SIZE;
+        } else {
+            key_distance = 0;
+        }
+    }
+
+    size_t offset      = 0;
+    bool   is_reserved = reserve_frame(rewind, stored_size, &offset);
+    if (is_reserved && key_distance > (uint32_t)rewind->count) {
+        // Making room evicted its own keyframe, store this tick whole instead
+        key_distance = 0;
+        stored       = raw;
+        stored_size  = words * REWIND_WORD_SIZE;
+        is_reserved  = reserve_frame(rewind, stored_size, &offset);
+    }
+    if (!is_reserved) { return; }
+
+    memcpy(rewind->data + offset, stored, stored_size);
+    *get_frame(rewind, rewind->count) = (RewindFrame){
+        .offset       = offset,
+        .size         = (uint32_t)stored_size,
+        .raw_size     = (uint32_t)raw_size,
+        .key_distance = key_distance,
+    };
+    rewind->count++;
+    rewind->cursor              = rewind->count - 1;
+    rewind->write_offset        = offset + stored_size;
+
+    rewind->stats.stored_bytes += stored_size;
+    rewind->stats.raw_bytes    += raw_size;
+    rewind->stats.capture_ms    = cf_stopwatch_milliseconds(stopwatch);
+    if (rewind->stats.capture_ms > rewind->stats.peak_capture_ms) {
+        rewind->stats.peak_capture_ms = rewind->stats.capture_ms;
+    }
+}
+
+void pause_rewind_buffer(RewindBuffer* rewind) {
+    rewind->is_paused = true;
+    rewind->cursor    = rewind->count - 1;
+}
+
+bool seek_rewind_frame(GameState* state, RewindBuffer* rewind, int cursor) {
+    if (rewind->count == 0) { return false; }
+    cursor                      = cursor < 0 ? 0 : (cursor >= rewind->count ? rewind->count - 1 : cursor);
+
+    const RewindFrame* frame    = get_frame(rewind, cursor);
+    const RewindFrame* keyframe = get_frame(rewind, cursor - (int)frame->key_distance);
+    const uint8_t*     snapshot = rewind->data + frame->offset;
+
+    if (frame->key_distance > 0) {
+        const size_t words     = get_word_count(frame->raw_size);
+        const size_t key_words = get_word_count(keyframe->raw_size);
+        uint32_t*    decoded   = arena_alloc(&state->scratch_arena, words * REWIND_WORD_SIZE);
+        if (decoded == nullptr) { return false; }
+
+        const size_t shared = words < key_words ? words : key_words;
+        memcpy(decoded, rewind->data + keyframe->offset, shared * REWIND_WORD_SIZE);
+        memset(decoded + shared, 0, (words - shared) * REWIND_WORD_SIZE);
+        const uint32_t* runs = (const uint32_t*)snapshot;
+        if (!apply_zero_runs(decoded, words, runs, frame->size / REWIND_WORD_SIZE)) {
+            APP_ERROR("Rewind frame %d does not decode", cursor);
+            return false;
+        }
+        snapshot = (const uint8_t*)decoded;
+    }
+
+    if (!read_snapshot(state, snapshot, frame->raw_size)) {
+        APP_ERROR("Rewind frame %d is not a valid snapshot", cursor);
+        return false;
+    }
+
+    rewind->cursor = cursor;
+    return true;
+}
+
+void resume_from_rewind_frame(RewindBuffer* rewind) {
+    // The frames after the cursor are the future being replaced
+    while (rewind->count > rewind->cursor + 1) { evict_newest_frame(rewind); }
+
+    if (rewind->count > 0) {
+        const RewindFrame* newest = get_frame(rewind, rewind->count - 1);
+        rewind->write_offset      = newest->offset + newest->size;
+    }
+    rewind->is_paused = false;
+}
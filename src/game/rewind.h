@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cute_defines.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct GameState GameState;
+
+constexpr int REWIND_MAX_FRAMES        = 60 * 30;  // 30 seconds of fixed 60 Hz ticks
+constexpr int REWIND_KEYFRAME_INTERVAL = 60;       // Ticks between full snapshots, the rest are deltas against them
+constexpr int REWIND_BUFFER_SIZE       = CF_MB * 16;
+
+typedef struct RewindFrame {
+    size_t   offset;        // Into RewindBuffer.data
+    uint32_t size;          // Stored bytes
+    uint32_t raw_size;      // Bytes of the snapshot it decodes to
+    uint32_t key_distance;  // Frames back to the keyframe it is a delta against, 0 for keyframes
+} RewindFrame;
+
+typedef struct RewindStats {
+    double capture_ms;  // Last tick
+    double peak_capture_ms;
+    size_t stored_bytes;  // Every frame in the buffer, as stored
+    size_t raw_bytes;     // The same frames as full snapshots
+} RewindStats;
+
+/*
+ * Rewind Buffer
+ *
+ * The last REWIND_MAX_FRAMES ticks as snapshots, in a ring of bytes. Keyframes are stored whole, other ticks as the
+ * zero-run-length encoded XOR against their keyframe. The oldest frame is always a keyframe, frames that depend on
+ * an evicted keyframe are evicted with it.
+ */
+typedef struct RewindBuffer {
+    uint8_t*     data;
+    size_t       capacity;
+    size_t       write_offset;
+    RewindFrame* frames;  // Ring of REWIND_MAX_FRAMES
+    int          first;   // Oldest frame in the ring
+    int          count;
+    int          cursor;  // Frame shown while paused, 0 is the oldest
+    bool         is_paused;
+    RewindStats  stats;
+} RewindBuffer;
+
+void init_rewind_buffer(GameState* state, RewindBuffer* rewind);
+void clear_rewind_buffer(RewindBuffer* rewind);
+void record_rewind_frame(GameState* state, RewindBuffer* rewind);
+void pause_rewind_buffer(RewindBuffer* rewind);            // Stops recording, the cursor starts on the newest frame
+bool seek_rewind_frame(GameState* state, RewindBuffer* rewind, int cursor);  // Restores the state of that frame
+void resume_from_rewind_frame(RewindBuffer* rewind);       // Drops the frames after the cursor and records again
@@ -0,0 +1,28 @@
+#include "rnd_stream.h"
+
+#include <cute_rnd.h>
+#include <stdint.h>
+
+// One step of splitmix64, a bijection with good avalanche, so distinct inputs never collide
+static uint64_t splitmix64(uint64_t x) {
+    x = x + 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+uint64_t derive_rnd_seed(uint64_t seed, RndStream stream, uint64_t split) {
+    return splitmix64(splitmix64(splitmix64(seed) ^ (uint64_t)stream) ^ split);
+}
+
+CF_Rnd make_rnd_stream(uint64_t seed, RndStream stream, uint64_t split) {
+    return cf_rnd_seed(derive_rnd_seed(seed, stream, split));
+}
+
+RndStreams make_rnd_streams(uint64_t seed) {
+    return (RndStreams){
+        .seed      = seed,
+        .gameplay  = make_rnd_stream(seed, RND_STREAM_GAMEPLAY, 0),
+        .particles = make_rnd_stream(seed, RND_STREAM_PARTICLES, 0),
+    };
+}
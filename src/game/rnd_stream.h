@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cute_rnd.h>
+#include <stdint.h>
+
+typedef enum RndStream {
+    RND_STREAM_GAMEPLAY,   // Enemy cooldowns, shoot rolls, enemy types and spawn positions
+    RND_STREAM_PARTICLES,  // Hit and explosion particle speeds, lifetimes, sizes and colors
+    RND_STREAM_STARS,      // Star field layout
+    RND_STREAM_AUDIO,      // Sound variations, nothing draws from it yet
+} RndStream;
+
+/*
+ * Rnd Streams
+ *
+ * Every stream is derived from the master seed and its RndStream id, so adding a particle never shifts the gameplay
+ * sequence and a replay only needs the seed. Cosmetic work that runs in parallel takes one split per chunk of work
+ * from make_rnd_stream(): splits are independent of each other and of the thread that ends up running them, so the
+ * result does not depend on scheduling or the number of workers.
+ */
+typedef struct RndStreams {
+    uint64_t seed;       // Master seed, logged at startup
+    CF_Rnd   gameplay;   // Part of the simulation, snapshots and rollback restore it
+    CF_Rnd   particles;  // Split 0 of RND_STREAM_PARTICLES, for the particles spawned on the main thread
+} RndStreams;
+
+RndStreams make_rnd_streams(uint64_t seed);
+uint64_t   derive_rnd_seed(uint64_t seed, RndStream stream, uint64_t split);
+CF_Rnd     make_rnd_stream(uint64_t seed, RndStream stream, uint64_t split);
@@ -0,0 +1,198 @@
+#define LOG_CATEGORY LOG_CATEGORY_STATE
+
+#include "rollback.h"
+
+#include <cute_c_runtime.h>
+#include <cute_math.h>
+#include <cute_rnd.h>
+#include <cute_time.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../engine/arena.h"
+#include "../engine/game_state.h"
+#include "../engine/log.h"
+#include "snapshot.h"
+
+constexpr float LOOPBACK_FRAME_MS           = 1000.0f / 60.0f;  // The peer advances once per fixed tick
+constexpr float LOOPBACK_DEFAULT_LATENCY_MS = 60.0f;
+constexpr float LOOPBACK_DEFAULT_JITTER_MS  = 20.0f;
+
+static RollbackTick* get_tick(RollbackSession* session, int64_t tick) {
+    return &session->ticks[tick % ROLLBACK_HISTORY];
+}
+
+// Sized for every entity array at capacity, so any tick fits
+static bool allocate_tick_states(GameState* state, RollbackSession* session) {
+    session->state_capacity = measure_snapshot_capacity(state);
+    for (int i = 0; i < ROLLBACK_HISTORY; ++i) {
+        session->ticks[i].state = arena_alloc(&state->permanent_arena, session->state_capacity);
+        if (session->ticks[i].state == nullptr) {
+            APP_WARN("Co-op is disabled, the permanent arena has no room for %d ticks", ROLLBACK_HISTORY);
+            session->state_capacity = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+static void send_to_peer(LoopbackPeer* peer, int64_t tick, Input input) {
+    // Latency plus jitter stays under LOOPBACK_MAX_DELAY_MS, so at most that many ticks are in flight
+    CF_ASSERT(peer->packets_count < LOOPBACK_MAX_PACKETS);
+
+    float jitter = 0.0f;
+    if (peer->jitter_ms > 0.0f) { jitter = cf_rnd_range_float(&peer->rnd, -peer->jitter_ms, peer->jitter_ms); }
+    const float delay_ms = cf_clamp(peer->latency_ms + jitter, 0.0f, LOOPBACK_MAX_DELAY_MS);
+
+    peer->packets[peer->packets_count++] = (InputPacket){
+        .tick          = tick,
+        .input         = input,
+        .deliver_frame = peer->frame + (uint64_t)(delay_ms / LOOPBACK_FRAME_MS + 0.5f),
+    };
+}
+
+// A remote input that differs from its prediction marks the oldest tick to simulate again
+static void receive_remote_input(RollbackSession* session, int64_t tick, Input input) {
+    if (tick < session->confirmed_tick || tick >= session->tick) { return; }
+
+    RollbackTick* slot = get_tick(session, tick);
+    if (slot->is_confirmed) { return; }
+
+    slot->is_confirmed = true;
+    if (!is_same_input(slot->inputs[ROLLBACK_REMOTE_PLAYER], input)) {
+        slot->inputs[ROLLBACK_REMOTE_PLAYER] = input;
+        session->stats.mispredictions++;
+        if (session->rollback_tick < 0 || tick < session->rollback_tick) { session->rollback_tick = tick; }
+    }
+
+    while (session->confirmed_tick < session->tick && get_tick(session, session->confirmed_tick)->is_confirmed) {
+        session->confirmed_tick++;
+    }
+}
+
+static void deliver_packets(RollbackSession* session) {
+    LoopbackPeer* peer = &session->peer;
+    peer->frame++;
+
+    for (int i = 0; i < peer->packets_count;) {
+        const InputPacket packet = peer->packets[i];
+        if (packet.deliver_frame > peer->frame) {
+            i++;
+            continue;
+        }
+
+        peer->packets[i] = peer->packets[--peer->packets_count];
+        receive_remote_input(session, packet.tick, packet.input);
+    }
+}
+
+// Until its input arrives, the remote player keeps doing what it did the tick before
+static void predict_remote_input(RollbackSession* session, int64_t tick) {
+    RollbackTick* slot = get_tick(session, tick);
+    if (slot->is_confirmed) { return; }
+
+    Input predicted = {0};
+    if (tick > 0) { predicted = get_tick(session, tick - 1)->inputs[ROLLBACK_REMOTE_PLAYER]; }
+    slot->inputs[ROLLBACK_REMOTE_PLAYER] = predicted;
+}
+
+static void run_tick(GameState* state, RollbackSession* session, int64_t tick, SimulateTickFunction simulate_tick) {
+    RollbackTick* slot = get_tick(session, tick);
+
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+    slot->state_size             = measure_snapshot(state);
+    CF_ASSERT(slot->state_size <= session->state_capacity);
+    write_snapshot(state, slot->state, slot->state_size);
+    session->stats.save_ms = cf_stopwatch_milliseconds(stopwatch);
+
+    for (size_t i = 0; i < state->players_count; ++i) { state->players[i].input = slot->inputs[i]; }
+    simulate_tick(state);
+}
+
+static void resimulate(GameState* state, RollbackSession* session, SimulateTickFunction simulate_tick) {
+    session->stats.resimulated_ticks = 0;
+    if (session->rollback_tick < 0) { return; }
+
+    const CF_Stopwatch  stopwatch = cf_make_stopwatch();
+    const int64_t       from      = session->rollback_tick;
+    const RollbackTick* slot      = get_tick(session, from);
+    session->rollback_tick        = -1;
+
+    if (!read_snapshot(state, slot->state, slot->state_size)) {
+        APP_ERROR("Rollback state of tick %lld does not load, keeping the mispredicted ticks", (long long)from);
+        return;
+    }
+
+    session->is_resimulating = true;
+    for (int64_t tick = from; tick < session->tick; ++tick) {
+        predict_remote_input(session, tick);
+        run_tick(state, session, tick, simulate_tick);
+    }
+    session->is_resimulating         = false;
+
+    session->stats.resimulated_ticks = (int)(session->tick - from);
+    session->stats.resimulate_ms     = cf_stopwatch_milliseconds(stopwatch);
+    if (session->stats.resimulated_ticks > session->stats.peak_resimulated_ticks) {
+        session->stats.peak_resimulated_ticks = session->stats.resimulated_ticks;
+    }
+    if (session->stats.resimulate_ms > session->stats.peak_resimulate_ms) {
+        session->stats.peak_resimulate_ms = session->stats.resimulate_ms;
+    }
+}
+
+void init_rollback_session(GameState* state, RollbackSession* session) {
+    *session                 = (RollbackSession){.rollback_tick = -1};
+    session->peer.latency_ms = LOOPBACK_DEFAULT_LATENCY_MS;
+    session->peer.jitter_ms  = LOOPBACK_DEFAULT_JITTER_MS;
+    session->peer.rnd        = cf_rnd_seed(0x5EED);
+    allocate_tick_states(state, session);
+}
+
+void start_rollback_session(GameState* state, RollbackSession* session) {
+    // A hot reload can grow snapshots past the buffers sized by the previous library
+    if (measure_snapshot_capacity(state) > session->state_capacity && !allocate_tick_states(state, session)) { return; }
+
+    for (int i = 0; i < ROLLBACK_HISTORY; ++i) {
+        session->ticks[i].is_confirmed = false;
+        session->ticks[i].state_size   = 0;
+    }
+    session->tick               = 0;
+    session->confirmed_tick     = 0;
+    session->rollback_tick      = -1;
+    session->peer.packets_count = 0;
+    session->stats              = (RollbackStats){0};
+    session->is_active          = true;
+}
+
+void stop_rollback_session(RollbackSession* session) {
+    session->is_active          = false;
+    session->peer.packets_count = 0;
+}
+
+void update_rollback_session(
+    GameState* state,
+    RollbackSession* session,
+    Input local_input,
+    Input remote_input,
+    SimulateTickFunction simulate_tick
+) {
+    if (!session->is_active) { return; }
+
+    deliver_packets(session);
+    resimulate(state, session, simulate_tick);
+
+    // Predictions only reach ROLLBACK_MAX_TICKS back, wait for the peer to catch up
+    if (session->tick - session->confirmed_tick >= ROLLBACK_MAX_TICKS) {
+        session->stats.stalled_frames++;
+        return;
+    }
+
+    RollbackTick* slot                  = get_tick(session, session->tick);
+    slot->is_confirmed                  = false;
+    slot->inputs[ROLLBACK_LOCAL_PLAYER] = local_input;
+    predict_remote_input(session, session->tick);
+    run_tick(state, session, session->tick, simulate_tick);
+
+    send_to_peer(&session->peer, session->tick, remote_input);
+    session->tick++;
+}
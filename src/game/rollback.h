@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cute_rnd.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "input.h"
+#include "player.h"
+
+typedef struct GameState GameState;
+
+constexpr int ROLLBACK_MAX_TICKS     = 8;   // Deepest re-simulation, the session waits for the peer beyond it
+constexpr int ROLLBACK_HISTORY       = 16;  // Ticks kept, more than ROLLBACK_MAX_TICKS + 1
+constexpr int ROLLBACK_LOCAL_PLAYER  = 0;
+constexpr int ROLLBACK_REMOTE_PLAYER = 1;
+constexpr int LOOPBACK_MAX_PACKETS   = 64;
+
+constexpr float LOOPBACK_MAX_DELAY_MS = 500.0f;  // Latency plus jitter
+
+typedef void (*SimulateTickFunction)(GameState* state);
+
+typedef struct InputPacket {
+    int64_t  tick;
+    Input    input;
+    uint64_t deliver_frame;  // LoopbackPeer.frame it arrives on
+} InputPacket;
+
+/*
+ * Loopback Peer
+ *
+ * Stands in for the network: the remote player's input is read on this machine and held back for the configured
+ * latency plus a random jitter, so packets also arrive out of order.
+ */
+typedef struct LoopbackPeer {
+    InputPacket packets[LOOPBACK_MAX_PACKETS];  // In flight, unordered
+    int         packets_count;
+    uint64_t    frame;
+    float       latency_ms;
+    float       jitter_ms;  // Added or subtracted at random per packet
+    CF_Rnd      rnd;        // Jitter only, the simulation's rnd is part of the rolled back state
+} LoopbackPeer;
+
+typedef struct RollbackTick {
+    Input    inputs[MAX_PLAYERS];
+    bool     is_confirmed;  // The remote input arrived, otherwise it is a prediction
+    uint8_t* state;         // Snapshot from the start of the tick
+    size_t   state_size;
+} RollbackTick;
+
+typedef struct RollbackStats {
+    int    resimulated_ticks;  // Last frame
+    int    peak_resimulated_ticks;
+    double resimulate_ms;  // Last frame, restoring included
+    double peak_resimulate_ms;
+    double save_ms;  // Last tick
+    int    mispredictions;
+    int    stalled_frames;  // Waiting for the peer
+} RollbackStats;
+
+/*
+ * Rollback Session
+ *
+ * Two-player co-op against a LoopbackPeer. Every tick runs at once on the local input and a predicted remote input,
+ * the last one that arrived. When a remote input turns out different, the state is restored to the start of that
+ * tick and the ticks since are simulated again with sounds muted.
+ */
+typedef struct RollbackSession {
+    RollbackTick  ticks[ROLLBACK_HISTORY];  // Ring indexed by tick
+    size_t        state_capacity;
+    int64_t       tick;            // Next tick to simulate
+    int64_t       confirmed_tick;  // Every remote input before it has arrived
+    int64_t       rollback_tick;   // Oldest mispredicted tick, -1 when the predictions held
+    LoopbackPeer  peer;
+    bool          is_active;
+    bool          is_resimulating;  // Side effects outside the state, such as sounds, are skipped
+    RollbackStats stats;
+} RollbackSession;
+
+void init_rollback_session(GameState* state, RollbackSession* session);
+void start_rollback_session(GameState* state, RollbackSession* session);  // Tick 0 is the current state
+void stop_rollback_session(RollbackSession* session);
+void update_rollback_session(
+    GameState* state,
+    RollbackSession* session,
+    Input local_input,
+    Input remote_input,
+    SimulateTickFunction simulate_tick
+);
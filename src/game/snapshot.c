@@ -0,0 +1,386 @@
+#define LOG_CATEGORY LOG_CATEGORY_STATE
+
+#include "snapshot.h"
+
+#include <cute_c_runtime.h>
+#include <cute_math.h>
+#include <cute_sprite.h>
+#include <cute_time.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../engine/arena.h"
+#include "../engine/game_state.h"
+#include "../engine/log.h"
+#include "asset/sprite.h"
+#include "hud.h"
+#include "state_layout.h"
+
+constexpr int SNAPSHOT_ANIMATION_NAME_SIZE = 32;
+constexpr int SNAPSHOT_MAX_RECORD_SPRITES  = 2;
+
+// Sprite ids: the sprite assets first, then the sprites built at init
+constexpr int SNAPSHOT_SPRITE_NONE         = -1;
+constexpr int SNAPSHOT_SPRITE_PARTICLE     = SPRITE_COUNT;
+constexpr int SNAPSHOT_SPRITE_PALETTE      = SPRITE_COUNT + 1;
+constexpr int SNAPSHOT_SPRITE_COUNT        = SNAPSHOT_SPRITE_PALETTE + EXPLOSION_PALETTE_SIZE;
+
+// Per-instance sprite state, everything else is shared with the sprite it was copied from
+typedef struct SnapshotSprite {
+    int32_t id;
+    int32_t frame_index;
+    int32_t loop_count;
+    float   t;
+    float   opacity;
+    float   play_speed_multiplier;
+    CF_V2   scale;
+    CF_V2   offset;
+    bool    paused;
+    bool    loop;
+    char    animation[SNAPSHOT_ANIMATION_NAME_SIZE];
+} SnapshotSprite;
+
+// Where the sprites sit in an entity struct, in ascending order. The bytes around them are copied as is.
+typedef struct RecordLayout {
+    size_t size;
+    size_t sprite_offsets[SNAPSHOT_MAX_RECORD_SPRITES];
+    size_t sprite_count;
+} RecordLayout;
+
+static const RecordLayout s_player_layout = {
+    .size           = sizeof(Player),
+    .sprite_offsets = {offsetof(Player, sprite), offsetof(Player, booster_sprite)},
+    .sprite_count   = 2,
+};
+static const RecordLayout s_player_bullet_layout      = {sizeof(PlayerBullet), {offsetof(PlayerBullet, sprite)}, 1};
+static const RecordLayout s_enemy_layout              = {sizeof(Enemy), {offsetof(Enemy, sprite)}, 1};
+static const RecordLayout s_enemy_bullet_layout       = {sizeof(EnemyBullet), {offsetof(EnemyBullet, sprite)}, 1};
+static const RecordLayout s_explosion_layout          = {sizeof(Explosion), {offsetof(Explosion, sprite)}, 1};
+static const RecordLayout s_hit_particle_layout       = {sizeof(HitParticle), {offsetof(HitParticle, sprite)}, 1};
+static const RecordLayout s_explosion_particle_layout = {
+    .size           = sizeof(ExplosionParticle),
+    .sprite_offsets = {offsetof(ExplosionParticle, sprite)},
+    .sprite_count   = 1,
+};
+static const RecordLayout s_floating_score_layout = {sizeof(FloatingScore), {0}, 0};
+
+typedef enum SnapshotMode {
+    SNAPSHOT_MODE_MEASURE,  // Only counts bytes, sizes the save buffer
+    SNAPSHOT_MODE_SAVE,
+    SNAPSHOT_MODE_VERIFY,   // Walks a loaded file without touching the state, so a bad file changes nothing
+    SNAPSHOT_MODE_LOAD,
+} SnapshotMode;
+
+typedef struct SnapshotStream {
+    SnapshotMode mode;
+    uint8_t*     data;
+    size_t       size;  // Bytes written or read so far
+    size_t       capacity;
+    bool         ok;             // Cleared when a read runs past the end or meets an invalid value
+    int32_t      sprite_hint;    // Last sprite id found, neighbouring entities mostly share their sprite
+    bool         is_worst_case;  // Measures every entity array at capacity
+} SnapshotStream;
+
+/*
+ * The same serialize_*() calls measure, save, verify and load a snapshot, so the order of the sections can never
+ * differ between saving and loading.
+ */
+
+// Values the stream itself depends on, such as counts and sprite ids, are read while verifying too
+static void serialize_control(SnapshotStream* stream, void* value, size_t size) {
+    if (stream->size + size > stream->capacity && stream->mode != SNAPSHOT_MODE_MEASURE) { stream->ok = false; }
+    if (!stream->ok) { return; }
+
+    if (stream->mode == SNAPSHOT_MODE_SAVE) {
+        memcpy(stream->data + stream->size, value, size);
+    } else if (stream->mode != SNAPSHOT_MODE_MEASURE) {
+        memcpy(value, stream->data + stream->size, size);
+    }
+    stream->size += size;
+}
+
+static void serialize_bytes(SnapshotStream* stream, void* state, size_t size) {
+    if (stream->mode == SNAPSHOT_MODE_VERIFY) {
+        if (stream->size + size > stream->capacity) { stream->ok = false; }
+        if (stream->ok) { stream->size += size; }
+        return;
+    }
+    serialize_control(stream, state, size);
+}
+
+#define serialize_value(stream, value) serialize_bytes((stream), &(value), sizeof(value))
+
+static const CF_Sprite* get_sprite_source(GameState* state, int32_t id) {
+    if (id < SPRITE_COUNT) { return &state->sprite_assets[id]; }
+    if (id == SNAPSHOT_SPRITE_PARTICLE) { return &state->sprites.particle; }
+    return &state->sprites.explosion_palette[id - SNAPSHOT_SPRITE_PALETTE];
+}
+
+// Copies share the interned name, and easy sprites differ by id
+static bool is_copy_of(const CF_Sprite* sprite, const CF_Sprite* source) {
+    return source->name == sprite->name && source->easy_sprite_id == sprite->easy_sprite_id;
+}
+
+static int32_t find_sprite_id(GameState* state, SnapshotStream* stream, const CF_Sprite* sprite) {
+    if (sprite->name == nullptr && sprite->easy_sprite_id == 0) { return SNAPSHOT_SPRITE_NONE; }
+    if (is_copy_of(sprite, get_sprite_source(state, stream->sprite_hint))) { return stream->sprite_hint; }
+
+    for (int32_t id = 0; id < SNAPSHOT_SPRITE_COUNT; ++id) {
+        if (is_copy_of(sprite, get_sprite_source(state, id))) {
+            stream->sprite_hint = id;
+            return id;
+        }
+    }
+
+    APP_WARN("Snapshot skips sprite %s, it is not copied from a loaded sprite", sprite->name ? sprite->name : "?");
+    return SNAPSHOT_SPRITE_NONE;
+}
+
+static SnapshotSprite capture_sprite(GameState* state, SnapshotStream* stream, const CF_Sprite* sprite) {
+    SnapshotSprite stored = {
+        .id                    = find_sprite_id(state, stream, sprite),
+        .frame_index           = sprite->frame_index,
+        .loop_count            = sprite->loop_count,
+        .t                     = sprite->t,
+        .opacity               = sprite->opacity,
+        .play_speed_multiplier = sprite->play_speed_multiplier,
+        .scale                 = sprite->scale,
+        .offset                = sprite->offset,
+        .paused                = sprite->paused,
+        .loop                  = sprite->loop,
+    };
+
+    if (sprite->animation && sprite->animation->name) {
+        strncpy(stored.animation, sprite->animation->name, SNAPSHOT_ANIMATION_NAME_SIZE - 1);
+    }
+    return stored;
+}
+
+static void restore_sprite(GameState* state, CF_Sprite* sprite, const SnapshotSprite* stored) {
+    if (stored->id == SNAPSHOT_SPRITE_NONE) {
+        *sprite = (CF_Sprite){0};
+        return;
+    }
+
+    // Pointers come from the loaded sprite, only the playback state from the snapshot
+    *sprite = *get_sprite_source(state, stored->id);
+    if (stored->animation[0] != '\0' && sprite->animation && strcmp(sprite->animation->name, stored->animation) != 0) {
+        cf_sprite_play(sprite, stored->animation);
+    }
+
+    sprite->frame_index           = stored->frame_index;
+    sprite->loop_count            = stored->loop_count;
+    sprite->t                     = stored->t;
+    sprite->opacity               = stored->opacity;
+    sprite->play_speed_multiplier = stored->play_speed_multiplier;
+    sprite->scale                 = stored->scale;
+    sprite->offset                = stored->offset;
+    sprite->paused                = stored->paused;
+    sprite->loop                  = stored->loop;
+}
+
+static void serialize_sprite(GameState* state, SnapshotStream* stream, CF_Sprite* sprite) {
+    SnapshotSprite stored = {0};
+    if (stream->mode == SNAPSHOT_MODE_SAVE) { stored = capture_sprite(state, stream, sprite); }
+
+    serialize_control(stream, &stored, sizeof(stored));
+    if (!stream->ok || stream->mode == SNAPSHOT_MODE_MEASURE || stream->mode == SNAPSHOT_MODE_SAVE) { return; }
+
+    stored.animation[SNAPSHOT_ANIMATION_NAME_SIZE - 1] = '\0';
+    if (stored.id < SNAPSHOT_SPRITE_NONE || stored.id >= SNAPSHOT_SPRITE_COUNT) {
+        stream->ok = false;
+        return;
+    }
+    if (stream->mode == SNAPSHOT_MODE_LOAD) { restore_sprite(state, sprite, &stored); }
+}
+
+static void serialize_record(GameState* state, SnapshotStream* stream, uint8_t* record, const RecordLayout* layout) {
+    size_t at = 0;
+    for (size_t i = 0; i < layout->sprite_count; ++i) {
+        const size_t offset = layout->sprite_offsets[i];
+        serialize_bytes(stream, record + at, offset - at);
+        serialize_sprite(state, stream, (CF_Sprite*)(record + offset));
+        at = offset + sizeof(CF_Sprite);
+    }
+    serialize_bytes(stream, record + at, layout->size - at);
+}
+
+static size_t get_record_stream_size(const RecordLayout* layout) {
+    return layout->size - layout->sprite_count * sizeof(CF_Sprite) + layout->sprite_count * sizeof(SnapshotSprite);
+}
+
+static void serialize_entity_array(
+    GameState* state, SnapshotStream* stream, uint8_t* items, size_t* count, size_t capacity, const RecordLayout* layout
+) {
+    uint32_t stored_count = (uint32_t)(stream->is_worst_case ? capacity : *count);
+    serialize_control(stream, &stored_count, sizeof(stored_count));
+    if (stored_count > capacity) { stream->ok = false; }
+    if (!stream->ok) { return; }
+
+    // Measured every tick while rewinding is recorded, records all have the same size
+    if (stream->mode == SNAPSHOT_MODE_MEASURE) {
+        stream->size += stored_count * get_record_stream_size(layout);
+        return;
+    }
+
+    for (uint32_t i = 0; i < stored_count; ++i) { serialize_record(state, stream, items + i * layout->size, layout); }
+    if (stream->mode == SNAPSHOT_MODE_LOAD) { *count = stored_count; }
+}
+
+#define SERIALIZE_ENTITY_ARRAY(state, stream, field, layout) \
+    CF_ASSERT((layout)->size == sizeof(*(state)->field));    \
+    serialize_entity_array(                                  \
+        (state),                                             \
+        (stream),                                            \
+        (uint8_t*)(state)->field,                            \
+        &(state)->field##_count,                             \
+        (state)->field##_capacity,                           \
+        (layout)                                             \
+    )
+
+static void serialize_game_state(GameState* state, SnapshotStream* stream) {
+    serialize_value(stream, state->rnd);
+    serialize_value(stream, state->score);
+    serialize_value(stream, state->lives);
+    serialize_value(stream, state->is_game_over);
+    serialize_value(stream, state->wave);
+    serialize_value(stream, state->spawner);
+    serialize_value(stream, state->screenshake);
+    serialize_value(stream, state->star_field);
+    serialize_value(stream, state->background_scroll.y_offset);
+
+    serialize_entity_array(
+        state, stream, (uint8_t*)state->players, &state->players_count, MAX_PLAYERS, &s_player_layout
+    );
+    SERIALIZE_ENTITY_ARRAY(state, stream, player_bullets, &s_player_bullet_layout);
+    SERIALIZE_ENTITY_ARRAY(state, stream, enemies, &s_enemy_layout);
+    SERIALIZE_ENTITY_ARRAY(state, stream, enemy_bullets, &s_enemy_bullet_layout);
+    SERIALIZE_ENTITY_ARRAY(state, stream, explosions, &s_explosion_layout);
+    SERIALIZE_ENTITY_ARRAY(state, stream, hit_particles, &s_hit_particle_layout);
+    SERIALIZE_ENTITY_ARRAY(state, stream, explosion_particles, &s_explosion_particle_layout);
+    SERIALIZE_ENTITY_ARRAY(state, stream, floating_scores, &s_floating_score_layout);
+}
+
+size_t measure_snapshot(GameState* state) {
+    SnapshotStream measure = {.mode = SNAPSHOT_MODE_MEASURE, .ok = true};
+    serialize_game_state(state, &measure);
+    return measure.size;
+}
+
+size_t measure_snapshot_capacity(GameState* state) {
+    SnapshotStream measure = {.mode = SNAPSHOT_MODE_MEASURE, .ok = true, .is_worst_case = true};
+    serialize_game_state(state, &measure);
+    return measure.size;
+}
+
+void write_snapshot(GameState* state, uint8_t* data, size_t size) {
+    SnapshotStream stream = {.mode = SNAPSHOT_MODE_SAVE, .data = data, .capacity = size, .ok = true};
+    serialize_game_state(state, &stream);
+    CF_ASSERT(stream.ok && stream.size == size);
+}
+
+bool read_snapshot(GameState* state, const uint8_t* data, size_t size) {
+    // Neither mode writes to the data
+    SnapshotStream verify = {.mode = SNAPSHOT_MODE_VERIFY, .data = (uint8_t*)data, .capacity = size, .ok = true};
+    serialize_game_state(state, &verify);
+    if (!verify.ok || verify.size != size) { return false; }
+
+    SnapshotStream stream = {.mode = SNAPSHOT_MODE_LOAD, .data = (uint8_t*)data, .capacity = size, .ok = true};
+    serialize_game_state(state, &stream);
+    CF_ASSERT(stream.ok);
+
+    // The HUD only redraws when a value it shows changes
+    invalidate_hud(state);
+    return true;
+}
+
+bool save_snapshot(GameState* state, const char* path) {
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+
+    const size_t body_size       = measure_snapshot(state);
+    const size_t size            = sizeof(SnapshotHeader) + body_size;
+    uint8_t*     data            = arena_alloc(&state->scratch_arena, size);
+    if (data == nullptr) {
+        APP_ERROR("Snapshot needs %zu bytes, more than the scratch arena has left", size);
+        return false;
+    }
+
+    const SnapshotHeader header = {
+        .magic          = SNAPSHOT_MAGIC,
+        .version        = SNAPSHOT_VERSION,
+        .layout_version = get_state_schema()->version,
+        .size           = (uint32_t)body_size,
+    };
+    memcpy(data, &header, sizeof(header));
+    write_snapshot(state, data + sizeof(header), body_size);
+
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        APP_ERROR("Could not open snapshot %s for writing", path);
+        return false;
+    }
+
+    // The whole snapshot is already in one buffer, skip the stdio copy and write it in one call
+    setvbuf(file, nullptr, _IONBF, 0);
+    const bool is_written = fwrite(data, size, 1, file) == 1;
+    if (fclose(file) != 0 || !is_written) {
+        APP_ERROR("Could not write snapshot %s", path);
+        return false;
+    }
+
+    state->snapshot.save_ms = cf_stopwatch_milliseconds(stopwatch);
+    state->snapshot.bytes   = size;
+    APP_INFO("Saved snapshot %s, %zu KiB in %.2f ms", path, size / CF_KB, state->snapshot.save_ms);
+    return true;
+}
+
+bool load_snapshot(GameState* state, const char* path) {
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+
+    FILE* file                   = fopen(path, "rb");
+    if (file == nullptr) {
+        APP_WARN("No snapshot at %s", path);
+        return false;
+    }
+
+    SnapshotHeader header = {0};
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != SNAPSHOT_MAGIC) {
+        APP_ERROR("%s is not a snapshot", path);
+        fclose(file);
+        return false;
+    }
+
+    const uint32_t layout_version = get_state_schema()->version;
+    if (header.version != SNAPSHOT_VERSION || header.layout_version != layout_version) {
+        APP_WARN(
+            "Snapshot %s was saved by another build (format %u, layout %08x), this one expects format %u, layout %08x",
+            path,
+            header.version,
+            header.layout_version,
+            SNAPSHOT_VERSION,
+            layout_version
+        );
+        fclose(file);
+        return false;
+    }
+
+    uint8_t*   data    = arena_alloc(&state->scratch_arena, header.size);
+    const bool is_read = data != nullptr && fread(data, header.size, 1, file) == 1;
+    fclose(file);
+    if (!is_read) {
+        APP_ERROR("Could not read the %u bytes of snapshot %s", header.size, path);
+        return false;
+    }
+
+    if (!read_snapshot(state, data, header.size)) {
+        APP_ERROR("Snapshot %s is corrupt, keeping the current state", path);
+        return false;
+    }
+
+    state->snapshot.load_ms = cf_stopwatch_milliseconds(stopwatch);
+    state->snapshot.bytes   = sizeof(header) + header.size;
+    APP_INFO("Loaded snapshot %s in %.2f ms", path, state->snapshot.load_ms);
+    return true;
+}
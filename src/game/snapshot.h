@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct GameState GameState;
+
+#define SNAPSHOT_PATH "snapshot.bin"
+
+constexpr uint32_t SNAPSHOT_MAGIC   = 0x504E5352;  // "RSNP"
+constexpr uint32_t SNAPSHOT_VERSION = 3;           // Bump when the order or encoding of the sections changes
+
+/*
+ * Snapshot Header
+ *
+ * Entity records are stored with the struct layout of the library that saved them, so a snapshot only loads into a
+ * build with the same StateSchema version. Sprites are stored as ids and rebuilt from the loaded assets.
+ */
+typedef struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t layout_version;  // StateSchema.version of the library that saved the snapshot
+    uint32_t size;            // Bytes following the header
+} SnapshotHeader;
+
+typedef struct SnapshotStats {
+    double save_ms;
+    double load_ms;
+    size_t bytes;
+} SnapshotStats;
+
+// In-memory snapshots without the header, only valid within the build that wrote them
+size_t measure_snapshot(GameState* state);
+size_t measure_snapshot_capacity(GameState* state);  // Every entity array full, for buffers reused across ticks
+void   write_snapshot(GameState* state, uint8_t* data, size_t size);
+bool   read_snapshot(GameState* state, const uint8_t* data, size_t size);  // False leaves the state untouched
+
+bool save_snapshot(GameState* state, const char* path);
+bool load_snapshot(GameState* state, const char* path);
@@ -0,0 +1,170 @@
+#include "soak.h"
+
+#include <cute_time.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../engine/game_state.h"
+#include "../engine/log.h"
+#include "../engine/platform.h"
+#include "bot.h"
+
+static const char* get_soak_pool_name(SoakPool pool) {
+    switch (pool) {
+        case SOAK_POOL_PLAYER_BULLETS:      return "player bullets";
+        case SOAK_POOL_ENEMIES:             return "enemies";
+        case SOAK_POOL_ENEMY_BULLETS:       return "enemy bullets";
+        case SOAK_POOL_EXPLOSIONS:          return "explosions";
+        case SOAK_POOL_HIT_PARTICLES:       return "hit particles";
+        case SOAK_POOL_EXPLOSION_PARTICLES: return "explosion particles";
+        case SOAK_POOL_FLOATING_SCORES:     return "floating scores";
+        case SOAK_POOL_COUNT:               break;
+    }
+    return "unknown";
+}
+
+static size_t get_soak_pool_count(GameState* state, SoakPool pool) {
+    switch (pool) {
+        case SOAK_POOL_PLAYER_BULLETS:      return state->player_bullets_count;
+        case SOAK_POOL_ENEMIES:             return state->enemies_count;
+        case SOAK_POOL_ENEMY_BULLETS:       return state->enemy_bullets_count;
+        case SOAK_POOL_EXPLOSIONS:          return state->explosions_count;
+        case SOAK_POOL_HIT_PARTICLES:       return state->hit_particles_count;
+        case SOAK_POOL_EXPLOSION_PARTICLES: return state->explosion_particles_count;
+        case SOAK_POOL_FLOATING_SCORES:     return state->floating_scores_count;
+        case SOAK_POOL_COUNT:               break;
+    }
+    return 0;
+}
+
+static size_t get_soak_pool_capacity(GameState* state, SoakPool pool) {
+    switch (pool) {
+        case SOAK_POOL_PLAYER_BULLETS:      return state->player_bullets_capacity;
+        case SOAK_POOL_ENEMIES:             return state->enemies_capacity;
+        case SOAK_POOL_ENEMY_BULLETS:       return state->enemy_bullets_capacity;
+        case SOAK_POOL_EXPLOSIONS:          return state->explosions_capacity;
+        case SOAK_POOL_HIT_PARTICLES:       return state->hit_particles_capacity;
+        case SOAK_POOL_EXPLOSION_PARTICLES: return state->explosion_particles_capacity;
+        case SOAK_POOL_FLOATING_SCORES:     return state->floating_scores_capacity;
+        case SOAK_POOL_COUNT:               break;
+    }
+    return 0;
+}
+
+static void log_soak_progress(const SoakTest* soak) {
+    const double game_minutes = (double)soak->ticks * CF_DELTA_TIME / 60.0;
+    APP_INFO(
+        "Soak: %.0f minutes of game time in %.1f s, %d runs, best wave %d",
+        game_minutes,
+        soak->total_ms / 1000.0,
+        soak->runs,
+        soak->best_wave
+    );
+}
+
+void start_soak_test(SoakTest* soak) {
+    *soak = (SoakTest){.is_active = true};
+    APP_INFO("Soak test started, a bot plays until the platform stops the game");
+}
+
+void update_soak_test(GameState* state, SoakTest* soak, SimulateTickFunction simulate_tick) {
+    for (size_t i = 0; i < state->players_count; ++i) {
+        update_bot_input(state, &state->players[i], &state->players[i].input);
+    }
+
+    const int          wave      = state->wave.current_wave;
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+    simulate_tick(state);
+    const double tick_ms = cf_stopwatch_milliseconds(stopwatch);
+
+    SoakWaveCost* cost   = &soak->waves[wave < SOAK_MAX_WAVES ? wave : SOAK_MAX_WAVES - 1];
+    cost->ticks++;
+    cost->total_ms += tick_ms;
+    if (tick_ms > cost->peak_ms) { cost->peak_ms = tick_ms; }
+
+    soak->ticks++;
+    soak->total_ms += tick_ms;
+    if (state->wave.current_wave > soak->best_wave) { soak->best_wave = state->wave.current_wave; }
+
+    if (state->is_game_over && !soak->was_game_over) {
+        soak->runs++;
+        soak->last_wave = state->wave.current_wave;
+    }
+    soak->was_game_over = state->is_game_over;
+
+    if (soak->ticks % SOAK_REPORT_INTERVAL_TICKS == 0) { log_soak_progress(soak); }
+}
+
+// After game_render(), the gfx stats still hold the frame it recorded
+void record_soak_render(GameState* state, SoakTest* soak, double render_ms) {
+    soak->frames++;
+    soak->render_ms += render_ms;
+    if (render_ms > soak->render_peak_ms) { soak->render_peak_ms = render_ms; }
+    soak->draw_commands += state->gfx.frame.commands;
+    soak->draws_dropped += state->gfx.frame.dropped;
+}
+
+void report_soak_test(GameState* state, const SoakTest* soak) {
+    log_soak_progress(soak);
+    APP_INFO(
+        "Soak: last finished run reached wave %d, the current one is on wave %d",
+        soak->last_wave,
+        state->wave.current_wave
+    );
+
+    for (int wave = 0; wave < SOAK_MAX_WAVES; ++wave) {
+        const SoakWaveCost* cost = &soak->waves[wave];
+        if (cost->ticks == 0) { continue; }
+        APP_INFO(
+            "Soak: wave %d%s: %llu ticks, %.3f ms average, %.3f ms peak",
+            wave,
+            wave == SOAK_MAX_WAVES - 1 ? " and later" : "",
+            (unsigned long long)cost->ticks,
+            cost->total_ms / (double)cost->ticks,
+            cost->peak_ms
+        );
+    }
+
+    for (int pool = 0; pool < SOAK_POOL_COUNT; ++pool) {
+        const size_t capacity = get_soak_pool_capacity(state, (SoakPool)pool);
+        APP_INFO(
+            "Soak: %s peaked at %zu/%zu, %zu spawns rejected",
+            get_soak_pool_name((SoakPool)pool),
+            soak->pool_peaks[pool],
+            capacity,
+            soak->pool_rejected[pool]
+        );
+    }
+
+    if (soak->frames > 0) {
+        APP_INFO(
+            "Soak: %llu frames recorded, %.3f ms average render, %.3f ms peak, %.0f draw commands a frame, %zu dropped",
+            (unsigned long long)soak->frames,
+            soak->render_ms / (double)soak->frames,
+            soak->render_peak_ms,
+            (double)soak->draw_commands / (double)soak->frames,
+            soak->draws_dropped
+        );
+    }
+
+    // Gameplay should not touch the heap once warmed up, anything here over hours is a leak
+    const AllocationCounts* allocations = &state->platform->allocations->total;
+    APP_INFO(
+        "Soak: %zu heap allocations under update, %zu frees",
+        allocations->count[ALLOCATION_TAG_UPDATE],
+        allocations->frees
+    );
+}
+
+size_t claim_pool_slots(GameState* state, SoakPool pool, size_t requested) {
+    const size_t count     = get_soak_pool_count(state, pool);
+    const size_t capacity  = get_soak_pool_capacity(state, pool);
+    const size_t remaining = capacity > count ? capacity - count : 0;
+    const size_t claimed   = requested < remaining ? requested : remaining;
+
+    // Recorded outside soak tests too, start_soak_test() clears them
+    auto soak = &state->soak;
+    soak->pool_rejected[pool] += requested - claimed;
+    if (count + claimed > soak->pool_peaks[pool]) { soak->pool_peaks[pool] = count + claimed; }
+    return claimed;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rollback.h"
+
+typedef struct GameState GameState;
+
+constexpr int SOAK_MAX_WAVES             = 32;            // Later waves are counted in the last entry
+constexpr int SOAK_REPORT_INTERVAL_TICKS = 60 * 60 * 10;  // Progress line every 10 minutes of game time
+
+typedef enum SoakPool {
+    SOAK_POOL_PLAYER_BULLETS,
+    SOAK_POOL_ENEMIES,
+    SOAK_POOL_ENEMY_BULLETS,
+    SOAK_POOL_EXPLOSIONS,
+    SOAK_POOL_HIT_PARTICLES,
+    SOAK_POOL_EXPLOSION_PARTICLES,
+    SOAK_POOL_FLOATING_SCORES,
+    SOAK_POOL_COUNT,
+} SoakPool;
+
+typedef struct SoakWaveCost {
+    uint64_t ticks;
+    double   total_ms;
+    double   peak_ms;
+} SoakWaveCost;
+
+/*
+ * Soak Test
+ *
+ * The bot in bot.h plays every player, one tick after another as fast as the machine runs them, with nothing
+ * rendered. Game overs start another run. Hours of game time pass in minutes, long enough for slow leaks, pools
+ * filling up and the escalating late waves to show in the report.
+ */
+typedef struct SoakTest {
+    bool         is_active;
+    bool         was_game_over;
+    uint64_t     ticks;
+    double       total_ms;  // Simulation only
+    int          runs;      // Finished by a game over
+    int          best_wave;
+    int          last_wave;  // Reached by the last finished run
+    SoakWaveCost waves[SOAK_MAX_WAVES];
+    size_t       pool_peaks[SOAK_POOL_COUNT];     // Highest count any spawn left behind, before cleanup ran
+    size_t       pool_rejected[SOAK_POOL_COUNT];  // Spawns turned away by a full pool
+    uint64_t     frames;                          // Rendered, only with draws recorded
+    double       render_ms;
+    double       render_peak_ms;
+    size_t       draw_commands;
+    size_t       draws_dropped;
+} SoakTest;
+
+void start_soak_test(SoakTest* soak);
+void update_soak_test(GameState* state, SoakTest* soak, SimulateTickFunction simulate_tick);
+void record_soak_render(GameState* state, SoakTest* soak, double render_ms);
+void report_soak_test(GameState* state, const SoakTest* soak);
+
+// Every spawn_*() asks for its slots here, gets as many as the pool has left and records the peak and the rest
+size_t claim_pool_slots(GameState* state, SoakPool pool, size_t requested);
@@ -0,0 +1,201 @@
+#include "spawner.h"
+
+#include <cute_math.h>
+#include <cute_rnd.h>
+#include <cute_time.h>
+#include <stddef.h>
+
+#include "../engine/common.h"
+#include "../engine/game_state.h"
+#include "enemy.h"
+#include "formation.h"
+#include "sim_math.h"
+
+typedef enum SpawnStepKind {
+    SPAWN_STEP_ENEMY,         // One enemy at x
+    SPAWN_STEP_RANDOM_ENEMY,  // One enemy anywhere within [-x, x]
+    SPAWN_STEP_FORMATION,     // A formation centered on x
+    SPAWN_STEP_WAIT,
+} SpawnStepKind;
+
+typedef struct SpawnStep {
+    SpawnStepKind    kind;
+    EnemyType        enemy_type;
+    const Formation* formation;
+    float            x;
+    float            seconds;  // SPAWN_STEP_WAIT only
+} SpawnStep;
+
+typedef struct WaveScript {
+    const SpawnStep* steps;
+    size_t           steps_count;
+    float            shoot_chance;
+} WaveScript;
+
+#define SPAWN_ENEMY(type, x_pos)            {SPAWN_STEP_ENEMY, (type), nullptr, (x_pos)}
+#define SPAWN_RANDOM_ENEMY(type, range)     {SPAWN_STEP_RANDOM_ENEMY, (type), nullptr, (range)}
+#define SPAWN_FORMATION(shape, type, x_pos) {SPAWN_STEP_FORMATION, (type), &(shape), (x_pos)}
+#define SPAWN_WAIT(duration)                {.kind = SPAWN_STEP_WAIT, .seconds = (duration)}
+
+// Wave 0: 3 single ALAN enemies, no shooting
+static const SpawnStep wave_0_steps[] = {
+    SPAWN_ENEMY(ENEMY_TYPE_ALAN, -20),
+    SPAWN_WAIT(1.0f),
+    SPAWN_ENEMY(ENEMY_TYPE_ALAN, 0),
+    SPAWN_WAIT(1.0f),
+    SPAWN_ENEMY(ENEMY_TYPE_ALAN, 20),
+    SPAWN_WAIT(2.0f),
+};
+
+// Wave 1: 5 single ALAN enemies, still no shooting
+static const SpawnStep wave_1_steps[] = {
+    SPAWN_RANDOM_ENEMY(ENEMY_TYPE_ALAN, 60),
+    SPAWN_WAIT(0.8f),
+    SPAWN_RANDOM_ENEMY(ENEMY_TYPE_ALAN, 60),
+    SPAWN_WAIT(0.8f),
+    SPAWN_RANDOM_ENEMY(ENEMY_TYPE_ALAN, 60),
+    SPAWN_WAIT(0.8f),
+    SPAWN_RANDOM_ENEMY(ENEMY_TYPE_ALAN, 60),
+    SPAWN_WAIT(0.8f),
+    SPAWN_RANDOM_ENEMY(ENEMY_TYPE_ALAN, 60),
+    SPAWN_WAIT(0.8f + 1.5f),
+};
+
+// Wave 2: BON_BON line formation
+static const SpawnStep wave_2_steps[] = {
+    SPAWN_FORMATION(FORMATION_LINE_HORIZONTAL, ENEMY_TYPE_BON_BON, 0),
+    SPAWN_WAIT(3.0f),
+};
+
+// Wave 3: Mixed enemy types
+static const SpawnStep wave_3_steps[] = {
+    SPAWN_FORMATION(FORMATION_LINE_VERTICAL, ENEMY_TYPE_ALAN, -30),
+    SPAWN_WAIT(1.0f),
+    SPAWN_FORMATION(FORMATION_LINE_VERTICAL, ENEMY_TYPE_BON_BON, 30),
+    SPAWN_WAIT(2.5f),
+};
+
+// Wave 4: LIPS diamond formation
+static const SpawnStep wave_4_steps[] = {
+    SPAWN_FORMATION(FORMATION_DIAMOND, ENEMY_TYPE_LIPS, 0),
+    SPAWN_WAIT(4.0f),
+};
+
+// Wave 5: Wave formation with BON_BON
+static const SpawnStep wave_5_steps[] = {
+    SPAWN_FORMATION(FORMATION_WAVE, ENEMY_TYPE_BON_BON, 0),
+    SPAWN_WAIT(3.5f),
+};
+
+// Wave 6: Arrow formation with LIPS
+static const SpawnStep wave_6_steps[] = {
+    SPAWN_FORMATION(FORMATION_ARROW_DOWN, ENEMY_TYPE_LIPS, 0),
+    SPAWN_WAIT(4.0f),
+};
+
+// Wave 7+: Multiple formations, repeated with a rising shoot chance
+static const SpawnStep endless_wave_steps[] = {
+    SPAWN_FORMATION(FORMATION_V_SHAPE, ENEMY_TYPE_BON_BON, 0),
+    SPAWN_WAIT(2.0f),
+    SPAWN_FORMATION(FORMATION_DIAMOND, ENEMY_TYPE_LIPS, 0),
+    SPAWN_WAIT(2.5f),
+    SPAWN_FORMATION(FORMATION_WAVE, ENEMY_TYPE_ALAN, 0),
+    SPAWN_WAIT(1.5f),
+};
+
+static const WaveScript s_wave_scripts[] = {
+    {wave_0_steps, countof(wave_0_steps), 0.0f},
+    {wave_1_steps, countof(wave_1_steps), 0.0f},
+    {wave_2_steps, countof(wave_2_steps), 0.1f},
+    {wave_3_steps, countof(wave_3_steps), 0.2f},
+    {wave_4_steps, countof(wave_4_steps), 0.3f},
+    {wave_5_steps, countof(wave_5_steps), 0.4f},
+    {wave_6_steps, countof(wave_6_steps), 0.5f},
+};
+
+static const WaveScript s_endless_wave_script = {endless_wave_steps, countof(endless_wave_steps), 0.0f};
+
+static const WaveScript* get_wave_script(int wave) {
+    return (size_t)wave < countof(s_wave_scripts) ? &s_wave_scripts[wave] : &s_endless_wave_script;
+}
+
+static float get_wave_shoot_chance(int wave) {
+    if ((size_t)wave < countof(s_wave_scripts)) { return s_wave_scripts[wave].shoot_chance; }
+
+    // Capped at 70%
+    return cf_min(0.7f, 0.3f + (wave - 6) * 0.05f);
+}
+
+static void spawn_single_enemy(GameState* state, CF_V2 position, EnemyType type, float shoot_chance) {
+    auto enemy = make_enemy_of_type(state, position, type);
+    set_enemy_shoot_chance(&enemy, shoot_chance);
+    spawn_enemy(state, enemy);
+}
+
+static void run_spawn_step(GameState* state, Spawner* spawner, const SpawnStep* step, float shoot_chance) {
+    const float canvas_top = state->canvas_size.y / 2.0f;
+
+    switch (step->kind) {
+        case SPAWN_STEP_ENEMY:
+            spawn_single_enemy(state, cf_v2(step->x, canvas_top), step->enemy_type, shoot_chance);
+            break;
+        case SPAWN_STEP_RANDOM_ENEMY: {
+            const float x = sim_rnd_range(&state->rnd.gameplay, -step->x, step->x);
+            spawn_single_enemy(state, cf_v2(x, canvas_top), step->enemy_type, shoot_chance);
+            break;
+        }
+        case SPAWN_STEP_FORMATION:
+            formation_spawn_with_shoot_chance(
+                state, step->formation, cf_v2(step->x, canvas_top), step->enemy_type, shoot_chance
+            );
+            break;
+        case SPAWN_STEP_WAIT: spawner->timer = step->seconds; break;
+    }
+}
+
+static void run_wave_script(GameState* state, Spawner* spawner) {
+    const int         wave         = state->wave.current_wave;
+    const WaveScript* script       = get_wave_script(wave);
+    const float       shoot_chance = get_wave_shoot_chance(wave);
+
+    sim_count_down(&spawner->timer);
+    while (spawner->timer <= 0.0f && (size_t)spawner->step < script->steps_count) {
+        run_spawn_step(state, spawner, &script->steps[spawner->step++], shoot_chance);
+    }
+
+    if (spawner->timer <= 0.0f) { spawner->phase = SPAWNER_PHASE_CLEARING; }
+}
+
+Spawner make_spawner(void) { return (Spawner){.phase = SPAWNER_PHASE_ANNOUNCING}; }
+
+void update_spawner(GameState* state, Spawner* spawner) {
+    switch (spawner->phase) {
+        case SPAWNER_PHASE_ANNOUNCING:
+            if (state->wave.is_announcing) { return; }
+
+            spawner->phase = SPAWNER_PHASE_SPAWNING;
+            spawner->step  = 0;
+            spawner->timer = 0.0f;
+            run_wave_script(state, spawner);
+            break;
+
+        case SPAWNER_PHASE_SPAWNING: run_wave_script(state, spawner); break;
+
+        case SPAWNER_PHASE_CLEARING:
+            // Wait for all enemies to be cleared before starting next wave
+            if (state->enemies_count > 0) { return; }
+
+            state->wave.current_wave++;
+            state->wave.announcement_timer = 0.0f;
+            state->wave.is_announcing      = true;
+
+            spawner->phase                   = SPAWNER_PHASE_INTERMISSION;
+            spawner->timer                   = SPAWNER_INTERMISSION_DURATION;
+            break;
+
+        case SPAWNER_PHASE_INTERMISSION:
+            sim_count_down(&spawner->timer);
+            if (spawner->timer <= 0.0f) { spawner->phase = SPAWNER_PHASE_ANNOUNCING; }
+            break;
+    }
+}
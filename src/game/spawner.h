@@ -0,0 +1,27 @@
+#pragma once
+
+typedef struct GameState GameState;
+
+constexpr float SPAWNER_INTERMISSION_DURATION = 3.0f;  // Delay between a cleared wave and the next announcement
+
+typedef enum SpawnerPhase {
+    SPAWNER_PHASE_ANNOUNCING,    // Waiting for the wave banner to finish
+    SPAWNER_PHASE_SPAWNING,      // Running the steps of the current wave's script
+    SPAWNER_PHASE_CLEARING,      // Waiting for the last enemy of the wave to leave
+    SPAWNER_PHASE_INTERMISSION,  // Delay before the next wave is announced
+} SpawnerPhase;
+
+/*
+ * Spawner
+ *
+ * Progress through the wave scripts in spawner.c. Plain data, so a hot reload or a snapshot resumes the current wave
+ * exactly where it was instead of restarting it.
+ */
+typedef struct Spawner {
+    SpawnerPhase phase;
+    int          step;   // Next step of the current wave's script
+    float        timer;  // Seconds left before the next step, or before the announcement during the intermission
+} Spawner;
+
+Spawner make_spawner(void);
+void    update_spawner(GameState* state, Spawner* spawner);
@@ -0,0 +1,84 @@
+/**
+ * Parallax star field system
+ * Creates depth illusion with 4 layers of scrolling stars
+ * that respond to player horizontal movement
+ */
+
+#include "star_field.h"
+
+#include <cute_color.h>
+#include <cute_math.h>
+#include <cute_time.h>
+#include <math.h>
+#include <stdint.h>
+
+#include "../engine/game_state.h"
+#include "component.h"
+#include "render_queue.h"
+
+// Star field constants
+constexpr float    PARALLAX_STRENGTH                    = 0.05f;
+constexpr float    WRAP_MARGIN                          = 10.0f;
+static const float LAYER_SPEEDS[STAR_FIELD_LAYER_COUNT] = {8.0f, 12.0f, 16.0f, 24.0f};
+static const float LAYER_SIZES[STAR_FIELD_LAYER_COUNT]  = {1.0f, 1.5f, 2.0f, 2.5f};
+
+// Integer hash with good avalanche (lowbias32)
+static uint32_t hash_u32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+static uint32_t hash_star(uint32_t seed, uint32_t layer, uint32_t index, uint32_t salt) {
+    return hash_u32(seed ^ hash_u32(layer * 0x9e3779b9u ^ hash_u32(index ^ hash_u32(salt))));
+}
+
+// Maps a hash to [0, 1)
+static float hash_to_unit(uint32_t hash) { return (float)(hash >> 8) * (1.0f / 16777216.0f); }
+
+StarField make_star_field(uint32_t seed) {
+    return (StarField){
+        .seed            = seed,
+        .time            = 0.0,
+        .stars_per_layer = STAR_FIELD_DEFAULT_STARS_PER_LAYER,
+    };
+}
+
+void update_star_field(GameState* state) { state->star_field.time += CF_DELTA_TIME; }
+
+void render_star_field(GameState* state) {
+    const StarField* field         = &state->star_field;
+    const float      canvas_width  = state->canvas_size.x;
+    const float      canvas_height = state->canvas_size.y;
+    const float      wrap_top      = canvas_height / 2 + WRAP_MARGIN;
+    const float      wrap_height   = canvas_height + WRAP_MARGIN * 2;
+    const float      player_x      = state->players[0].position.x;  // Parallax follows the first player
+    const int        star_count    = field->stars_per_layer < STAR_FIELD_MAX_STARS_PER_LAYER
+                                         ? field->stars_per_layer
+                                         : STAR_FIELD_MAX_STARS_PER_LAYER;
+
+    // Stars are plain filled quads with no per-star transform, so each layer batches into one submission
+    for (uint32_t layer = 0; layer < STAR_FIELD_LAYER_COUNT; ++layer) {
+        const float  parallax_scale = (float)(layer + 1) / STAR_FIELD_LAYER_COUNT;
+        const float  parallax       = -player_x * parallax_scale * PARALLAX_STRENGTH;
+        const double travelled      = LAYER_SPEEDS[layer] * field->time;
+        const CF_V2  half_extents   = cf_v2(LAYER_SIZES[layer] * 0.5f, LAYER_SIZES[layer] * 0.5f);
+
+        for (int i = 0; i < star_count; ++i) {
+            // Distance fallen since the top of the wrap region, and how many times the star wrapped
+            const float  phase    = hash_to_unit(hash_star(field->seed, layer, (uint32_t)i, 0));
+            const double distance = phase * wrap_height + travelled;
+            const double cycle    = floor(distance / wrap_height);
+            const float  y        = wrap_top - (float)(distance - cycle * wrap_height);
+
+            // Every wrap lands the star on a new column, like re-rolling x on wrap
+            const uint32_t column = hash_star(field->seed, layer, (uint32_t)i, (uint32_t)cycle + 1);
+            const float    x      = (hash_to_unit(column) - 0.5f) * canvas_width + parallax;
+
+            render_queue_push_quad(state, cf_v2(x, y), half_extents, cf_color_white(), Z_PARALLAX);
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct GameState GameState;
+
+constexpr int STAR_FIELD_LAYER_COUNT             = 4;
+constexpr int STAR_FIELD_MAX_STARS_PER_LAYER     = 1280;  // 5120 stars across all layers
+constexpr int STAR_FIELD_DEFAULT_STARS_PER_LAYER = 4;
+
+/*
+ * Star Field
+ *
+ * Every star position is a closed-form function of (seed, layer, index, time, player_x), so there is no per-star
+ * state to store or update. Only the clock advances each tick.
+ */
+typedef struct StarField {
+    uint32_t seed;
+    double   time;             // Seconds the field has been scrolling
+    int      stars_per_layer;  // Density, up to STAR_FIELD_MAX_STARS_PER_LAYER
+} StarField;
+
+StarField make_star_field(uint32_t seed);
+void      update_star_field(GameState* state);
+void      render_star_field(GameState* state);
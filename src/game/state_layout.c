@@ -0,0 +1,618 @@
+#define LOG_CATEGORY LOG_CATEGORY_STATE
+
+#include "state_layout.h"
+
+#include <assert.h>
+#include <cute_app.h>
+#include <cute_audio.h>
+#include <cute_c_runtime.h>
+#include <cute_graphics.h>
+#include <cute_math.h>
+#include <cute_multithreading.h>
+#include <cute_rnd.h>
+#include <cute_sprite.h>
+#include <cute_time.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../engine/arena.h"
+#include "../engine/common.h"
+#include "../engine/game_state.h"
+#include "../engine/log.h"
+#include "../engine/platform.h"
+#include "../engine/state_schema.h"
+#include "game.h"
+
+// Order of add_schema_struct() calls in get_state_schema()
+typedef enum StateLayoutStruct {
+    STATE_LAYOUT_GAME_STATE,  // Root
+    STATE_LAYOUT_PLAYER,
+    STATE_LAYOUT_PLAYER_BULLET,
+    STATE_LAYOUT_ENEMY,
+    STATE_LAYOUT_ENEMY_BULLET,
+    STATE_LAYOUT_EXPLOSION,
+    STATE_LAYOUT_HIT_PARTICLE,
+    STATE_LAYOUT_EXPLOSION_PARTICLE,
+    STATE_LAYOUT_FLOATING_SCORE,
+    STATE_LAYOUT_INPUT,
+    STATE_LAYOUT_COLLIDER,
+    STATE_LAYOUT_WEAPON,
+    STATE_LAYOUT_HEALTH,
+    STATE_LAYOUT_ARENA,
+    STATE_LAYOUT_ARENA_STATS,
+    STATE_LAYOUT_RND_STREAMS,
+    STATE_LAYOUT_BACKGROUND_SCROLL,
+    STATE_LAYOUT_STAR_FIELD,
+    STATE_LAYOUT_GFX,
+    STATE_LAYOUT_GFX_STATS,
+    STATE_LAYOUT_SCREENSHAKE,
+    STATE_LAYOUT_HUD,
+    STATE_LAYOUT_RENDER_QUEUE,
+    STATE_LAYOUT_ASSET_LOADER,
+    STATE_LAYOUT_ASSET_JOB,
+    STATE_LAYOUT_ASSET_HANDLE,
+    STATE_LAYOUT_VOICE_MANAGER,
+    STATE_LAYOUT_VOICE,
+    STATE_LAYOUT_AUDIO_STATS,
+    STATE_LAYOUT_SPAWNER,
+    STATE_LAYOUT_ROLLBACK_SESSION,
+    STATE_LAYOUT_ROLLBACK_TICK,
+    STATE_LAYOUT_ROLLBACK_STATS,
+    STATE_LAYOUT_LOOPBACK_PEER,
+    STATE_LAYOUT_INPUT_PACKET,
+    STATE_LAYOUT_SOAK_TEST,
+    STATE_LAYOUT_SOAK_WAVE_COST,
+    STATE_LAYOUT_SNAPSHOT_STATS,
+    STATE_LAYOUT_REWIND_BUFFER,
+    STATE_LAYOUT_REWIND_STATS,
+    STATE_LAYOUT_COUNT,
+} StateLayoutStruct;
+
+static_assert(MAX_PLAYERS == 2, "s_game_state_fields lists each player");
+
+// Subsystems holding GPU, thread or arena resources are required: zeroing them would leak or crash
+static const FieldSchema s_game_state_fields[] = {
+    SCHEMA_TRANSIENT(GameState, header, GameStateHeader),
+    SCHEMA_REQUIRED(GameState, platform, Platform*),
+    SCHEMA_DATA(GameState, canvas_size, CF_V2),
+    SCHEMA_DATA(GameState, scale, float),
+    SCHEMA_REQUIRED_STRUCT(GameState, permanent_arena, Arena, STATE_LAYOUT_ARENA),
+    SCHEMA_REQUIRED_STRUCT(GameState, stage_arena, Arena, STATE_LAYOUT_ARENA),
+    SCHEMA_REQUIRED_STRUCT(GameState, scratch_arena, Arena, STATE_LAYOUT_ARENA),
+    SCHEMA_DATA(GameState, display_id, CF_DisplayID),
+    SCHEMA_STRUCT(GameState, rnd, RndStreams, STATE_LAYOUT_RND_STREAMS),
+    SCHEMA_DATA(GameState, score, int),
+    SCHEMA_DATA(GameState, lives, int),
+    SCHEMA_REQUIRED(GameState, canvas, CF_Canvas),
+    SCHEMA_REQUIRED_STRUCT(GameState, background_scroll, BackgroundScroll, STATE_LAYOUT_BACKGROUND_SCROLL),
+    SCHEMA_REQUIRED_STRUCT(GameState, star_field, StarField, STATE_LAYOUT_STAR_FIELD),
+    SCHEMA_STRUCT(GameState, players[0], Player, STATE_LAYOUT_PLAYER),
+    SCHEMA_STRUCT(GameState, players[1], Player, STATE_LAYOUT_PLAYER),
+    SCHEMA_DATA(GameState, players_count, size_t),
+    SCHEMA_ENTITY_ARRAY(GameState, player_bullets, PlayerBullet, STATE_LAYOUT_PLAYER_BULLET, MAX_PLAYER_BULLETS),
+    SCHEMA_ENTITY_ARRAY(GameState, enemies, Enemy, STATE_LAYOUT_ENEMY, MAX_ENEMIES),
+    SCHEMA_ENTITY_ARRAY(GameState, enemy_bullets, EnemyBullet, STATE_LAYOUT_ENEMY_BULLET, MAX_ENEMY_BULLETS),
+    SCHEMA_ENTITY_ARRAY(GameState, explosions, Explosion, STATE_LAYOUT_EXPLOSION, MAX_EXPLOSIONS),
+    SCHEMA_ENTITY_ARRAY(GameState, hit_particles, HitParticle, STATE_LAYOUT_HIT_PARTICLE, MAX_HIT_PARTICLES),
+    SCHEMA_ENTITY_ARRAY(
+        GameState, explosion_particles, ExplosionParticle, STATE_LAYOUT_EXPLOSION_PARTICLE, MAX_EXPLOSION_PARTICLES
+    ),
+    SCHEMA_ENTITY_ARRAY(GameState, floating_scores, FloatingScore, STATE_LAYOUT_FLOATING_SCORE, MAX_FLOATING_SCORES),
+    SCHEMA_TRANSIENT(GameState, events, GameplayEvents),  // Empty between ticks
+    SCHEMA_REQUIRED_STRUCT(GameState, gfx, Gfx, STATE_LAYOUT_GFX),
+    SCHEMA_STRUCT(GameState, screenshake, ScreenShake, STATE_LAYOUT_SCREENSHAKE),
+    SCHEMA_TRANSIENT(GameState, text_cache, TextCache),  // Cleared after every reload
+    SCHEMA_REQUIRED_STRUCT(GameState, hud, Hud, STATE_LAYOUT_HUD),
+    SCHEMA_REQUIRED_STRUCT(GameState, render_queue, RenderQueue, STATE_LAYOUT_RENDER_QUEUE),
+    SCHEMA_REQUIRED_STRUCT(GameState, asset_loader, AssetLoader, STATE_LAYOUT_ASSET_LOADER),
+    SCHEMA_STRUCT(GameState, voices, VoiceManager, STATE_LAYOUT_VOICE_MANAGER),
+    SCHEMA_REQUIRED(GameState, sprite_assets, CF_Sprite),
+    SCHEMA_REQUIRED(GameState, sprites.particle, CF_Sprite),
+    SCHEMA_REQUIRED(GameState, sprites.explosion_palette, CF_Sprite),
+    SCHEMA_STRUCT(GameState, audio.handles, AssetHandle, STATE_LAYOUT_ASSET_HANDLE),
+    SCHEMA_DATA(GameState, audio.queued_music, Audio),
+    SCHEMA_DATA(GameState, audio.has_queued_music, bool),
+    SCHEMA_STRUCT(GameState, audio.stats, AudioStats, STATE_LAYOUT_AUDIO_STATS),
+    SCHEMA_DATA(GameState, wave.current_wave, int),
+    SCHEMA_DATA(GameState, wave.announcement_timer, float),
+    SCHEMA_DATA(GameState, wave.is_announcing, bool),
+    SCHEMA_STRUCT(GameState, spawner, Spawner, STATE_LAYOUT_SPAWNER),
+    SCHEMA_STRUCT(GameState, rollback, RollbackSession, STATE_LAYOUT_ROLLBACK_SESSION),
+    SCHEMA_STRUCT(GameState, soak, SoakTest, STATE_LAYOUT_SOAK_TEST),
+    SCHEMA_STRUCT(GameState, snapshot, SnapshotStats, STATE_LAYOUT_SNAPSHOT_STATS),
+    SCHEMA_STRUCT(GameState, rewind, RewindBuffer, STATE_LAYOUT_REWIND_BUFFER),
+    SCHEMA_DATA(GameState, is_headless, bool),
+    SCHEMA_DATA(GameState, is_loading, bool),
+    SCHEMA_DATA(GameState, is_game_over, bool),
+    SCHEMA_DATA(GameState, debug, bool),
+    SCHEMA_DATA(GameState, debug_bounding_boxes, bool),
+};
+
+static const FieldSchema s_player_fields[] = {
+    SCHEMA_DATA(Player, position, CF_V2),
+    SCHEMA_DATA(Player, velocity, CF_V2),
+    SCHEMA_DATA(Player, spawn_position, CF_V2),
+    SCHEMA_DATA(Player, sprite, CF_Sprite),
+    SCHEMA_DATA(Player, booster_sprite, CF_Sprite),
+    SCHEMA_STRUCT(Player, input, Input, STATE_LAYOUT_INPUT),
+    SCHEMA_STRUCT(Player, collider, Collider, STATE_LAYOUT_COLLIDER),
+    SCHEMA_STRUCT(Player, weapon, Weapon, STATE_LAYOUT_WEAPON),
+    SCHEMA_DATA(Player, is_alive, bool),
+    SCHEMA_DATA(Player, is_invincible, bool),
+    SCHEMA_DATA(Player, invincibility_timer, float),
+    SCHEMA_DATA(Player, respawn_delay, float),
+    SCHEMA_DATA(Player, z_index, ZIndex),
+};
+
+static const FieldSchema s_player_bullet_fields[] = {
+    SCHEMA_DATA(PlayerBullet, position, CF_V2),
+    SCHEMA_DATA(PlayerBullet, velocity, CF_V2),
+    SCHEMA_DATA(PlayerBullet, sprite, CF_Sprite),
+    SCHEMA_STRUCT(PlayerBullet, collider, Collider, STATE_LAYOUT_COLLIDER),
+    SCHEMA_DATA(PlayerBullet, is_alive, bool),
+    SCHEMA_DATA(PlayerBullet, z_index, ZIndex),
+};
+
+static const FieldSchema s_enemy_fields[] = {
+    SCHEMA_DATA(Enemy, position, CF_V2),
+    SCHEMA_DATA(Enemy, velocity, CF_V2),
+    SCHEMA_DATA(Enemy, sprite, CF_Sprite),
+    SCHEMA_STRUCT(Enemy, collider, Collider, STATE_LAYOUT_COLLIDER),
+    SCHEMA_DATA(Enemy, is_alive, bool),
+    SCHEMA_DATA(Enemy, z_index, ZIndex),
+    SCHEMA_STRUCT(Enemy, health, Health, STATE_LAYOUT_HEALTH),
+    SCHEMA_DATA(Enemy, score, int),
+    SCHEMA_DATA(Enemy, cooldown, float),
+    SCHEMA_DATA(Enemy, time_since_shot, float),
+    SCHEMA_DATA(Enemy, shoot_chance, float),
+    SCHEMA_DATA(Enemy, type, EnemyType),
+};
+
+static const FieldSchema s_enemy_bullet_fields[] = {
+    SCHEMA_DATA(EnemyBullet, position, CF_V2),
+    SCHEMA_DATA(EnemyBullet, velocity, CF_V2),
+    SCHEMA_DATA(EnemyBullet, sprite, CF_Sprite),
+    SCHEMA_STRUCT(EnemyBullet, collider, Collider, STATE_LAYOUT_COLLIDER),
+    SCHEMA_DATA(EnemyBullet, is_alive, bool),
+    SCHEMA_DATA(EnemyBullet, z_index, ZIndex),
+};
+
+static const FieldSchema s_explosion_fields[] = {
+    SCHEMA_DATA(Explosion, position, CF_V2),
+    SCHEMA_DATA(Explosion, velocity, CF_V2),
+    SCHEMA_DATA(Explosion, sprite, CF_Sprite),
+    SCHEMA_STRUCT(Explosion, collider, Collider, STATE_LAYOUT_COLLIDER),
+    SCHEMA_DATA(Explosion, is_alive, bool),
+    SCHEMA_DATA(Explosion, z_index, ZIndex),
+};
+
+static const FieldSchema s_hit_particle_fields[] = {
+    SCHEMA_DATA(HitParticle, position, CF_V2),
+    SCHEMA_DATA(HitParticle, velocity, CF_V2),
+    SCHEMA_DATA(HitParticle, sprite, CF_Sprite),
+    SCHEMA_DATA(HitParticle, lifetime, float),
+    SCHEMA_DATA(HitParticle, time_alive, float),
+    SCHEMA_DATA(HitParticle, size, float),
+    SCHEMA_DATA(HitParticle, is_alive, bool),
+};
+
+static const FieldSchema s_explosion_particle_fields[] = {
+    SCHEMA_DATA(ExplosionParticle, position, CF_V2),
+    SCHEMA_DATA(ExplosionParticle, velocity, CF_V2),
+    SCHEMA_DATA(ExplosionParticle, sprite, CF_Sprite),
+    SCHEMA_DATA(ExplosionParticle, lifetime, float),
+    SCHEMA_DATA(ExplosionParticle, time_alive, float),
+    SCHEMA_DATA(ExplosionParticle, size, float),
+    SCHEMA_DATA(ExplosionParticle, palette_index, uint8_t),
+    SCHEMA_DATA(ExplosionParticle, is_alive, bool),
+};
+
+static const FieldSchema s_floating_score_fields[] = {
+    SCHEMA_DATA(FloatingScore, position, CF_V2),
+    SCHEMA_DATA(FloatingScore, velocity, CF_V2),
+    SCHEMA_DATA(FloatingScore, score, int),
+    SCHEMA_DATA(FloatingScore, lifetime, float),
+    SCHEMA_DATA(FloatingScore, alpha, float),
+    SCHEMA_DATA(FloatingScore, is_alive, bool),
+};
+
+static const FieldSchema s_input_fields[] = {
+    SCHEMA_DATA(Input, up, bool),
+    SCHEMA_DATA(Input, down, bool),
+    SCHEMA_DATA(Input, left, bool),
+    SCHEMA_DATA(Input, right, bool),
+    SCHEMA_DATA(Input, shoot, bool),
+};
+
+static const FieldSchema s_collider_fields[] = {
+    SCHEMA_DATA(Collider, half_extents, CF_V2),
+};
+
+static const FieldSchema s_weapon_fields[] = {
+    SCHEMA_DATA(Weapon, cooldown, float),
+    SCHEMA_DATA(Weapon, time_since_shot, float),
+};
+
+static const FieldSchema s_health_fields[] = {
+    SCHEMA_DATA(Health, current, int),
+    SCHEMA_DATA(Health, maximum, int),
+};
+
+static const FieldSchema s_arena_fields[] = {
+    SCHEMA_DATA(Arena, base, uint8_t*),
+    SCHEMA_DATA(Arena, reservation, void*),
+    SCHEMA_DATA(Arena, reserved, size_t),
+    SCHEMA_DATA(Arena, capacity, size_t),
+    SCHEMA_DATA(Arena, alignment, int),
+    SCHEMA_DATA(Arena, flags, ArenaFlags),
+    SCHEMA_ARRAY(Arena, name, char),
+    SCHEMA_STRUCT(Arena, stats, ArenaStats, STATE_LAYOUT_ARENA_STATS),
+};
+
+static const FieldSchema s_arena_stats_fields[] = {
+    SCHEMA_DATA(ArenaStats, used, size_t),
+    SCHEMA_DATA(ArenaStats, committed, size_t),
+    SCHEMA_DATA(ArenaStats, frame_peak, size_t),
+    SCHEMA_DATA(ArenaStats, session_peak, size_t),
+    SCHEMA_DATA(ArenaStats, allocation_count, size_t),
+    SCHEMA_DATA(ArenaStats, frame_allocation_count, size_t),
+};
+
+static const FieldSchema s_rnd_streams_fields[] = {
+    SCHEMA_DATA(RndStreams, seed, uint64_t),
+    SCHEMA_DATA(RndStreams, gameplay, CF_Rnd),
+    SCHEMA_DATA(RndStreams, particles, CF_Rnd),
+};
+
+static const FieldSchema s_background_scroll_fields[] = {
+    SCHEMA_DATA(BackgroundScroll, position, CF_V2),
+    SCHEMA_DATA(BackgroundScroll, velocity, CF_V2),
+    SCHEMA_DATA(BackgroundScroll, sprites, CF_Sprite),
+    SCHEMA_DATA(BackgroundScroll, y_offset, float),
+    SCHEMA_DATA(BackgroundScroll, max_y_offset, float),
+    SCHEMA_DATA(BackgroundScroll, z_index, ZIndex),
+    SCHEMA_DATA(BackgroundScroll, mode, BackgroundScrollMode),
+    SCHEMA_DATA(BackgroundScroll, baked_canvas, CF_Canvas),
+    SCHEMA_DATA(BackgroundScroll, baked_size, CF_V2),
+};
+
+static const FieldSchema s_star_field_fields[] = {
+    SCHEMA_DATA(StarField, seed, uint32_t),
+    SCHEMA_DATA(StarField, time, double),
+    SCHEMA_DATA(StarField, stars_per_layer, int),
+};
+
+static const FieldSchema s_gfx_fields[] = {
+    SCHEMA_DATA(Gfx, backend, GfxBackend),
+    SCHEMA_DATA(Gfx, forward, bool),
+    SCHEMA_DATA(Gfx, buffer, uint8_t*),
+    SCHEMA_DATA(Gfx, capacity, size_t),
+    SCHEMA_DATA(Gfx, size, size_t),
+    SCHEMA_STRUCT(Gfx, frame, GfxStats, STATE_LAYOUT_GFX_STATS),
+    SCHEMA_STRUCT(Gfx, last_frame, GfxStats, STATE_LAYOUT_GFX_STATS),
+    SCHEMA_DATA(Gfx, clear_color, CF_Color),
+};
+
+static const FieldSchema s_gfx_stats_fields[] = {
+    SCHEMA_DATA(GfxStats, commands, size_t),
+    SCHEMA_DATA(GfxStats, state_changes, size_t),
+    SCHEMA_DATA(GfxStats, bytes, size_t),
+    SCHEMA_DATA(GfxStats, dropped, size_t),
+};
+
+static const FieldSchema s_screenshake_fields[] = {
+    SCHEMA_DATA(ScreenShake, magnitude, float),
+    SCHEMA_DATA(ScreenShake, decay_rate, float),
+    SCHEMA_DATA(ScreenShake, time, float),
+    SCHEMA_DATA(ScreenShake, offset, CF_V2),
+    SCHEMA_DATA(ScreenShake, rotation, float),
+};
+
+static const FieldSchema s_hud_fields[] = {
+    SCHEMA_DATA(Hud, canvas, CF_Canvas),
+    SCHEMA_DATA(Hud, score, int),
+    SCHEMA_DATA(Hud, lives, int),
+    SCHEMA_DATA(Hud, wave, int),
+    SCHEMA_DATA(Hud, show_stats, bool),
+    SCHEMA_DATA(Hud, show_wave, bool),
+    SCHEMA_DATA(Hud, is_dirty, bool),
+    SCHEMA_DATA(Hud, redraw_count, size_t),
+};
+
+static const FieldSchema s_render_queue_fields[] = {
+    SCHEMA_DATA(RenderQueue, items, RenderItem*),
+    SCHEMA_DATA(RenderQueue, entries, RenderSortEntry*),
+    SCHEMA_DATA(RenderQueue, sort_scratch, RenderSortEntry*),
+    SCHEMA_DATA(RenderQueue, count, size_t),
+    SCHEMA_DATA(RenderQueue, capacity, size_t),
+    SCHEMA_DATA(RenderQueue, dropped, size_t),
+    SCHEMA_TRANSIENT(RenderQueue, textures, RenderTextureCache),  // Cleared after every reload
+    SCHEMA_TRANSIENT(RenderQueue, shaders, RenderShaderTable),
+    SCHEMA_ARRAY(RenderQueue, draws_per_layer, size_t),
+    SCHEMA_DATA(RenderQueue, state_changes, size_t),
+};
+
+static const FieldSchema s_asset_loader_fields[] = {
+    SCHEMA_DATA(AssetLoader, threadpool, CF_Threadpool*),
+    SCHEMA_STRUCT(AssetLoader, jobs, AssetJob, STATE_LAYOUT_ASSET_JOB),
+    SCHEMA_DATA(AssetLoader, job_count, int),
+    SCHEMA_DATA(AssetLoader, stopwatch, CF_Stopwatch),
+    SCHEMA_DATA(AssetLoader, required_ready_ms, double),
+};
+
+static const FieldSchema s_asset_job_fields[] = {
+    SCHEMA_ARRAY(AssetJob, path, char),
+    SCHEMA_DATA(AssetJob, audio, CF_Audio),
+    SCHEMA_DATA(AssetJob, required, bool),
+    SCHEMA_DATA(AssetJob, decode_ms, double),
+    SCHEMA_DATA(AssetJob, status, CF_AtomicInt),
+};
+
+static const FieldSchema s_asset_handle_fields[] = {
+    SCHEMA_DATA(AssetHandle, index, int),
+};
+
+static const FieldSchema s_voice_manager_fields[] = {
+    SCHEMA_STRUCT(VoiceManager, voices, Voice, STATE_LAYOUT_VOICE),
+    SCHEMA_DATA(VoiceManager, voice_count, int),
+    SCHEMA_ARRAY(VoiceManager, requests, int),
+    SCHEMA_DATA(VoiceManager, frame, uint64_t),
+    SCHEMA_DATA(VoiceManager, merged, int),
+    SCHEMA_DATA(VoiceManager, stolen, int),
+};
+
+static const FieldSchema s_voice_fields[] = {
+    SCHEMA_DATA(Voice, sound, CF_Sound),
+    SCHEMA_DATA(Voice, audio, Audio),
+    SCHEMA_DATA(Voice, volume, float),
+    SCHEMA_DATA(Voice, started_frame, uint64_t),
+};
+
+static const FieldSchema s_audio_stats_fields[] = {
+    SCHEMA_ARRAY(AudioStats, resident_bytes, size_t),
+    SCHEMA_ARRAY(AudioStats, decode_ms, double),
+    SCHEMA_DATA(AudioStats, sound_bank_bytes, size_t),
+    SCHEMA_DATA(AudioStats, music_bytes, size_t),
+    SCHEMA_DATA(AudioStats, loaded_count, size_t),
+};
+
+static const FieldSchema s_spawner_fields[] = {
+    SCHEMA_DATA(Spawner, phase, SpawnerPhase),
+    SCHEMA_DATA(Spawner, step, int),
+    SCHEMA_DATA(Spawner, timer, float),
+};
+
+static const FieldSchema s_rollback_session_fields[] = {
+    SCHEMA_STRUCT(RollbackSession, ticks, RollbackTick, STATE_LAYOUT_ROLLBACK_TICK),
+    SCHEMA_REQUIRED(RollbackSession, state_capacity, size_t),
+    SCHEMA_DATA(RollbackSession, tick, int64_t),
+    SCHEMA_DATA(RollbackSession, confirmed_tick, int64_t),
+    SCHEMA_DATA(RollbackSession, rollback_tick, int64_t),
+    SCHEMA_STRUCT(RollbackSession, peer, LoopbackPeer, STATE_LAYOUT_LOOPBACK_PEER),
+    SCHEMA_DATA(RollbackSession, is_active, bool),
+    SCHEMA_DATA(RollbackSession, is_resimulating, bool),
+    SCHEMA_STRUCT(RollbackSession, stats, RollbackStats, STATE_LAYOUT_ROLLBACK_STATS),
+};
+
+// States live in the permanent arena, sized by `state_capacity`, a zeroed pointer would crash the next save
+static const FieldSchema s_rollback_tick_fields[] = {
+    SCHEMA_STRUCT(RollbackTick, inputs, Input, STATE_LAYOUT_INPUT),
+    SCHEMA_DATA(RollbackTick, is_confirmed, bool),
+    SCHEMA_REQUIRED(RollbackTick, state, uint8_t*),
+    SCHEMA_DATA(RollbackTick, state_size, size_t),
+};
+
+static const FieldSchema s_rollback_stats_fields[] = {
+    SCHEMA_DATA(RollbackStats, resimulated_ticks, int),
+    SCHEMA_DATA(RollbackStats, peak_resimulated_ticks, int),
+    SCHEMA_DATA(RollbackStats, resimulate_ms, double),
+    SCHEMA_DATA(RollbackStats, peak_resimulate_ms, double),
+    SCHEMA_DATA(RollbackStats, save_ms, double),
+    SCHEMA_DATA(RollbackStats, mispredictions, int),
+    SCHEMA_DATA(RollbackStats, stalled_frames, int),
+};
+
+static const FieldSchema s_loopback_peer_fields[] = {
+    SCHEMA_STRUCT(LoopbackPeer, packets, InputPacket, STATE_LAYOUT_INPUT_PACKET),
+    SCHEMA_DATA(LoopbackPeer, packets_count, int),
+    SCHEMA_DATA(LoopbackPeer, frame, uint64_t),
+    SCHEMA_DATA(LoopbackPeer, latency_ms, float),
+    SCHEMA_DATA(LoopbackPeer, jitter_ms, float),
+    SCHEMA_DATA(LoopbackPeer, rnd, CF_Rnd),
+};
+
+static const FieldSchema s_input_packet_fields[] = {
+    SCHEMA_DATA(InputPacket, tick, int64_t),
+    SCHEMA_STRUCT(InputPacket, input, Input, STATE_LAYOUT_INPUT),
+    SCHEMA_DATA(InputPacket, deliver_frame, uint64_t),
+};
+
+static const FieldSchema s_soak_test_fields[] = {
+    SCHEMA_DATA(SoakTest, is_active, bool),
+    SCHEMA_DATA(SoakTest, was_game_over, bool),
+    SCHEMA_DATA(SoakTest, ticks, uint64_t),
+    SCHEMA_DATA(SoakTest, total_ms, double),
+    SCHEMA_DATA(SoakTest, runs, int),
+    SCHEMA_DATA(SoakTest, best_wave, int),
+    SCHEMA_DATA(SoakTest, last_wave, int),
+    SCHEMA_STRUCT(SoakTest, waves, SoakWaveCost, STATE_LAYOUT_SOAK_WAVE_COST),
+    SCHEMA_ARRAY(SoakTest, pool_peaks, size_t),
+    SCHEMA_ARRAY(SoakTest, pool_rejected, size_t),
+    SCHEMA_DATA(SoakTest, frames, uint64_t),
+    SCHEMA_DATA(SoakTest, render_ms, double),
+    SCHEMA_DATA(SoakTest, render_peak_ms, double),
+    SCHEMA_DATA(SoakTest, draw_commands, size_t),
+    SCHEMA_DATA(SoakTest, draws_dropped, size_t),
+};
+
+static const FieldSchema s_soak_wave_cost_fields[] = {
+    SCHEMA_DATA(SoakWaveCost, ticks, uint64_t),
+    SCHEMA_DATA(SoakWaveCost, total_ms, double),
+    SCHEMA_DATA(SoakWaveCost, peak_ms, double),
+};
+
+static const FieldSchema s_snapshot_stats_fields[] = {
+    SCHEMA_DATA(SnapshotStats, save_ms, double),
+    SCHEMA_DATA(SnapshotStats, load_ms, double),
+    SCHEMA_DATA(SnapshotStats, bytes, size_t),
+};
+
+// Allocated once from the permanent arena, like the rollback states
+static const FieldSchema s_rewind_buffer_fields[] = {
+    SCHEMA_REQUIRED(RewindBuffer, data, uint8_t*),
+    SCHEMA_REQUIRED(RewindBuffer, capacity, size_t),
+    SCHEMA_DATA(RewindBuffer, write_offset, size_t),
+    SCHEMA_REQUIRED(RewindBuffer, frames, RewindFrame*),
+    SCHEMA_DATA(RewindBuffer, first, int),
+    SCHEMA_DATA(RewindBuffer, count, int),
+    SCHEMA_DATA(RewindBuffer, cursor, int),
+    SCHEMA_DATA(RewindBuffer, is_paused, bool),
+    SCHEMA_STRUCT(RewindBuffer, stats, RewindStats, STATE_LAYOUT_REWIND_STATS),
+};
+
+static const FieldSchema s_rewind_stats_fields[] = {
+    SCHEMA_DATA(RewindStats, capture_ms, double),
+    SCHEMA_DATA(RewindStats, peak_capture_ms, double),
+    SCHEMA_DATA(RewindStats, stored_bytes, size_t),
+    SCHEMA_DATA(RewindStats, raw_bytes, size_t),
+};
+
+#define ADD_SCHEMA_STRUCT(schema, type, fields) add_schema_struct(schema, #type, sizeof(type), fields, countof(fields))
+
+const StateSchema* get_state_schema(void) {
+    // Built once per loaded library, each reload brings its own
+    // Per thread, instances on other threads may be building it at the same time
+    static thread_local StateSchema schema;
+    static thread_local bool        is_built = false;
+    if (is_built) { return &schema; }
+
+    init_state_schema(&schema);
+    ADD_SCHEMA_STRUCT(&schema, GameState, s_game_state_fields);
+    ADD_SCHEMA_STRUCT(&schema, Player, s_player_fields);
+    ADD_SCHEMA_STRUCT(&schema, PlayerBullet, s_player_bullet_fields);
+    ADD_SCHEMA_STRUCT(&schema, Enemy, s_enemy_fields);
+    ADD_SCHEMA_STRUCT(&schema, EnemyBullet, s_enemy_bullet_fields);
+    ADD_SCHEMA_STRUCT(&schema, Explosion, s_explosion_fields);
+    ADD_SCHEMA_STRUCT(&schema, HitParticle, s_hit_particle_fields);
+    ADD_SCHEMA_STRUCT(&schema, ExplosionParticle, s_explosion_particle_fields);
+    ADD_SCHEMA_STRUCT(&schema, FloatingScore, s_floating_score_fields);
+    ADD_SCHEMA_STRUCT(&schema, Input, s_input_fields);
+    ADD_SCHEMA_STRUCT(&schema, Collider, s_collider_fields);
+    ADD_SCHEMA_STRUCT(&schema, Weapon, s_weapon_fields);
+    ADD_SCHEMA_STRUCT(&schema, Health, s_health_fields);
+    ADD_SCHEMA_STRUCT(&schema, Arena, s_arena_fields);
+    ADD_SCHEMA_STRUCT(&schema, ArenaStats, s_arena_stats_fields);
+    ADD_SCHEMA_STRUCT(&schema, RndStreams, s_rnd_streams_fields);
+    ADD_SCHEMA_STRUCT(&schema, BackgroundScroll, s_background_scroll_fields);
+    ADD_SCHEMA_STRUCT(&schema, StarField, s_star_field_fields);
+    ADD_SCHEMA_STRUCT(&schema, Gfx, s_gfx_fields);
+    ADD_SCHEMA_STRUCT(&schema, GfxStats, s_gfx_stats_fields);
+    ADD_SCHEMA_STRUCT(&schema, ScreenShake, s_screenshake_fields);
+    ADD_SCHEMA_STRUCT(&schema, Hud, s_hud_fields);
+    ADD_SCHEMA_STRUCT(&schema, RenderQueue, s_render_queue_fields);
+    ADD_SCHEMA_STRUCT(&schema, AssetLoader, s_asset_loader_fields);
+    ADD_SCHEMA_STRUCT(&schema, AssetJob, s_asset_job_fields);
+    ADD_SCHEMA_STRUCT(&schema, AssetHandle, s_asset_handle_fields);
+    ADD_SCHEMA_STRUCT(&schema, VoiceManager, s_voice_manager_fields);
+    ADD_SCHEMA_STRUCT(&schema, Voice, s_voice_fields);
+    ADD_SCHEMA_STRUCT(&schema, AudioStats, s_audio_stats_fields);
+    ADD_SCHEMA_STRUCT(&schema, Spawner, s_spawner_fields);
+    ADD_SCHEMA_STRUCT(&schema, RollbackSession, s_rollback_session_fields);
+    ADD_SCHEMA_STRUCT(&schema, RollbackTick, s_rollback_tick_fields);
+    ADD_SCHEMA_STRUCT(&schema, RollbackStats, s_rollback_stats_fields);
+    ADD_SCHEMA_STRUCT(&schema, LoopbackPeer, s_loopback_peer_fields);
+    ADD_SCHEMA_STRUCT(&schema, InputPacket, s_input_packet_fields);
+    ADD_SCHEMA_STRUCT(&schema, SoakTest, s_soak_test_fields);
+    ADD_SCHEMA_STRUCT(&schema, SoakWaveCost, s_soak_wave_cost_fields);
+    ADD_SCHEMA_STRUCT(&schema, SnapshotStats, s_snapshot_stats_fields);
+    ADD_SCHEMA_STRUCT(&schema, RewindBuffer, s_rewind_buffer_fields);
+    ADD_SCHEMA_STRUCT(&schema, RewindStats, s_rewind_stats_fields);
+    CF_ASSERT(schema.struct_count == STATE_LAYOUT_COUNT);
+    finish_state_schema(&schema);
+
+    is_built = true;
+    return &schema;
+}
+
+void write_state_header(GameState* state) {
+    const StateSchema* schema = get_state_schema();
+
+    // Copied out of the library, the next one reads it after this library is unloaded
+    StateSchema* copy = state->platform->allocate_memory(sizeof(StateSchema));
+    memcpy(copy, schema, sizeof(StateSchema));
+
+    state->header = (GameStateHeader){
+        .magic          = GAME_STATE_MAGIC,
+        .layout_version = schema->version,
+        .schema         = copy,
+    };
+}
+
+void free_state_header(GameState* state) {
+    state->platform->free_memory(state->header.schema);
+    state->header.schema = nullptr;
+}
+
+Platform* find_state_platform(const GameState* state) {
+    Platform* const* platform = find_state_field(state->header.schema, state, "platform");
+    return platform ? *platform : nullptr;
+}
+
+GameState* migrate_game_state(GameState* previous, Platform* platform) {
+    const StateSchema* schema     = get_state_schema();
+    StateSchema*       old_schema = previous->header.schema;
+
+    // Entity arrays move into a fresh stage arena sized like game_init()'s, the previous one is released after
+    GameState* state   = platform->allocate_memory(sizeof(GameState));
+    Arena      storage = make_stage_arena();
+
+    const SchemaMigration migration = migrate_state(schema, state, old_schema, previous, &storage);
+    if (!migration.ok) {
+        APP_ERROR("Cannot migrate GameState, '%s' changed layout", migration.failed_field);
+        destroy_arena(&storage);
+        platform->free_memory(state);
+        return nullptr;
+    }
+
+    destroy_arena(&state->stage_arena);
+    state->stage_arena = storage;
+    write_state_header(state);
+
+    APP_INFO(
+        "Migrated GameState %08x -> %08x: %d added, %d removed, %d resized, %d retyped, %zu entities dropped",
+        previous->header.layout_version,
+        schema->version,
+        migration.added,
+        migration.removed,
+        migration.resized,
+        migration.retyped,
+        migration.dropped_elements
+    );
+
+    // The previous library joined the asset workers before it was unloaded, nothing writes into it anymore
+    platform->free_memory(old_schema);
+    platform->free_memory(previous);
+
+    return state;
+}
+
+// The previous GameState is only reachable through its own schema, this library's offsets do not apply to it
+void destroy_previous_game_state(GameState* previous, Platform* platform) {
+    const StateSchema* schema     = get_state_schema();
+    StateSchema*       old_schema = previous->header.schema;
+
+    // Its asset workers were joined by game_unload() before the previous library was unloaded
+    static const char* const arena_fields[] = {"scratch_arena", "stage_arena", "permanent_arena"};
+    for (size_t i = 0; i < countof(arena_fields); ++i) {
+        Arena* arena = (Arena*)find_matching_state_field(schema, old_schema, previous, arena_fields[i]);
+        if (arena == nullptr) {
+            APP_WARN("Leaking the previous %s, its layout is unknown to this library", arena_fields[i]);
+            continue;
+        }
+        destroy_arena(arena);
+    }
+
+    platform->free_memory(old_schema);
+    platform->free_memory(previous);
+}
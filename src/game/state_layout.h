@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../engine/game_state.h"
+
+const StateSchema* get_state_schema(void);
+void               write_state_header(GameState* state);
+void               free_state_header(GameState* state);
+Platform*          find_state_platform(const GameState* state);
+GameState*         migrate_game_state(GameState* previous, Platform* platform);
+void               destroy_previous_game_state(GameState* previous, Platform* platform);  // After a failed migration
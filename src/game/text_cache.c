@@ -0,0 +1,139 @@
+#include "text_cache.h"
+
+#include <cute_c_runtime.h>
+#include <cute_draw.h>
+#include <cute_math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gfx.h"
+
+constexpr uint64_t FNV_OFFSET_BASIS  = 0xcbf29ce484222325ull;
+constexpr uint64_t FNV_PRIME         = 0x100000001b3ull;
+constexpr float    ESTIMATED_ADVANCE = 0.6f;  // Of the font size, per character
+
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t hash_string(uint64_t hash, const char* string) { return hash_bytes(hash, string, strlen(string)); }
+
+static uint64_t make_key(const char* font, float size, const char* text, const char* format, int value) {
+    uint64_t hash = hash_string(FNV_OFFSET_BASIS, font);
+    hash          = hash_bytes(hash, &size, sizeof(size));
+    if (format) {
+        hash = hash_string(hash, format);
+        hash = hash_bytes(hash, &value, sizeof(value));
+    } else {
+        hash = hash_string(hash, text);
+    }
+
+    // Zero marks an empty slot
+    return hash == 0 ? 1 : hash;
+}
+
+static bool run_matches(
+    const TextRun* run, uint64_t key, const char* font, float size, const char* text, const char* format, int value
+) {
+    if (run->key != key || run->size != size || strcmp(run->font, font) != 0) { return false; }
+    if (format) { return run->format == format && run->value == value; }
+    return run->format == nullptr && strcmp(run->text, text) == 0;
+}
+
+static TextRun* find_slot(
+    TextCache* cache, uint64_t key, const char* font, float size, const char* text, const char* format, int value
+) {
+    size_t index = (size_t)key & (TEXT_CACHE_CAPACITY - 1);
+
+    for (int probe = 0; probe < TEXT_CACHE_CAPACITY; ++probe) {
+        TextRun* run = &cache->runs[index];
+        if (run->key == 0 || run_matches(run, key, font, size, text, format, value)) { return run; }
+        index = (index + 1) & (TEXT_CACHE_CAPACITY - 1);
+    }
+
+    return nullptr;
+}
+
+static const TextRun* lookup(
+    TextCache* cache, const char* font, float size, const char* text, const char* format, int value
+) {
+    const uint64_t key = make_key(font, size, text, format, value);
+    TextRun*       run = find_slot(cache, key, font, size, text, format, value);
+
+    if (run && run->key != 0) {
+        cache->hits++;
+        return run;
+    }
+
+    // Keep the load factor low so probes stay short; the working set is only a handful of strings
+    if (run == nullptr || cache->count >= TEXT_CACHE_CAPACITY * 3 / 4) {
+        text_cache_clear(cache);
+        run = find_slot(cache, key, font, size, text, format, value);
+    }
+
+    cache->misses++;
+    cache->count++;
+
+    run->key    = key;
+    run->font   = font;
+    run->size   = size;
+    run->format = format;
+    run->value  = value;
+
+    if (format) {
+        snprintf(run->text, sizeof(run->text), format, value);
+    } else {
+        snprintf(run->text, sizeof(run->text), "%s", text);
+    }
+    run->length = (int)strlen(run->text);
+
+    if (cache->has_fonts) {
+        cf_push_font(font);
+        cf_push_font_size(size);
+        run->width  = cf_text_width(run->text, run->length);
+        run->height = cf_text_height(run->text, run->length);
+        cf_pop_font_size();
+        cf_pop_font();
+    } else {
+        // Close enough for the layout code that reads them, the draws are only recorded
+        run->width  = (float)run->length * size * ESTIMATED_ADVANCE;
+        run->height = size;
+    }
+
+    return run;
+}
+
+void init_text_cache(TextCache* cache, bool has_fonts) {
+    text_cache_clear(cache);
+    cache->has_fonts = has_fonts;
+}
+
+void text_cache_clear(TextCache* cache) {
+    CF_MEMSET(cache->runs, 0, sizeof(cache->runs));
+    cache->count = 0;
+}
+
+const TextRun* text_cache_get(TextCache* cache, const char* font, float size, const char* text) {
+    CF_ASSERT(cache && font && text);
+    return lookup(cache, font, size, text, nullptr, 0);
+}
+
+const TextRun* text_cache_get_int(TextCache* cache, const char* font, float size, const char* format, int value) {
+    CF_ASSERT(cache && font && format);
+    return lookup(cache, font, size, nullptr, format, value);
+}
+
+void draw_text_run(GameState* state, const TextRun* run, CF_V2 position) {
+    gfx_push_font(state, run->font);
+    gfx_push_font_size(state, run->size);
+    gfx_draw_text(state, run->text, position, run->length);
+    gfx_pop_font_size(state);
+    gfx_pop_font(state);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cute_math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct GameState GameState;
+
+constexpr int TEXT_CACHE_CAPACITY = 64;  // Must be a power of two
+constexpr int TEXT_RUN_MAX_LENGTH = 32;
+
+/*
+ * Text Run
+ *
+ * A string that has already been formatted and measured for a given font and size
+ */
+typedef struct TextRun {
+    uint64_t    key;
+    const char* font;
+    const char* format;  // Format used to produce an integer run, nullptr for plain strings
+    int         value;   // Integer the run was formatted from
+    float       size;
+    float       width;
+    float       height;
+    int         length;
+    char        text[TEXT_RUN_MAX_LENGTH];
+} TextRun;
+
+/*
+ * Text Cache
+ *
+ * Open addressing table of text runs keyed by (font, size, string)
+ */
+typedef struct TextCache {
+    TextRun runs[TEXT_CACHE_CAPACITY];
+    size_t  count;
+    size_t  hits;
+    size_t  misses;
+    bool    has_fonts;  // Headless instances load none, their runs get estimated metrics
+} TextCache;
+
+void           init_text_cache(TextCache* cache, bool has_fonts);
+void           text_cache_clear(TextCache* cache);
+const TextRun* text_cache_get(TextCache* cache, const char* font, float size, const char* text);
+const TextRun* text_cache_get_int(TextCache* cache, const char* font, float size, const char* format, int value);
+void           draw_text_run(GameState* state, const TextRun* run, CF_V2 position);
@@ -0,0 +1,105 @@
+#include "voice.h"
+
+#include <cute_audio.h>
+#include <cute_c_runtime.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../engine/game_state.h"
+#include "asset/audio.h"
+
+// Concurrent instances allowed per sound, anything over the limit replaces the oldest instance
+static const int s_voice_limits[AUDIO_COUNT] = {
+    [MUSIC_BACKGROUND] = 0,  // Music goes through cf_music_play()
+    [SOUND_REVEAL]     = 1,
+    [SOUND_GAME_OVER]  = 1,
+    [SOUND_DEATH]      = 1,
+    [SOUND_LASER]      = 4,
+    [SOUND_EXPLOSION]  = 4,
+    [SOUND_HIT]        = 3,
+};
+
+static void remove_voice(VoiceManager* manager, int index) {
+    manager->voices[index] = manager->voices[--manager->voice_count];
+}
+
+static void reap_finished_voices(VoiceManager* manager) {
+    for (int i = manager->voice_count - 1; i >= 0; --i) {
+        if (!cf_sound_is_active(manager->voices[i].sound)) { remove_voice(manager, i); }
+    }
+}
+
+// Quietest first, oldest among equally loud voices; `audio` narrows the search to one id, AUDIO_COUNT for any
+static int find_voice_to_steal(const VoiceManager* manager, Audio audio) {
+    int victim = -1;
+
+    for (int i = 0; i < manager->voice_count; ++i) {
+        const Voice* voice = &manager->voices[i];
+        if (audio != AUDIO_COUNT && voice->audio != audio) { continue; }
+
+        if (victim < 0 || voice->volume < manager->voices[victim].volume ||
+            (voice->volume == manager->voices[victim].volume &&
+             voice->started_frame < manager->voices[victim].started_frame)) {
+            victim = i;
+        }
+    }
+
+    return victim;
+}
+
+static void steal_voice(VoiceManager* manager, int index) {
+    cf_sound_stop(manager->voices[index].sound);
+    remove_voice(manager, index);
+    manager->stolen++;
+}
+
+static int count_voices(const VoiceManager* manager, Audio audio) {
+    int count = 0;
+    for (int i = 0; i < manager->voice_count; ++i) {
+        if (manager->voices[i].audio == audio) { count++; }
+    }
+    return count;
+}
+
+static void start_voice(GameState* state, VoiceManager* manager, Audio audio) {
+    if (s_voice_limits[audio] <= 0) { return; }
+
+    if (count_voices(manager, audio) >= s_voice_limits[audio]) {
+        steal_voice(manager, find_voice_to_steal(manager, audio));
+    }
+    if (manager->voice_count >= VOICE_BUDGET) { steal_voice(manager, find_voice_to_steal(manager, AUDIO_COUNT)); }
+
+    const CF_SoundParams params = cf_sound_params_defaults();
+
+    manager->voices[manager->voice_count++] = (Voice){
+        .sound         = cf_play_sound(get_audio(state, audio), params),
+        .audio         = audio,
+        .volume        = params.volume,
+        .started_frame = manager->frame,
+    };
+}
+
+void request_voice(GameState* state, Audio audio) {
+    CF_ASSERT(audio >= 0 && audio < AUDIO_COUNT);
+    state->voices.requests[audio]++;
+}
+
+void update_voices(GameState* state) {
+    auto manager = &state->voices;
+
+    manager->frame++;
+    manager->merged = 0;
+    manager->stolen = 0;
+
+    reap_finished_voices(manager);
+
+    // Identical sounds requested in the same frame would only stack on top of each other, start one of each
+    for (int audio = 0; audio < AUDIO_COUNT; ++audio) {
+        const int requests = manager->requests[audio];
+        if (requests == 0) { continue; }
+
+        manager->requests[audio] = 0;
+        manager->merged += requests - 1;
+        start_voice(state, manager, (Audio)audio);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cute_audio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "asset/audio.h"
+
+typedef struct GameState GameState;
+
+constexpr int VOICE_BUDGET = 16;  // Sounds mixed at once across every Audio id
+
+typedef struct Voice {
+    CF_Sound sound;
+    Audio    audio;
+    float    volume;
+    uint64_t started_frame;
+} Voice;
+
+/*
+ * Voice Manager
+ *
+ * play_sound() only records a request; update_voices() merges the requests of a frame per Audio id and starts
+ * them under a per-id limit and a global budget, stealing the quietest, then oldest, voice when full.
+ */
+typedef struct VoiceManager {
+    Voice    voices[VOICE_BUDGET];
+    int      voice_count;
+    int      requests[AUDIO_COUNT];  // Requests per Audio id since the last update_voices()
+    uint64_t frame;
+
+    // Stats of the last update_voices()
+    int merged;
+    int stolen;
+} VoiceManager;
+
+void request_voice(GameState* state, Audio audio);
+void update_voices(GameState* state);
@@ -1,16 +1,21 @@
+#define LOG_CATEGORY LOG_CATEGORY_PLATFORM
+
 #ifndef ENGINE_ENABLE_HOT_RELOAD
     #define ENGINE_ENABLE_HOT_RELOAD 0
 #endif
 
 #include <cute_app.h>
-#include <cute_color.h>
 #include <cute_defines.h>
 #include <cute_graphics.h>
+#include <cute_multithreading.h>
 #include <cute_time.h>
 #include <debugbreak.h>
+#include <signal.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #ifdef ENGINE_ENABLE_HOT_RELOAD
-    #include <signal.h>
     #include <sys/signal.h>
 #endif
 
@@ -20,9 +25,17 @@
 
 #include "engine/log.h"
 #include "engine/platform.h"
+#include "platform/allocation_tracker.h"
 #include "platform/platform_cute.h"
 
-constexpr const int TARGET_FPS = 60;
+constexpr const int TARGET_FPS           = 60;
+constexpr const int SOAK_DEFAULT_MINUTES = 120;  // Of game time
+constexpr const int SOAK_MAX_INSTANCES   = 64;
+
+typedef struct Game {
+    GameLibrary library;
+    void*       state;  // From game_init(), handed to every other game function
+} Game;
 
 #if ENGINE_ENABLE_HOT_RELOAD
 volatile sig_atomic_t reload_flag = 0;
@@ -32,6 +45,33 @@ static void sighup_handler(int sig) {
     reload_flag = 1;
 }
 
+// `settle_ms` is the time from the first write of the new library until the watcher saw it complete
+static void reload_game_library(Game* game, double settle_ms) {
+    GameLibrary* game_library = &game->library;
+    APP_DEBUG("Reloading library %s\n", game_library->path);
+    const uint64_t start = platform_get_performance_counter();
+
+    // The new library loads next to the old one, so a build that fails to load leaves the game running
+    GameLibrary new_game_library = platform_load_game_library();
+    if (!new_game_library.ok) {
+        APP_WARN("Keeping %s, the new library did not load\n", game_library->path);
+        platform_unload_game_library(&new_game_library);
+        return;
+    }
+
+    // Nothing may run code from the old library once it is unloaded, e.g. asset loader workers
+    game_library->unload(game->state);
+    platform_unload_game_library(game_library);
+    *game_library = new_game_library;
+    game->state   = game_library->hot_reload(game->state);
+
+    const uint64_t end     = platform_get_performance_counter();
+    const double   load_ms = (double)(end - start) * 1000.0 / (double)platform_get_performance_frequency();
+    APP_INFO(
+        "Reloaded %s in %.1f ms, %.1f ms after the first write\n", game_library->path, load_ms, settle_ms + load_ms
+    );
+}
+
 static void debug_handler(bool expr, const char* message, const char* file, int line) {
     if (!expr) {
         fprintf(stderr, "CF_ASSERT(%s) : %s, line %d\n", message, file, line);
@@ -41,69 +81,244 @@ static void debug_handler(bool expr, const char* message, const char* file, int
 #endif  // ENGINE_ENABLE_HOT_RELOAD
 
 static void on_cf_app_update(void* udata) {
-    GameLibrary* game_library = (GameLibrary*)udata;
-    game_library->update();
+    Game* game = (Game*)udata;
+    push_allocation_tag(ALLOCATION_TAG_UPDATE);
+    game->library.update(game->state);
+    pop_allocation_tag();
 }
 
 static void update(void* udata) {
-    GameLibrary* game_library = (GameLibrary*)udata;
+    Game* game = (Game*)udata;
+    allocation_tracker_begin_frame();
     cf_app_update(&on_cf_app_update);
 
 #if ENGINE_ENABLE_HOT_RELOAD
-    if (reload_flag == 1) {
+    double     settle_ms       = 0.0;
+    const bool library_changed = platform_poll_game_library(&settle_ms);
+    if (reload_flag == 1 || library_changed) {
         reload_flag = 0;
-        APP_DEBUG("Reloading library %s\n", game_library->path);
-
-        void* state = game_library->state();
-        platform_unload_game_library(game_library);
-
-        GameLibrary new_game_library = platform_load_game_library();
-        if (new_game_library.ok) {
-            *game_library = new_game_library;
-            game_library->hot_reload(state);
-        }
+        reload_game_library(game, settle_ms);
     }
 #endif  // ENGINE_ENABLE_HOT_RELOAD
 
     platform_begin_frame();
-    game_library->render();
+    push_allocation_tag(ALLOCATION_TAG_RENDER);
+    game->library.render(game->state);
+    pop_allocation_tag();
     platform_end_frame();
 }
 
-int main(int argc [[maybe_unused]], char* argv[]) {
+// `--soak [minutes]` plays that much game time with the bot, 0 without the flag
+static uint64_t parse_soak_ticks(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--soak") != 0) { continue; }
+
+        int minutes = i + 1 < argc ? atoi(argv[i + 1]) : 0;
+        if (minutes <= 0) { minutes = SOAK_DEFAULT_MINUTES; }
+        return (uint64_t)minutes * 60 * TARGET_FPS;
+    }
+    return 0;
+}
+
+// `--instances N` soaks N game states side by side, 1 without the flag
+static int parse_soak_instances(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--instances") != 0) { continue; }
+
+        const int count = i + 1 < argc ? atoi(argv[i + 1]) : 1;
+        if (count < 1) { return 1; }
+        return count < SOAK_MAX_INSTANCES ? count : SOAK_MAX_INSTANCES;
+    }
+    return 1;
+}
+
+// `--record-draws` renders through gfx's recording backend only, nothing is drawn or presented
+static bool parse_record_draws(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--record-draws") == 0) { return true; }
+    }
+    return false;
+}
+
+static volatile sig_atomic_t soak_stop_flag = 0;
+
+static void soak_sigint_handler(int sig) {
+    (void)sig;
+    soak_stop_flag = 1;
+}
+
+// Ticks back to back as fast as the simulation runs. Nothing is rendered, unless draws are recorded, then every tick
+// renders a frame into the record buffer. Ctrl+C ends the soak early, the shutdown after it still prints the report.
+static void run_soak_test(Game* game, uint64_t ticks, bool record_draws) {
+    // Ticks step by the fixed timestep cute would have set
+    CF_DELTA_TIME = 1.0f / TARGET_FPS;
+
+    // Nothing pumps events here, so SDL's own SIGINT handling would only queue a quit nobody reads
+    void (*previous_handler)(int) = signal(SIGINT, soak_sigint_handler);
+    for (uint64_t tick = 0; tick < ticks && !soak_stop_flag; ++tick) {
+        allocation_tracker_begin_frame();
+        on_cf_app_update(game);
+
+        if (record_draws) {
+            push_allocation_tag(ALLOCATION_TAG_RENDER);
+            game->library.render(game->state);
+            pop_allocation_tag();
+        }
+    }
+    signal(SIGINT, previous_handler);
+
+    if (soak_stop_flag) { APP_INFO("Soak test stopped by SIGINT\n"); }
+}
+
+typedef struct SoakInstance {
+    GameLibrary* library;
+    void*        state;
+    uint64_t     target;   // Ticks to run, SIGINT stops the thread earlier
+    uint64_t     ticks;    // Run so far
+    uint64_t     elapsed;  // Performance counter ticks spent updating, and rendering when draws are recorded
+    bool         record_draws;
+} SoakInstance;
+
+// Thread body, the instance's state is touched by nobody else until the thread is joined
+static int run_soak_instance(void* udata) {
+    SoakInstance*  instance = (SoakInstance*)udata;
+    const uint64_t start    = platform_get_performance_counter();
+
+    while (instance->ticks < instance->target && !soak_stop_flag) {
+        push_allocation_tag(ALLOCATION_TAG_UPDATE);
+        instance->library->update(instance->state);
+        pop_allocation_tag();
+        instance->ticks++;
+
+        // Headless gfx only records, nothing in the frame reaches cute's shared draw state
+        if (instance->record_draws) {
+            push_allocation_tag(ALLOCATION_TAG_RENDER);
+            instance->library->render(instance->state);
+            pop_allocation_tag();
+        }
+    }
+
+    instance->elapsed = platform_get_performance_counter() - start;
+    return 0;
+}
+
+// Initializes and shuts down every instance on this thread, cute's app-wide state is not safe to touch from several.
+// In between each instance ticks on a thread of its own, headless, so nothing but the simulation is shared.
+static void run_soak_instances(GameLibrary* library, Platform* platform, int count, uint64_t ticks, bool record_draws) {
+    CF_DELTA_TIME = 1.0f / TARGET_FPS;
+
+    SoakInstance instances[SOAK_MAX_INSTANCES] = {0};
+    CF_Thread*   threads[SOAK_MAX_INSTANCES]   = {0};
+    for (int i = 0; i < count; ++i) {
+        instances[i] = (SoakInstance){
+            .library      = library,
+            .state        = library->init(platform),
+            .target       = ticks,
+            .record_draws = record_draws,
+        };
+    }
+
+    // No frame begins while the threads run, so the allocation guard stays in warm-up and never reports from them
+    void (*previous_handler)(int) = signal(SIGINT, soak_sigint_handler);
+    const uint64_t start          = platform_get_performance_counter();
+    for (int i = 0; i < count; ++i) { threads[i] = cf_thread_create(run_soak_instance, "soak", &instances[i]); }
+    for (int i = 0; i < count; ++i) { cf_thread_wait(threads[i]); }
+    const uint64_t end = platform_get_performance_counter();
+    signal(SIGINT, previous_handler);
+
+    if (soak_stop_flag) { APP_INFO("Soak test stopped by SIGINT\n"); }
+
+    const double frequency   = (double)platform_get_performance_frequency();
+    uint64_t     total_ticks = 0;
+    for (int i = 0; i < count; ++i) {
+        const SoakInstance* instance = &instances[i];
+        const double        seconds  = (double)instance->elapsed / frequency;
+        total_ticks                 += instance->ticks;
+        APP_INFO(
+            "Soak instance %d: %llu ticks in %.2f s, %.0f ticks/s\n",
+            i,
+            (unsigned long long)instance->ticks,
+            seconds,
+            seconds > 0.0 ? (double)instance->ticks / seconds : 0.0
+        );
+    }
+
+    const double seconds = (double)(end - start) / frequency;
+    APP_INFO(
+        "Soak: %d instances on %d threads ticked %llu times in %.2f s, %.0f ticks/s, %.0f ticks/s per instance\n",
+        count,
+        count,
+        (unsigned long long)total_ticks,
+        seconds,
+        seconds > 0.0 ? (double)total_ticks / seconds : 0.0,
+        seconds > 0.0 ? (double)total_ticks / seconds / count : 0.0
+    );
+
+    for (int i = 0; i < count; ++i) { library->shutdown(instances[i].state); }
+}
+
+int main(int argc, char* argv[]) {
 #if ENGINE_ENABLE_HOT_RELOAD
     signal(SIGHUP, sighup_handler);
 #endif  // ENGINE_ENABLE_HOT_RELOAD
 
-    platform_init(argv[0]);
+    const uint64_t soak_ticks     = parse_soak_ticks(argc, argv);
+    const bool     record_draws   = parse_record_draws(argc, argv);
+    int            soak_instances = parse_soak_instances(argc, argv);
+    const bool     is_headless    = soak_ticks > 0 || record_draws;
+    platform_init(argv[0], is_headless);
+
+    if (soak_instances > 1 && soak_ticks == 0) {
+        APP_WARN("--instances needs --soak, running a single instance\n");
+        soak_instances = 1;
+    }
 
     Platform platform = {
-        .allocate_memory = platform_allocate_memory,
-        .free_memory     = platform_free_memory,
+        .allocate_memory     = platform_allocate_memory,
+        .free_memory         = platform_free_memory,
+        .push_allocation_tag = push_allocation_tag,
+        .pop_allocation_tag  = pop_allocation_tag,
+        .allocations         = get_allocation_tracker(),
+        .log_ring            = get_log_ring(),
+        .is_soak_test        = soak_ticks > 0,
+        .is_recording_draws  = record_draws,
+        .is_headless         = is_headless,
     };
-    GameLibrary game_library = platform_load_game_library();
-    game_library.init(&platform);
+    Game game = {.library = platform_load_game_library()};
+
+#ifndef CF_EMSCRIPTEN
+    if (soak_instances > 1) {
+        run_soak_instances(&game.library, &platform, soak_instances, soak_ticks, record_draws);
+        platform_unload_game_library(&game.library);
+        platform_shutdown();
+        return 0;
+    }
+#endif
+
+    game.state = game.library.init(&platform);
 
-    CF_Color bg = cf_make_color_rgb(0, 0, 0);
-    cf_clear_color(bg.r, bg.g, bg.b, bg.a);
     cf_set_target_framerate(TARGET_FPS);
     cf_set_fixed_timestep(TARGET_FPS);
     cf_app_set_vsync(true);
-    cf_set_update_udata(&game_library);
+    cf_set_update_udata(&game);
 
 #if ENGINE_ENABLE_HOT_RELOAD
     cf_set_assert_handler(debug_handler);
 #endif  // ENGINE_ENABLE_HOT_RELOAD
 
 #ifdef CF_EMSCRIPTEN
-    emscripten_set_main_loop_arg(update, &game_library, TARGET_FPS, true);
+    emscripten_set_main_loop_arg(update, &game, TARGET_FPS, true);
 #else
-    while (cf_app_is_running()) { update(&game_library); }
+    if (soak_ticks > 0) {
+        run_soak_test(&game, soak_ticks, record_draws);
+    } else {
+        while (cf_app_is_running()) { update(&game); }
+    }
 #endif
 
-    game_library.shutdown();
+    game.library.shutdown(game.state);
 
-    platform_unload_game_library(&game_library);
+    platform_unload_game_library(&game.library);
     platform_shutdown();
 
     return 0;
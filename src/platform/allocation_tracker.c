@@ -0,0 +1,188 @@
+#define LOG_CATEGORY LOG_CATEGORY_MEMORY
+
+#include "allocation_tracker.h"
+
+#include <cute_alloc.h>
+#include <cute_c_runtime.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #define ALLOCATION_TRACKER_BACKTRACE 1
+    #include <execinfo.h>
+    #include <unistd.h>
+#else
+    #define ALLOCATION_TRACKER_BACKTRACE 0
+#endif
+
+#include "../engine/log.h"
+
+constexpr int ALLOCATION_TAG_STACK_SIZE     = 16;
+constexpr int ALLOCATION_BACKTRACE_DEPTH    = 16;
+constexpr int ALLOCATION_BACKTRACE_SKIP     = 3;  // report_allocation, track_allocation and the cute hook
+constexpr int ALLOCATION_MAX_REPORTED_SITES = 128;
+
+typedef struct AllocationTagStack {
+    AllocationTag tags[ALLOCATION_TAG_STACK_SIZE];
+    int           count;
+} AllocationTagStack;
+
+// Workers start with an empty stack, so their allocations land in ALLOCATION_TAG_UNTAGGED
+static thread_local AllocationTagStack s_tag_stack;
+static thread_local bool               s_is_reporting;  // Reporting may allocate itself
+
+// Sizes, so a single allocation of 2 GiB or more is counted whole. CF_AtomicInt is only 32-bit.
+static AllocationTracker s_tracker;
+static atomic_size_t     s_frame_counts[ALLOCATION_TAG_COUNT];
+static atomic_size_t     s_frame_bytes[ALLOCATION_TAG_COUNT];
+static atomic_size_t     s_frame_frees;
+static uintptr_t         s_reported_sites[ALLOCATION_MAX_REPORTED_SITES];
+static int               s_reported_site_count;
+
+static AllocationTag get_current_tag(void) {
+    if (s_tag_stack.count == 0) { return ALLOCATION_TAG_UNTAGGED; }
+    return s_tag_stack.tags[s_tag_stack.count - 1];
+}
+
+// Only threads running game frames push the outermost update/render tags, see main.c
+static bool is_inside_game_frame(void) {
+    if (s_tag_stack.count == 0) { return false; }
+    return s_tag_stack.tags[0] == ALLOCATION_TAG_UPDATE || s_tag_stack.tags[0] == ALLOCATION_TAG_RENDER;
+}
+
+// Each callsite is reported once, otherwise a per-frame allocation floods the log
+static bool mark_site_reported(uintptr_t site) {
+    for (int i = 0; i < s_reported_site_count; ++i) {
+        if (s_reported_sites[i] == site) { return false; }
+    }
+    if (s_reported_site_count < ALLOCATION_MAX_REPORTED_SITES) { s_reported_sites[s_reported_site_count++] = site; }
+    return true;
+}
+
+static void report_allocation(AllocationTag tag, size_t size) {
+#if ALLOCATION_TRACKER_BACKTRACE
+    void*     frames[ALLOCATION_BACKTRACE_DEPTH];
+    const int depth = backtrace(frames, ALLOCATION_BACKTRACE_DEPTH);
+    uintptr_t site  = 0;
+    for (int i = ALLOCATION_BACKTRACE_SKIP; i < depth; ++i) { site = site * 31 + (uintptr_t)frames[i]; }
+#else
+    const uintptr_t site = (uintptr_t)tag + 1;
+#endif
+    if (!mark_site_reported(site)) { return; }
+
+    s_tracker.guard_reports++;
+    APP_WARN(
+        "Frame %llu: %zu byte allocation under '%s' after warm-up",
+        (unsigned long long)s_tracker.frame,
+        size,
+        get_allocation_tag_name(tag)
+    );
+#if ALLOCATION_TRACKER_BACKTRACE
+    if (depth > ALLOCATION_BACKTRACE_SKIP) {
+        backtrace_symbols_fd(frames + ALLOCATION_BACKTRACE_SKIP, depth - ALLOCATION_BACKTRACE_SKIP, STDERR_FILENO);
+    }
+#endif
+}
+
+static void track_allocation(size_t size) {
+    const AllocationTag tag = get_current_tag();
+    atomic_fetch_add_explicit(&s_frame_counts[tag], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&s_frame_bytes[tag], size, memory_order_relaxed);
+
+    if (!s_tracker.guard || s_tracker.warmup_frames > 0 || s_is_reporting) { return; }
+    if (tag == ALLOCATION_TAG_DEBUG || !is_inside_game_frame()) { return; }
+
+    s_is_reporting = true;
+    report_allocation(tag, size);
+    s_is_reporting = false;
+}
+
+static void* tracked_alloc(size_t size, void* udata) {
+    (void)udata;
+    track_allocation(size);
+    return malloc(size);
+}
+
+static void tracked_free(void* p, void* udata) {
+    (void)udata;
+    if (p) { atomic_fetch_add_explicit(&s_frame_frees, 1, memory_order_relaxed); }
+    free(p);
+}
+
+static void* tracked_calloc(size_t size, size_t count, void* udata) {
+    (void)udata;
+    track_allocation(size * count);
+    return calloc(count, size);
+}
+
+static void* tracked_realloc(void* p, size_t size, void* udata) {
+    (void)udata;
+    track_allocation(size);
+    return realloc(p, size);
+}
+
+void init_allocation_tracker(void) {
+    s_tracker = (AllocationTracker){.warmup_frames = ALLOCATION_WARMUP_FRAMES};
+#ifdef DEBUG
+    s_tracker.guard = true;
+#endif
+
+    // Cute's default allocator is malloc/free, so blocks handed out before the override can still be freed here
+    cf_allocator_override((CF_Allocator){
+        .alloc_fn   = tracked_alloc,
+        .free_fn    = tracked_free,
+        .calloc_fn  = tracked_calloc,
+        .realloc_fn = tracked_realloc,
+    });
+}
+
+void shutdown_allocation_tracker(void) {
+    allocation_tracker_begin_frame();
+    cf_allocator_restore_default();
+
+    for (int tag = 0; tag < ALLOCATION_TAG_COUNT; ++tag) {
+        if (s_tracker.total.count[tag] == 0) { continue; }
+        APP_INFO(
+            "Allocations under '%s': %zu, %zu bytes",
+            get_allocation_tag_name((AllocationTag)tag),
+            s_tracker.total.count[tag],
+            s_tracker.total.bytes[tag]
+        );
+    }
+    APP_INFO(
+        "Allocation guard reported %zu callsites over %llu frames",
+        s_tracker.guard_reports,
+        (unsigned long long)s_tracker.frame
+    );
+}
+
+void allocation_tracker_begin_frame(void) {
+    auto last  = &s_tracker.last_frame;
+    auto total = &s_tracker.total;
+
+    for (int tag = 0; tag < ALLOCATION_TAG_COUNT; ++tag) {
+        last->count[tag]   = atomic_exchange_explicit(&s_frame_counts[tag], 0, memory_order_relaxed);
+        last->bytes[tag]   = atomic_exchange_explicit(&s_frame_bytes[tag], 0, memory_order_relaxed);
+        total->count[tag] += last->count[tag];
+        total->bytes[tag] += last->bytes[tag];
+    }
+    last->frees   = atomic_exchange_explicit(&s_frame_frees, 0, memory_order_relaxed);
+    total->frees += last->frees;
+
+    s_tracker.frame++;
+    if (s_tracker.warmup_frames > 0) { s_tracker.warmup_frames--; }
+}
+
+void push_allocation_tag(AllocationTag tag) {
+    CF_ASSERT(s_tag_stack.count < ALLOCATION_TAG_STACK_SIZE);
+    s_tag_stack.tags[s_tag_stack.count++] = tag;
+}
+
+void pop_allocation_tag(void) {
+    CF_ASSERT(s_tag_stack.count > 0);
+    s_tag_stack.count--;
+}
+
+AllocationTracker* get_allocation_tracker(void) { return &s_tracker; }
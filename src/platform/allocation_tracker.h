@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../engine/platform.h"
+
+void               init_allocation_tracker(void);
+void               shutdown_allocation_tracker(void);
+void               allocation_tracker_begin_frame(void);
+void               push_allocation_tag(AllocationTag tag);
+void               pop_allocation_tag(void);
+AllocationTracker* get_allocation_tracker(void);
@@ -0,0 +1,155 @@
+#define LOG_CATEGORY LOG_CATEGORY_PLATFORM
+
+#include "library_watcher.h"
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __linux__
+    #define LIBRARY_WATCHER_INOTIFY 1
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#else
+    #define LIBRARY_WATCHER_INOTIFY 0
+#endif
+
+#include "../engine/log.h"
+
+constexpr uint64_t NS_PER_MS                  = 1000000;
+constexpr int      LIBRARY_WATCHER_EVENT_SIZE = 4096;
+
+static void mark_changed(LibraryWatcher* watcher, uint64_t now) {
+    if (!watcher->is_pending) { watcher->first_change_ns = now; }
+    watcher->is_pending     = true;
+    watcher->last_change_ns = now;
+}
+
+// Waits for a quiet period in which the file exists and neither its size nor modification time moved
+static bool has_settled(LibraryWatcher* watcher, uint64_t now) {
+    if (now - watcher->last_change_ns < LIBRARY_WATCHER_DEBOUNCE_MS * NS_PER_MS) { return false; }
+
+    // The file can be missing or empty for a moment while the linker replaces it
+    SDL_PathInfo info;
+    if (!SDL_GetPathInfo(watcher->path, &info) || info.size == 0) {
+        watcher->last_change_ns = now;
+        return false;
+    }
+
+    if (info.size != watcher->size || info.modify_time != watcher->modify_time) {
+        watcher->size           = info.size;
+        watcher->modify_time    = info.modify_time;
+        watcher->last_change_ns = now;
+        return false;
+    }
+
+    return true;
+}
+
+static void poll_modify_time(LibraryWatcher* watcher, uint64_t now) {
+    if (now < watcher->next_poll_ns) { return; }
+    watcher->next_poll_ns = now + LIBRARY_WATCHER_POLL_INTERVAL * NS_PER_MS;
+
+    SDL_PathInfo info;
+    if (!SDL_GetPathInfo(watcher->path, &info)) { return; }
+    if (info.size != watcher->size || info.modify_time != watcher->modify_time) { mark_changed(watcher, now); }
+}
+
+#if LIBRARY_WATCHER_INOTIFY
+static const char* get_file_name(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+static bool init_inotify(LibraryWatcher* watcher) {
+    char directory[LIBRARY_WATCHER_PATH_SIZE];
+    SDL_strlcpy(directory, watcher->path, sizeof(directory));
+
+    char* slash = strrchr(directory, '/');
+    if (slash == nullptr) { return false; }
+    slash[slash == directory ? 1 : 0] = '\0';
+
+    watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watcher->fd < 0) { return false; }
+
+    // The directory, not the file: a linker that writes a new file and renames it over the old one would otherwise
+    // leave the watch on the deleted inode
+    watcher->watch = inotify_add_watch(watcher->fd, directory, IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO);
+    if (watcher->watch < 0) {
+        close(watcher->fd);
+        watcher->fd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+static void read_inotify_events(LibraryWatcher* watcher, uint64_t now) {
+    const char* file_name = get_file_name(watcher->path);
+    alignas(struct inotify_event) char buffer[LIBRARY_WATCHER_EVENT_SIZE];
+
+    // Non-blocking, read() fails with EAGAIN once the queue is drained
+    ssize_t length;
+    while ((length = read(watcher->fd, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t offset = 0; offset < length;) {
+            const struct inotify_event* event = (const struct inotify_event*)(buffer + offset);
+            if (event->len > 0 && strcmp(event->name, file_name) == 0) { mark_changed(watcher, now); }
+            offset += (ssize_t)(sizeof(struct inotify_event) + event->len);
+        }
+    }
+}
+#endif  // LIBRARY_WATCHER_INOTIFY
+
+bool init_library_watcher(LibraryWatcher* watcher, const char* path) {
+    *watcher = (LibraryWatcher){.fd = -1, .watch = -1};
+    SDL_strlcpy(watcher->path, path, sizeof(watcher->path));
+
+    SDL_PathInfo info;
+    if (!SDL_GetPathInfo(path, &info)) {
+        APP_WARN("Could not watch %s: %s\n", path, SDL_GetError());
+        return false;
+    }
+    watcher->size        = info.size;
+    watcher->modify_time = info.modify_time;
+
+#if LIBRARY_WATCHER_INOTIFY
+    if (init_inotify(watcher)) {
+        APP_INFO("Watching %s with inotify\n", path);
+        return true;
+    }
+#endif
+
+    APP_INFO("Watching %s every %d ms\n", path, LIBRARY_WATCHER_POLL_INTERVAL);
+    return true;
+}
+
+void shutdown_library_watcher(LibraryWatcher* watcher) {
+#if LIBRARY_WATCHER_INOTIFY
+    if (watcher->fd >= 0) { close(watcher->fd); }
+#endif
+    watcher->fd    = -1;
+    watcher->watch = -1;
+}
+
+bool poll_library_watcher(LibraryWatcher* watcher, uint64_t* first_change_ns) {
+    const uint64_t now = SDL_GetTicksNS();
+
+#if LIBRARY_WATCHER_INOTIFY
+    if (watcher->fd >= 0) {
+        read_inotify_events(watcher, now);
+    } else {
+        poll_modify_time(watcher, now);
+    }
+#else
+    poll_modify_time(watcher, now);
+#endif
+
+    if (!watcher->is_pending || !has_settled(watcher, now)) { return false; }
+
+    watcher->is_pending = false;
+    if (first_change_ns) { *first_change_ns = watcher->first_change_ns; }
+    return true;
+}
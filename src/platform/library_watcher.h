@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+constexpr int LIBRARY_WATCHER_PATH_SIZE     = 1024;
+constexpr int LIBRARY_WATCHER_DEBOUNCE_MS   = 100;  // Quiet time after the last write before the library counts as done
+constexpr int LIBRARY_WATCHER_POLL_INTERVAL = 250;  // Milliseconds between stat() calls where inotify is unavailable
+
+/*
+ * Library Watcher
+ *
+ * Notices when the linker rewrites the game library. On Linux it watches the library's directory with inotify,
+ * since linkers often replace the file instead of writing it in place; elsewhere it polls the modification time.
+ * A burst of writes is reported once, after it has been quiet for LIBRARY_WATCHER_DEBOUNCE_MS and the file size
+ * stopped changing.
+ */
+typedef struct LibraryWatcher {
+    char     path[LIBRARY_WATCHER_PATH_SIZE];
+    int      fd;     // inotify instance, -1 when polling
+    int      watch;  // Watch descriptor of the library's directory
+    bool     is_pending;
+    uint64_t first_change_ns;  // First write of the current burst, where the reload latency starts
+    uint64_t last_change_ns;
+    uint64_t next_poll_ns;
+    uint64_t size;
+    int64_t  modify_time;
+} LibraryWatcher;
+
+bool init_library_watcher(LibraryWatcher* watcher, const char* path);
+void shutdown_library_watcher(LibraryWatcher* watcher);
+bool poll_library_watcher(LibraryWatcher* watcher, uint64_t* first_change_ns);
@@ -1,3 +1,5 @@
+#define LOG_CATEGORY LOG_CATEGORY_PLATFORM
+
 #include "platform_cute.h"
 
 #include <SDL3/SDL_error.h>
@@ -17,6 +19,8 @@
 
 #include "../engine/common.h"
 #include "../engine/log.h"
+#include "allocation_tracker.h"
+#include "library_watcher.h"
 
 constexpr int MAX_PATH_LENGTH = 1024;
 
@@ -27,16 +31,30 @@ constexpr int MAX_PATH_LENGTH = 1024;
 char         game_library_path[MAX_PATH_LENGTH] = {0};
 SDL_PathInfo path_info;
 
-static void mount_content_directory_as(const char* dir) {
+#if ENGINE_ENABLE_HOT_RELOAD
+static LibraryWatcher s_library_watcher;
+static int            s_library_version;
+#endif
+
+static bool s_is_headless;
+
+// `append` false puts the directory in front of the ones already mounted, so its files win
+static bool mount_directory_as(const char* name, const char* dir, bool append) {
     const char* path = SDL_GetBasePath();
     cf_path_normalize(path);
     char full_path[MAX_PATH_LENGTH];
-    SDL_snprintf(full_path, MAX_PATH_LENGTH, "%s%s", path, "assets");
-    APP_INFO("Mounting content directory %s as %s\n", full_path, dir);
-    cf_fs_mount(full_path, dir, true);
+    SDL_snprintf(full_path, MAX_PATH_LENGTH, "%s%s", path, name);
+    APP_INFO("Mounting directory %s as %s\n", full_path, dir);
+    return !cf_is_error(cf_fs_mount(full_path, dir, append));
 }
 
-void platform_init(const char* argv0) {
+void platform_init(const char* argv0, bool is_headless) {
+    // Before cute makes the app, so its startup allocations are counted too
+    init_allocation_tracker();
+    start_log_thread();
+
+    s_is_headless = is_headless;
+
     SDL_SetAppMetadataProperty(SDL_PROP_APP_METADATA_NAME_STRING, "Raptor");
     SDL_SetAppMetadataProperty(SDL_PROP_APP_METADATA_VERSION_STRING, "0.1.0");
     SDL_SetAppMetadataProperty(SDL_PROP_APP_METADATA_TYPE_STRING, "game");
@@ -46,7 +64,11 @@ void platform_init(const char* argv0) {
 
     const int window_width  = 180;
     const int window_height = 320;
-    const int options       = CF_APP_OPTIONS_WINDOW_POS_CENTERED_BIT | CF_APP_OPTIONS_RESIZABLE_BIT;
+    int       options       = CF_APP_OPTIONS_WINDOW_POS_CENTERED_BIT | CF_APP_OPTIONS_RESIZABLE_BIT;
+    // No GPU device or audio mixer, headless game instances only record their draws
+    if (is_headless) {
+        options |= CF_APP_OPTIONS_HIDDEN_BIT | CF_APP_OPTIONS_NO_GFX_BIT | CF_APP_OPTIONS_NO_AUDIO_BIT;
+    }
     CF_Result result = cf_make_app("Raptor", cf_default_display(), 0, 0, window_width, window_height, options, argv0);
 
     if (cf_is_error(result)) {
@@ -54,16 +76,34 @@ void platform_init(const char* argv0) {
         CF_ASSERT(false);
     }
 
-    mount_content_directory_as("/assets");
+    mount_directory_as("assets", "/assets", true);
+    // Written by the bake_assets target, cross builds have none and load every asset from its own file
+    if (!mount_directory_as("baked", "/assets", false)) { APP_DEBUG("No baked assets next to the executable\n"); }
 }
 
-void platform_shutdown(void) { cf_destroy_app(); }
+void platform_shutdown(void) {
+#if ENGINE_ENABLE_HOT_RELOAD
+    shutdown_library_watcher(&s_library_watcher);
+#endif
+    cf_destroy_app();
+    stop_log_thread();
+    shutdown_allocation_tracker();
+}
 
-void* platform_allocate_memory(size_t size) { return cf_calloc(size, 1); }
-void  platform_free_memory(void* p) { cf_free(p); }
+void* platform_allocate_memory(size_t size) {
+    push_allocation_tag(ALLOCATION_TAG_GAME_STATE);
+    void* memory = cf_calloc(size, 1);
+    pop_allocation_tag();
+    return memory;
+}
+
+void platform_free_memory(void* p) { cf_free(p); }
 
 void platform_begin_frame(void) {}
-void platform_end_frame(void) { cf_app_draw_onto_screen(true); }
+void platform_end_frame(void) {
+    // Nothing was submitted to cute, so there is no canvas to blit or window to present
+    if (!s_is_headless) { cf_app_draw_onto_screen(true); }
+}
 
 #if ENGINE_ENABLE_HOT_RELOAD
 
@@ -84,7 +124,19 @@ GameLibrary platform_load_game_library(void) {
         CF_ASSERT(false);
     }
 
-    game_library.path    = game_library_path;
+    if (s_library_version == 0) { init_library_watcher(&s_library_watcher, game_library_path); }
+
+    // Load a versioned copy: the linker can rewrite the original while it is mapped, and the new version has to
+    // load next to the old one so a broken build leaves the game running
+    s_library_version++;
+    SDL_snprintf(
+        game_library.path, sizeof(game_library.path), "%sreload-%d-%s", base_path, s_library_version, game_library_name
+    );
+    if (!SDL_CopyFile(game_library_path, game_library.path)) {
+        APP_ERROR("Failed to copy %s to %s: %s\n", game_library_path, game_library.path, SDL_GetError());
+        game_library.path[0] = '\0';
+        return game_library;
+    }
 
     game_library.library = cf_load_shared_library(game_library.path);
     if (!game_library.library) {
@@ -116,8 +168,8 @@ GameLibrary platform_load_game_library(void) {
         return game_library;
     }
 
-    game_library.state = (GameStateFunction)cf_load_function(game_library.library, "game_state");
-    if (!game_library.state) {
+    game_library.unload = (GameUnloadFunction)cf_load_function(game_library.library, "game_unload");
+    if (!game_library.unload) {
         APP_WARN("Failed to load function: %s\n", SDL_GetError());
         return game_library;
     }
@@ -135,9 +187,12 @@ GameLibrary platform_load_game_library(void) {
 
 void platform_unload_game_library(GameLibrary* game_library) {
     APP_DEBUG("Unloading library %s\n", game_library->path);
-    cf_unload_shared_library(game_library->library);
+    // Queued records point at format strings inside the library
+    flush_log();
+    if (game_library->library) { cf_unload_shared_library(game_library->library); }
+    if (game_library->path[0] != '\0') { SDL_RemovePath(game_library->path); }
     game_library->hot_reload = nullptr;
-    game_library->state      = nullptr;
+    game_library->unload     = nullptr;
     game_library->shutdown   = nullptr;
     game_library->render     = nullptr;
     game_library->update     = nullptr;
@@ -146,15 +201,23 @@ void platform_unload_game_library(GameLibrary* game_library) {
     game_library->ok         = false;
 }
 
+bool platform_poll_game_library(double* settle_ms) {
+    uint64_t first_change_ns = 0;
+    if (!poll_library_watcher(&s_library_watcher, &first_change_ns)) { return false; }
+
+    *settle_ms = (double)(SDL_GetTicksNS() - first_change_ns) / 1e6;
+    return true;
+}
+
 #else   // ENGINE_ENABLE_HOT_RELOAD
 
 // Declare game functions as extern (linked statically)
-extern void  game_init(Platform* platform);
-extern bool  game_update(void);
-extern void  game_render(void);
-extern void* game_state(void);
-extern void  game_hot_reload(void* state);
-extern void  game_shutdown(void);
+extern void* game_init(Platform* platform);
+extern bool  game_update(void* game_state);
+extern void  game_render(void* game_state);
+extern void* game_hot_reload(void* game_state);
+extern void  game_unload(void* game_state);
+extern void  game_shutdown(void* game_state);
 
 GameLibrary platform_load_game_library(void) {
     GameLibrary game_library = {0};
@@ -162,11 +225,11 @@ GameLibrary platform_load_game_library(void) {
     game_library.update      = game_update;
     game_library.render      = game_render;
     game_library.shutdown    = game_shutdown;
-    game_library.state       = game_state;
+    game_library.unload      = game_unload;
     game_library.hot_reload  = game_hot_reload;
     game_library.ok          = true;
-    game_library.path        = "built-in";
     game_library.library     = nullptr;
+    SDL_strlcpy(game_library.path, "built-in", sizeof(game_library.path));
     return game_library;
 }
 
@@ -174,6 +237,11 @@ void platform_unload_game_library(GameLibrary* game_library) {
     (void)game_library;  // No-op when static
 }
 
+bool platform_poll_game_library(double* settle_ms) {
+    (void)settle_ms;
+    return false;
+}
+
 #endif  // ENGINE_ENABLE_HOT_RELOAD
 
 uint64_t platform_get_performance_counter(void) { return SDL_GetPerformanceCounter(); }
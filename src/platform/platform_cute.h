@@ -5,28 +5,31 @@
 
 typedef struct Platform Platform;
 
-typedef void (*GameInitFunction)(Platform* platform);
-typedef bool (*GameUpdateFunction)(void);
-typedef void (*GameRenderFunction)(void);
-typedef void (*GameShutdownFunction)(void);
-typedef void* (*GameStateFunction)(void);
-typedef void (*GameHotReloadFunction)(void* game_state);
+constexpr int GAME_LIBRARY_PATH_LENGTH = 1024;
+
+// Every function but init takes the instance game_init() returned, so several can run side by side
+typedef void* (*GameInitFunction)(Platform* platform);
+typedef bool (*GameUpdateFunction)(void* game_state);
+typedef void (*GameRenderFunction)(void* game_state);
+typedef void (*GameShutdownFunction)(void* game_state);
+typedef void (*GameUnloadFunction)(void* game_state);      // Called on the old library before it is unloaded
+typedef void* (*GameHotReloadFunction)(void* game_state);  // Returns the instance to use from now on
 
 typedef struct GameLibrary {
-    void*       library;
-    const char* path;
+    void* library;
+    char  path[GAME_LIBRARY_PATH_LENGTH];  // Owned, each loaded copy has its own file until it is unloaded
 
     GameInitFunction      init;
     GameUpdateFunction    update;
     GameRenderFunction    render;
     GameShutdownFunction  shutdown;
-    GameStateFunction     state;
+    GameUnloadFunction    unload;
     GameHotReloadFunction hot_reload;
 
     bool ok;
 } GameLibrary;
 
-void platform_init(const char* argv0);
+void platform_init(const char* argv0, bool is_headless);  // Headless makes no GPU device or mixer, presents nothing
 void platform_shutdown(void);
 
 void* platform_allocate_memory(size_t size);
@@ -37,6 +40,7 @@ void platform_end_frame(void);
 
 GameLibrary platform_load_game_library(void);
 void        platform_unload_game_library(GameLibrary* game_library);
+bool        platform_poll_game_library(double* settle_ms);  // True once a rebuilt library has been fully written
 
 uint64_t platform_get_performance_counter(void);
 uint64_t platform_get_performance_frequency(void);
@@ -0,0 +1,343 @@
+/*
+ * Asset Baker
+ *
+ * Packs sprites into SPRITE_PACK_PATH so the game can load them with a single read:
+ *
+ *   asset_baker <output> <root> <path>...
+ *
+ * Every <path> is relative to <root> and is stored under that name, so it matches the paths in s_sprite_files.
+ *
+ * PNGs and Aseprite files are decoded here, every frame is packed into one RGBA atlas and the animation tags become
+ * tables next to it, so the game copies pixels out of the atlas instead of running a decoder. Aseprite files with
+ * slices are refused, the pack has no room for their pivots and borders.
+ */
+
+#define CUTE_ASEPRITE_IMPLEMENTATION
+#include <cute/cute_aseprite.h>
+#include <cute_image.h>
+#include <cute_result.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../engine/common.h"
+#include "../game/asset/sprite_pack.h"
+#include "../game/asset/utils.h"
+
+constexpr int MAX_PATH_LENGTH = 1024;
+constexpr int MAX_SPRITES     = 256;
+constexpr int MAX_FRAMES      = 4096;
+constexpr int MAX_ANIMATIONS  = 1024;
+constexpr int MAX_ATLAS_SIZE  = UINT16_MAX;
+
+// One decoded source file, frames are w * h RGBA8 pixels each
+typedef struct BakedSprite {
+    SpritePackSprite entry;
+    uint8_t**        frames;
+    uint16_t*        durations;
+} BakedSprite;
+
+static SpritePackFrame     s_frames[MAX_FRAMES];
+static SpritePackAnimation s_animations[MAX_ANIMATIONS];
+static int                 s_frame_count;
+static int                 s_animation_count;
+
+static uint8_t* read_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) { return nullptr; }
+
+    fseek(file, 0, SEEK_END);
+    const long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t* data = length > 0 ? malloc((size_t)length) : nullptr;
+    if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+        free(data);
+        data = nullptr;
+    }
+    fclose(file);
+
+    *size = data ? (size_t)length : 0;
+    return data;
+}
+
+static void* allocate(size_t size) {
+    void* memory = malloc(size);
+    if (memory == nullptr) {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static uint8_t* copy_pixels(const void* pixels, int w, int h) {
+    const size_t size = (size_t)w * (size_t)h * sizeof(CF_Pixel);
+    uint8_t*     copy = allocate(size);
+    memcpy(copy, pixels, size);
+    return copy;
+}
+
+static bool begin_sprite(BakedSprite* sprite, int w, int h, int frame_count) {
+    if (w <= 0 || h <= 0 || w > MAX_ATLAS_SIZE || h > MAX_ATLAS_SIZE) { return false; }
+    if (s_frame_count + frame_count > MAX_FRAMES) {
+        fprintf(stderr, "Too many frames, at most %d\n", MAX_FRAMES);
+        return false;
+    }
+
+    sprite->entry.w           = (uint16_t)w;
+    sprite->entry.h           = (uint16_t)h;
+    sprite->entry.first_frame = (uint16_t)s_frame_count;
+    sprite->entry.frame_count = (uint16_t)frame_count;
+    sprite->frames            = allocate((size_t)frame_count * sizeof(*sprite->frames));
+    sprite->durations         = allocate((size_t)frame_count * sizeof(*sprite->durations));
+    s_frame_count            += frame_count;
+    return true;
+}
+
+static bool add_animation(BakedSprite* sprite, const char* name, int from, int to, int direction) {
+    if (s_animation_count >= MAX_ANIMATIONS) {
+        fprintf(stderr, "Too many animations, at most %d\n", MAX_ANIMATIONS);
+        return false;
+    }
+    if (strlen(name) >= SPRITE_PACK_ANIMATION_SIZE) {
+        fprintf(stderr, "Animation name too long for the pack: %s\n", name);
+        return false;
+    }
+
+    auto animation = &s_animations[s_animation_count++];
+    strncpy(animation->name, name, SPRITE_PACK_ANIMATION_SIZE - 1);
+    animation->from_frame = (uint16_t)from;
+    animation->to_frame   = (uint16_t)to;
+    animation->direction  = (uint8_t)direction;
+
+    if (sprite->entry.animation_count == 0) { sprite->entry.first_animation = (uint16_t)(s_animation_count - 1); }
+    sprite->entry.animation_count++;
+    return true;
+}
+
+static bool bake_png(BakedSprite* sprite, const uint8_t* data, size_t size) {
+    CF_Image  image  = {0};
+    CF_Result result = cf_image_load_png_from_memory(data, (int)size, &image);
+    if (cf_is_error(result)) { return false; }
+
+    const bool ok = begin_sprite(sprite, image.w, image.h, 1);
+    if (ok) {
+        sprite->frames[0]    = copy_pixels(image.pix, image.w, image.h);
+        sprite->durations[0] = 0;
+    }
+    cf_image_free(&image);
+    return ok;
+}
+
+static bool bake_aseprite(BakedSprite* sprite, const uint8_t* data, size_t size, const char* path) {
+    ase_t* ase = cute_aseprite_load_from_memory(data, (int)size, nullptr);
+    if (ase == nullptr) { return false; }
+
+    bool ok = ase->slice_count == 0;
+    if (!ok) { fprintf(stderr, "%s has slices, leave it out of the pack to load it from its own file\n", path); }
+
+    ok = ok && begin_sprite(sprite, ase->w, ase->h, ase->frame_count);
+    for (int i = 0; ok && i < ase->frame_count; ++i) {
+        // cute_aseprite already blended the visible layers, ase_color_t is laid out as RGBA8 like CF_Pixel
+        sprite->frames[i]    = copy_pixels(ase->frames[i].pixels, ase->w, ase->h);
+        sprite->durations[i] = (uint16_t)ase->frames[i].duration_milliseconds;
+    }
+
+    // Like cute's own loader, a file without tags plays all of its frames as "default"
+    if (ok && ase->tag_count == 0) { ok = add_animation(sprite, "default", 0, ase->frame_count - 1, 0); }
+    for (int i = 0; ok && i < ase->tag_count; ++i) {
+        const ase_tag_t* tag = &ase->tags[i];
+        ok = add_animation(sprite, tag->name, tag->from_frame, tag->to_frame, (int)tag->loop_animation_direction);
+    }
+
+    cute_aseprite_free(ase);
+    return ok;
+}
+
+static int compare_by_height(const void* a, const void* b) {
+    const BakedSprite* const* left  = a;
+    const BakedSprite* const* right = b;
+    return (int)(*right)->entry.h - (int)(*left)->entry.h;
+}
+
+// Shelf packing, tallest sprites first, into the narrowest power of two width that keeps the atlas about square
+static bool pack_atlas(BakedSprite* sprites, int sprite_count, int* atlas_w, int* atlas_h) {
+    static BakedSprite* order[MAX_SPRITES];
+
+    size_t area  = 0;
+    int    width = 1;
+    for (int i = 0; i < sprite_count; ++i) {
+        order[i] = &sprites[i];
+        area    += (size_t)sprites[i].entry.w * sprites[i].entry.h * sprites[i].entry.frame_count;
+        while (width < sprites[i].entry.w) { width *= 2; }
+    }
+    while ((size_t)width * width < area) { width *= 2; }
+    qsort(order, (size_t)sprite_count, sizeof(order[0]), compare_by_height);
+
+    int x            = 0;
+    int y            = 0;
+    int shelf_height = 0;
+    for (int i = 0; i < sprite_count; ++i) {
+        const SpritePackSprite* entry = &order[i]->entry;
+        for (int f = 0; f < entry->frame_count; ++f) {
+            if (x + entry->w > width) {
+                x            = 0;
+                y           += shelf_height;
+                shelf_height = 0;
+            }
+
+            s_frames[entry->first_frame + f] = (SpritePackFrame){
+                .x           = (uint16_t)x,
+                .y           = (uint16_t)y,
+                .duration_ms = order[i]->durations[f],
+            };
+            x            += entry->w;
+            shelf_height  = shelf_height > entry->h ? shelf_height : entry->h;
+        }
+    }
+
+    *atlas_w = width;
+    *atlas_h = y + shelf_height;
+    return width <= MAX_ATLAS_SIZE && *atlas_h <= MAX_ATLAS_SIZE;
+}
+
+static uint8_t* blit_atlas(const BakedSprite* sprites, int sprite_count, int atlas_w, int atlas_h) {
+    const size_t pitch = (size_t)atlas_w * sizeof(CF_Pixel);
+    uint8_t*     atlas = calloc((size_t)atlas_h, pitch);
+    if (atlas == nullptr) { return nullptr; }
+
+    for (int i = 0; i < sprite_count; ++i) {
+        const SpritePackSprite* entry = &sprites[i].entry;
+        const size_t            row   = (size_t)entry->w * sizeof(CF_Pixel);
+        for (int f = 0; f < entry->frame_count; ++f) {
+            const SpritePackFrame* frame = &s_frames[entry->first_frame + f];
+            for (int y = 0; y < entry->h; ++y) {
+                uint8_t* destination = atlas + (size_t)(frame->y + y) * pitch + (size_t)frame->x * sizeof(CF_Pixel);
+                memcpy(destination, sprites[i].frames[f] + (size_t)y * row, row);
+            }
+        }
+    }
+    return atlas;
+}
+
+static size_t align_up(size_t value) {
+    return (value + SPRITE_PACK_ALIGNMENT - 1) & ~(size_t)(SPRITE_PACK_ALIGNMENT - 1);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <output> <root> <path>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* output_path  = argv[1];
+    const char* root         = argv[2];
+    const int   sprite_count = argc - 3;
+
+    if (sprite_count > MAX_SPRITES) {
+        fprintf(stderr, "Too many sprites: %d, at most %d\n", sprite_count, MAX_SPRITES);
+        return EXIT_FAILURE;
+    }
+
+    static BakedSprite sprites[MAX_SPRITES];
+
+    for (int i = 0; i < sprite_count; ++i) {
+        const char* path = argv[i + 3];
+        if (strlen(path) >= SPRITE_PACK_PATH_SIZE) {
+            fprintf(stderr, "Path too long for the pack: %s\n", path);
+            return EXIT_FAILURE;
+        }
+
+        char full_path[MAX_PATH_LENGTH];
+        snprintf(full_path, countof(full_path), "%s/%s", root, path);
+
+        size_t   size = 0;
+        uint8_t* data = read_file(full_path, &size);
+        if (data == nullptr) {
+            fprintf(stderr, "Could not read %s\n", full_path);
+            return EXIT_FAILURE;
+        }
+
+        auto sprite = &sprites[i];
+        strncpy(sprite->entry.path, path, SPRITE_PACK_PATH_SIZE - 1);
+
+        bool baked = false;
+        if (has_extension(path, "png")) {
+            baked = bake_png(sprite, data, size);
+        } else if (has_extension(path, "ase") || has_extension(path, "aseprite")) {
+            baked = bake_aseprite(sprite, data, size, path);
+        }
+        free(data);
+
+        if (!baked) {
+            fprintf(stderr, "Could not bake %s\n", full_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    int atlas_w = 0;
+    int atlas_h = 0;
+    if (!pack_atlas(sprites, sprite_count, &atlas_w, &atlas_h)) {
+        fprintf(stderr, "Sprites do not fit in a %dx%d atlas\n", MAX_ATLAS_SIZE, MAX_ATLAS_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    uint8_t* atlas = blit_atlas(sprites, sprite_count, atlas_w, atlas_h);
+    if (atlas == nullptr) {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    const size_t tables_size = sizeof(SpritePackHeader) + (size_t)sprite_count * sizeof(SpritePackSprite) +
+                               (size_t)s_frame_count * sizeof(SpritePackFrame) +
+                               (size_t)s_animation_count * sizeof(SpritePackAnimation);
+    const size_t atlas_offset = align_up(tables_size);
+    const size_t atlas_size   = (size_t)atlas_w * (size_t)atlas_h * sizeof(CF_Pixel);
+
+    FILE* file = fopen(output_path, "wb");
+    if (file == nullptr) {
+        fprintf(stderr, "Could not open %s for writing\n", output_path);
+        return EXIT_FAILURE;
+    }
+
+    const SpritePackHeader header = {
+        .magic           = SPRITE_PACK_MAGIC,
+        .version         = SPRITE_PACK_VERSION,
+        .sprite_count    = (uint32_t)sprite_count,
+        .frame_count     = (uint32_t)s_frame_count,
+        .animation_count = (uint32_t)s_animation_count,
+        .atlas_w         = (uint16_t)atlas_w,
+        .atlas_h         = (uint16_t)atlas_h,
+        .atlas_offset    = (uint32_t)atlas_offset,
+    };
+    fwrite(&header, sizeof(header), 1, file);
+    for (int i = 0; i < sprite_count; ++i) { fwrite(&sprites[i].entry, sizeof(SpritePackSprite), 1, file); }
+    fwrite(s_frames, sizeof(SpritePackFrame), (size_t)s_frame_count, file);
+    fwrite(s_animations, sizeof(SpritePackAnimation), (size_t)s_animation_count, file);
+
+    static const uint8_t padding[SPRITE_PACK_ALIGNMENT] = {0};
+    fwrite(padding, 1, atlas_offset - tables_size, file);
+    fwrite(atlas, 1, atlas_size, file);
+    free(atlas);
+
+    const bool ok = ferror(file) == 0;
+    fclose(file);
+
+    if (!ok) {
+        fprintf(stderr, "Could not write %s\n", output_path);
+        return EXIT_FAILURE;
+    }
+
+    printf(
+        "Baked %d sprites, %d frames into a %dx%d atlas in %s (%zu bytes)\n",
+        sprite_count,
+        s_frame_count,
+        atlas_w,
+        atlas_h,
+        output_path,
+        atlas_offset + atlas_size
+    );
+    return EXIT_SUCCESS;
+}
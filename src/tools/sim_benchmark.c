@@ -0,0 +1,145 @@
+/*
+ * Simulation Math Benchmark
+ *
+ * Runs the gameplay math of a busy late wave through sim_math.h: movement, timers, bullet against enemy AABBs and
+ * particle bursts. Built twice, as sim_benchmark_float and sim_benchmark_fixed, so the two paths can be compared:
+ *
+ *   sim_benchmark_fixed [ticks]
+ *
+ * The checksum covers the final state bits. The fixed build prints the same one on every machine.
+ */
+
+#include <cute_math.h>
+#include <cute_rnd.h>
+#include <cute_time.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../engine/common.h"
+#include "../game/movement.h"
+#include "../game/sim_math.h"
+
+constexpr int BENCHMARK_DEFAULT_TICKS = 100000;
+constexpr int BENCHMARK_ENEMIES       = 128;  // MAX_ENEMIES
+constexpr int BENCHMARK_BULLETS       = 32;   // MAX_PLAYER_BULLETS
+constexpr int BENCHMARK_PARTICLES     = 320;  // MAX_EXPLOSION_PARTICLES
+constexpr int BENCHMARK_BURST         = 10;   // Particles per kill, spawned every tick
+
+typedef struct Body {
+    CF_V2 position;
+    CF_V2 velocity;
+    CF_V2 half_extents;
+    float timer;
+} Body;
+
+static Body s_enemies[BENCHMARK_ENEMIES];
+static Body s_bullets[BENCHMARK_BULLETS];
+static Body s_particles[BENCHMARK_PARTICLES];
+static int  s_next_particle;  // Oldest particle, overwritten by the next burst
+
+static void reset_bodies(CF_Rnd* rnd) {
+    for (int i = 0; i < BENCHMARK_ENEMIES; ++i) {
+        s_enemies[i] = (Body){
+            .position     = cf_v2(sim_rnd_range(rnd, -90.0f, 90.0f), sim_rnd_range(rnd, 0.0f, 160.0f)),
+            .velocity     = cf_v2(0.0f, -0.5f),
+            .half_extents = cf_v2(6.0f, 6.0f),
+        };
+    }
+    for (int i = 0; i < BENCHMARK_BULLETS; ++i) {
+        s_bullets[i] = (Body){
+            .position     = cf_v2(sim_rnd_range(rnd, -90.0f, 90.0f), sim_rnd_range(rnd, -160.0f, 0.0f)),
+            .velocity     = cf_v2(0.0f, 3.0f),
+            .half_extents = cf_v2(1.0f, 3.0f),
+        };
+    }
+}
+
+// Keeps everything on the canvas, so the workload stays the same from the first tick to the last
+static void wrap(Body* body) {
+    if (body->position.y > 160.0f) { body->position.y = sim_add(body->position.y, -320.0f); }
+    if (body->position.y < -160.0f) { body->position.y = sim_add(body->position.y, 320.0f); }
+}
+
+static void run_tick(CF_Rnd* rnd, int tick) {
+    for (int i = 0; i < BENCHMARK_ENEMIES; ++i) {
+        update_movement(&s_enemies[i].position, &s_enemies[i].velocity);
+        sim_count_up(&s_enemies[i].timer);
+        wrap(&s_enemies[i]);
+    }
+
+    int hits = 0;
+    for (int i = 0; i < BENCHMARK_BULLETS; ++i) {
+        update_movement(&s_bullets[i].position, &s_bullets[i].velocity);
+        wrap(&s_bullets[i]);
+
+        const SimAabb bullet_aabb = sim_make_aabb(s_bullets[i].position, s_bullets[i].half_extents);
+        for (int j = 0; j < BENCHMARK_ENEMIES; ++j) {
+            if (sim_aabb_to_aabb(bullet_aabb, sim_make_aabb(s_enemies[j].position, s_enemies[j].half_extents))) {
+                hits++;
+                break;
+            }
+        }
+    }
+
+    // A burst every tick and one more per hit, spread around the reversed bullet direction like hit debris
+    for (int burst = 0; burst <= hits; ++burst) {
+        const Body* source = &s_bullets[(tick + burst) % BENCHMARK_BULLETS];
+        const float base   = sim_atan2(-source->velocity.y, -source->velocity.x);
+        for (int i = 0; i < BENCHMARK_BURST; ++i) {
+            Body*       particle = &s_particles[s_next_particle];
+            const float angle    = sim_add(base, sim_rnd_range(rnd, -0.5f, 0.5f));
+            particle->position   = source->position;
+            particle->velocity   = sim_polar(angle, sim_rnd_range(rnd, 0.5f, 2.0f));
+            particle->timer      = 0.0f;
+            s_next_particle      = (s_next_particle + 1) % BENCHMARK_PARTICLES;
+        }
+    }
+
+    for (int i = 0; i < BENCHMARK_PARTICLES; ++i) {
+        update_movement(&s_particles[i].position, &s_particles[i].velocity);
+        sim_count_up(&s_particles[i].timer);
+    }
+}
+
+// FNV-1a over the bytes of every body
+static uint64_t checksum_bodies(void) {
+    const Body* const arrays[] = {s_enemies, s_bullets, s_particles};
+    const size_t      counts[] = {BENCHMARK_ENEMIES, BENCHMARK_BULLETS, BENCHMARK_PARTICLES};
+
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t a = 0; a < countof(arrays); ++a) {
+        const uint8_t* bytes = (const uint8_t*)arrays[a];
+        for (size_t i = 0; i < counts[a] * sizeof(Body); ++i) { hash = (hash ^ bytes[i]) * 1099511628211ull; }
+    }
+    return hash;
+}
+
+int main(int argc, char* argv[]) {
+    const int ticks = argc > 1 ? atoi(argv[1]) : BENCHMARK_DEFAULT_TICKS;
+    if (ticks <= 0) {
+        fprintf(stderr, "Usage: %s [ticks]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    CF_Rnd rnd = cf_rnd_seed(0x5EED);
+    reset_bodies(&rnd);
+
+    const CF_Stopwatch stopwatch = cf_make_stopwatch();
+    for (int tick = 0; tick < ticks; ++tick) { run_tick(&rnd, tick); }
+    const double elapsed_ms = cf_stopwatch_milliseconds(stopwatch);
+
+    const double bodies = (double)(BENCHMARK_ENEMIES + BENCHMARK_BULLETS + BENCHMARK_PARTICLES) * ticks;
+    printf(
+        "%s: %d ticks in %.1f ms, %.3f us per tick, %.1f M bodies/s, checksum %016llx\n",
+        SIM_FIXED_POINT ? "fixed" : "float",
+        ticks,
+        elapsed_ms,
+        elapsed_ms * 1000.0 / ticks,
+        bodies / elapsed_ms / 1000.0,
+        (unsigned long long)checksum_bodies()
+    );
+
+    return EXIT_SUCCESS;
+}